@@ -1882,7 +1882,11 @@ static void handle_peer_fulfill_htlc(struct peer *peer, const u8 *msg)
 	e = channel_fulfill_htlc(peer->channel, LOCAL, id, &preimage, &h);
 	switch (e) {
 	case CHANNEL_ERR_REMOVE_OK:
-		/* FIXME: We could send preimages to master immediately. */
+		/* Master can fulfill upstream now: it doesn't need to
+		 * wait for this to be committed. */
+		wire_sync_write(MASTER_FD,
+				take(towire_channeld_got_preimage(NULL, id,
+								  &preimage)));
 		start_commit_timer(peer);
 		return;
 	/* These shouldn't happen, because any offered HTLC (which would give
@@ -3631,6 +3635,7 @@ static void req_in(struct peer *peer, const u8 *msg)
 	case WIRE_CHANNELD_SENDING_COMMITSIG:
 	case WIRE_CHANNELD_GOT_COMMITSIG:
 	case WIRE_CHANNELD_GOT_REVOKE:
+	case WIRE_CHANNELD_GOT_PREIMAGE:
 	case WIRE_CHANNELD_SENDING_COMMITSIG_REPLY:
 	case WIRE_CHANNELD_GOT_COMMITSIG_REPLY:
 	case WIRE_CHANNELD_GOT_REVOKE_REPLY:
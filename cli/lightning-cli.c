@@ -6,8 +6,10 @@
 #include <ccan/asort/asort.h>
 #include <ccan/err/err.h>
 #include <ccan/json_escape/json_escape.h>
+#include <ccan/mem/mem.h>
 #include <ccan/opt/opt.h>
 #include <ccan/read_write_all/read_write_all.h>
+#include <ccan/str/str.h>
 #include <ccan/tal/path/path.h>
 #include <ccan/tal/str/str.h>
 #include <common/configdir.h>
@@ -29,6 +31,26 @@
 
 struct netaddr;
 
+static void human_chars(const char *buffer, size_t len, char term)
+{
+	for (size_t i = 0; i < len; i++) {
+		/* We only translate \n and \t. */
+		if (buffer[i] == '\\' && i + 1 < len) {
+			if (buffer[i+1] == 'n') {
+				fputc('\n', stdout);
+				i++;
+				continue;
+			} else if (buffer[i+1] == 't') {
+				fputc('\t', stdout);
+				i++;
+				continue;
+			}
+		}
+		fputc(buffer[i], stdout);
+	}
+	fputc(term, stdout);
+}
+
 /* Returns number of tokens digested */
 static size_t human_readable(const char *buffer, const jsmntok_t *t, char term)
 {
@@ -37,22 +59,7 @@ static size_t human_readable(const char *buffer, const jsmntok_t *t, char term)
 	switch (t->type) {
 	case JSMN_PRIMITIVE:
 	case JSMN_STRING:
-		for (i = t->start; i < t->end; i++) {
-			/* We only translate \n and \t. */
-			if (buffer[i] == '\\' && i + 1 < t->end) {
-				if (buffer[i+1] == 'n') {
-					fputc('\n', stdout);
-					i++;
-					continue;
-				} else if (buffer[i+1] == 't') {
-					fputc('\t', stdout);
-					i++;
-					continue;
-				}
-			}
-			fputc(buffer[i], stdout);
-		}
-		fputc(term, stdout);
+		human_chars(buffer + t->start, t->end - t->start, term);
 		return 1;
 	case JSMN_ARRAY:
 		n = 1;
@@ -615,6 +622,475 @@ static void opt_log_stderr_exit_usage(const char *fmt, ...)
 	exit(ERROR_USAGE);
 }
 
+/* Responses bigger than this are formatted as they arrive, rather than
+ * buffering (and tokenizing) the whole thing first. */
+static size_t stream_min_response = 1024 * 1024;
+
+enum stream_state {
+	/* Expecting the '{' of the response */
+	STREAM_START,
+	/* Looking through the response for "result" */
+	STREAM_ENVELOPE,
+	STREAM_ENVELOPE_COLON,
+	STREAM_ENVELOPE_VALUE,
+	/* Expecting the '{' of the result */
+	STREAM_RESULT,
+	/* Inside result: expecting a member, or the end */
+	STREAM_MEMBER,
+	STREAM_MEMBER_COLON,
+	STREAM_MEMBER_VALUE,
+	/* Inside an array member: expecting an element, or the end */
+	STREAM_ELEMENT,
+	STREAM_DONE,
+};
+
+struct stream {
+	enum format format;
+	/* Don't print "format-hint" */
+	bool drop_hint;
+	const char *idstr;
+	bool id_ok;
+	bool *last_was_progress;
+	enum stream_state state;
+	/* Once we've started printing, there's no going back. */
+	bool committed;
+
+	char *buf;
+	size_t len, pos;
+
+	/* Value we're part way through scanning. */
+	bool scanning;
+	size_t start;
+	int depth;
+	bool in_string, escaped;
+
+	/* Current key (of response, or result) */
+	char *key;
+	/* Members of result and elements of current array printed so far */
+	size_t num_members, num_elems;
+	/* RAW: how much of buf we've printed already. */
+	size_t raw_off;
+};
+
+static bool stream_skip_space(struct stream *s)
+{
+	while (s->pos < s->len && cisspace(s->buf[s->pos]))
+		s->pos++;
+	return s->pos < s->len;
+}
+
+/* Scan (more of) the value starting at s->start: we only need to find
+ * where it ends, so this is trivial, and keeps state between reads so
+ * we never rescan.  Returns false if we need more data. */
+static bool stream_scan_value(struct stream *s)
+{
+	if (!s->scanning) {
+		s->scanning = true;
+		s->start = s->pos;
+		s->depth = 0;
+		s->in_string = s->escaped = false;
+	}
+
+	while (s->pos < s->len) {
+		char c = s->buf[s->pos];
+
+		if (s->in_string) {
+			s->pos++;
+			if (s->escaped)
+				s->escaped = false;
+			else if (c == '\\')
+				s->escaped = true;
+			else if (c == '"') {
+				s->in_string = false;
+				if (s->depth == 0)
+					goto done;
+			}
+			continue;
+		}
+
+		if (c == '"')
+			s->in_string = true;
+		else if (c == '{' || c == '[')
+			s->depth++;
+		else if (c == '}' || c == ']') {
+			/* End of enclosing object terminates a primitive */
+			if (s->depth == 0)
+				goto done;
+			if (--s->depth == 0) {
+				s->pos++;
+				goto done;
+			}
+		} else if (s->depth == 0 && (c == ',' || cisspace(c)))
+			goto done;
+		s->pos++;
+	}
+	return false;
+
+done:
+	s->scanning = false;
+	if (s->pos == s->start)
+		errx(ERROR_TALKING_TO_LIGHTNINGD,
+		     "Malformed response '%.*s'",
+		     (int)(s->len - s->start), s->buf + s->start);
+	return true;
+}
+
+static bool stream_scan_key(struct stream *s)
+{
+	if (!stream_scan_value(s))
+		return false;
+
+	if (s->buf[s->start] != '"')
+		errx(ERROR_TALKING_TO_LIGHTNINGD,
+		     "Malformed response '%.*s'",
+		     (int)(s->len - s->start), s->buf + s->start);
+	tal_free(s->key);
+	s->key = tal_strndup(s, s->buf + s->start + 1,
+			     s->pos - s->start - 2);
+	return true;
+}
+
+/* Tokenize a single complete value from the response. */
+static jsmntok_t *stream_tokens(const char *val, size_t len)
+{
+	jsmntok_t *toks;
+
+	/* jsmn (in strict mode) won't parse a bare primitive without a
+	 * delimiter after it, and we don't need it to. */
+	if (val[0] != '{' && val[0] != '[') {
+		toks = tal_arrz(NULL, jsmntok_t, 1);
+		if (val[0] == '"') {
+			toks[0].type = JSMN_STRING;
+			toks[0].start = 1;
+			toks[0].end = len - 1;
+		} else {
+			toks[0].type = JSMN_PRIMITIVE;
+			toks[0].start = 0;
+			toks[0].end = len;
+		}
+		return toks;
+	}
+
+	toks = json_parse_simple(NULL, val, len);
+	if (!toks)
+		errx(ERROR_TALKING_TO_LIGHTNINGD,
+		     "Malformed response '%.*s'", (int)len, val);
+	return toks;
+}
+
+/* We print each result member as the non-streaming case would. */
+static void stream_member_start(struct stream *s)
+{
+	switch (s->format) {
+	case JSON:
+		if (s->num_members == 0)
+			printf("{\n   ");
+		else
+			printf(",\n   ");
+		printf("\"%s\": ", s->key);
+		break;
+	default:
+		break;
+	}
+	s->num_members++;
+}
+
+static void stream_member(struct stream *s, const char *val, size_t len)
+{
+	jsmntok_t *toks;
+
+	if (s->drop_hint && streq(s->key, "format-hint"))
+		return;
+
+	stream_member_start(s);
+	toks = stream_tokens(val, len);
+	switch (s->format) {
+	case JSON:
+		print_json(val, toks, "   ");
+		break;
+	case FLAT:
+		flat_json(s->key, val, toks);
+		break;
+	default:
+		abort();
+	}
+	tal_free(toks);
+}
+
+static void stream_array_start(struct stream *s)
+{
+	s->num_elems = 0;
+	stream_member_start(s);
+}
+
+static void stream_element(struct stream *s, const char *val, size_t len)
+{
+	jsmntok_t *toks = stream_tokens(val, len);
+	char *p;
+
+	switch (s->format) {
+	case JSON:
+		if (s->num_elems == 0)
+			printf("[\n      ");
+		else
+			printf(",\n      ");
+		print_json(val, toks, "      ");
+		break;
+	case FLAT:
+		p = tal_fmt(NULL, "%s[%zi]", s->key, s->num_elems);
+		flat_json(p, val, toks);
+		tal_free(p);
+		break;
+	default:
+		abort();
+	}
+	tal_free(toks);
+	s->num_elems++;
+}
+
+static void stream_array_end(struct stream *s)
+{
+	if (s->format != JSON)
+		return;
+	if (s->num_elems == 0)
+		printf("[]");
+	else
+		printf("\n   ]");
+}
+
+static void stream_result_end(struct stream *s)
+{
+	switch (s->format) {
+	case JSON:
+		if (s->num_members == 0)
+			printf("{}");
+		else
+			printf("\n}");
+		printf("\n");
+		break;
+	case RAW:
+		printf("\n");
+		break;
+	default:
+		break;
+	}
+}
+
+static void stream_malformed(const struct stream *s)
+{
+	errx(ERROR_TALKING_TO_LIGHTNINGD, "Malformed response '%.*s'",
+	     (int)(s->len - s->pos), s->buf + s->pos);
+}
+
+/* Consume as much of the buffer as we can.  Returns false if this isn't
+ * a response we can stream (which we only find out before committing). */
+static bool stream_process(struct stream *s)
+{
+	char c;
+
+	while (s->state != STREAM_DONE) {
+		if (!s->scanning && !stream_skip_space(s))
+			return true;
+		c = s->buf[s->pos];
+
+		switch (s->state) {
+		case STREAM_START:
+			if (c != '{')
+				return false;
+			s->pos++;
+			s->state = STREAM_ENVELOPE;
+			break;
+		case STREAM_ENVELOPE:
+			if (!s->scanning && c == ',') {
+				s->pos++;
+				break;
+			}
+			if (!s->scanning && c != '"')
+				return false;
+			if (!stream_scan_key(s))
+				return true;
+			s->state = STREAM_ENVELOPE_COLON;
+			break;
+		case STREAM_ENVELOPE_COLON:
+			if (c != ':')
+				return false;
+			s->pos++;
+			if (streq(s->key, "result")) {
+				/* lightningd puts the id first */
+				if (!s->id_ok)
+					return false;
+				s->state = STREAM_RESULT;
+			} else if (streq(s->key, "id")
+				   || streq(s->key, "jsonrpc"))
+				s->state = STREAM_ENVELOPE_VALUE;
+			else
+				/* An error, or a notification */
+				return false;
+			break;
+		case STREAM_ENVELOPE_VALUE:
+			if (!stream_scan_value(s))
+				return true;
+			if (streq(s->key, "id"))
+				s->id_ok = s->buf[s->start] == '"'
+					&& memeq(s->buf + s->start + 1,
+						 s->pos - s->start - 2,
+						 s->idstr, strlen(s->idstr));
+			s->state = STREAM_ENVELOPE;
+			break;
+		case STREAM_RESULT:
+			if (c != '{')
+				return false;
+			s->committed = true;
+			if (*s->last_was_progress)
+				printf("\n");
+			s->raw_off = s->pos;
+			s->pos++;
+			s->state = STREAM_MEMBER;
+			break;
+		case STREAM_MEMBER:
+			if (!s->scanning && c == ',') {
+				s->pos++;
+				break;
+			}
+			if (!s->scanning && c == '}') {
+				s->pos++;
+				s->state = STREAM_DONE;
+				break;
+			}
+			if (!s->scanning && c != '"')
+				stream_malformed(s);
+			if (!stream_scan_key(s))
+				return true;
+			s->state = STREAM_MEMBER_COLON;
+			break;
+		case STREAM_MEMBER_COLON:
+			if (c != ':')
+				stream_malformed(s);
+			s->pos++;
+			s->state = STREAM_MEMBER_VALUE;
+			break;
+		case STREAM_MEMBER_VALUE:
+			if (!s->scanning && c == '[') {
+				s->pos++;
+				if (s->format != RAW)
+					stream_array_start(s);
+				s->state = STREAM_ELEMENT;
+				break;
+			}
+			if (!stream_scan_value(s))
+				return true;
+			if (s->format != RAW)
+				stream_member(s, s->buf + s->start,
+					      s->pos - s->start);
+			s->state = STREAM_MEMBER;
+			break;
+		case STREAM_ELEMENT:
+			if (!s->scanning && c == ',') {
+				s->pos++;
+				break;
+			}
+			if (!s->scanning && c == ']') {
+				s->pos++;
+				if (s->format != RAW)
+					stream_array_end(s);
+				s->state = STREAM_MEMBER;
+				break;
+			}
+			if (!stream_scan_value(s))
+				return true;
+			if (s->format != RAW)
+				stream_element(s, s->buf + s->start,
+					       s->pos - s->start);
+			break;
+		case STREAM_DONE:
+			abort();
+		}
+	}
+	return true;
+}
+
+/* Once we're printing, we only need to keep what we haven't consumed. */
+static void stream_compact(struct stream *s)
+{
+	size_t keep = s->scanning ? s->start : s->pos;
+
+	if (s->format == RAW) {
+		printf("%.*s", (int)(s->pos - s->raw_off), s->buf + s->raw_off);
+		s->raw_off = s->pos;
+	}
+
+	memmove(s->buf, s->buf + keep, s->len - keep);
+	s->len -= keep;
+	s->pos -= keep;
+	s->raw_off -= keep;
+	if (s->scanning)
+		s->start -= keep;
+	s->buf[s->len] = '\0';
+}
+
+/* Print a large response as it arrives: each member of the result, and
+ * each element of array members, is tokenized and printed on its own, so
+ * we don't need to hold it all in memory.  Returns -1 if we can't,
+ * having printed nothing (but maybe read more into *resp). */
+static int stream_response(int fd, char **resp, size_t *off,
+			   enum format format,
+			   const char *method, const char *command,
+			   const char *idstr, bool *last_was_progress)
+{
+	struct stream *s;
+
+	/* We need the whole thing to sort help output. */
+	if (format == DEFAULT_FORMAT && streq(method, "help") && !command)
+		return -1;
+
+	/* Humans elide the name of a lone member, but we can't know it's
+	 * alone until we've seen the end of it. */
+	if (format == HUMAN)
+		return -1;
+
+	s = talz(NULL, struct stream);
+	s->drop_hint = (format == DEFAULT_FORMAT);
+	/* We don't apply format hints to huge outputs. */
+	s->format = format == DEFAULT_FORMAT ? JSON : format;
+	s->idstr = idstr;
+	s->last_was_progress = last_was_progress;
+	s->state = STREAM_START;
+	s->buf = *resp;
+	s->len = *off;
+
+	while (stream_process(s)) {
+		if (s->state == STREAM_DONE) {
+			stream_compact(s);
+			stream_result_end(s);
+			tal_free(s);
+			return NO_ERROR;
+		}
+
+		if (s->committed)
+			stream_compact(s);
+
+		/* Need more data: make room if necessary */
+		if (s->len == tal_bytelen(s->buf) - 1) {
+			if (!tal_resize(&s->buf, tal_count(s->buf) * 2)) {
+				if (!s->committed)
+					oom_dump(fd, s->buf, s->len);
+				errx(ERROR_TALKING_TO_LIGHTNINGD,
+				     "Out of memory reading response");
+			}
+		}
+		s->len += read_nofail(fd, s->buf + s->len,
+				      tal_bytelen(s->buf) - 1 - s->len);
+		s->buf[s->len] = '\0';
+		/* Caller needs to see this if we give up. */
+		*resp = s->buf;
+		*off = s->len;
+	}
+
+	assert(!s->committed);
+	tal_free(s);
+	return -1;
+}
+
 struct commando {
 	const char *peer_id;
 	const char *rune;
@@ -656,7 +1132,7 @@ int main(int argc, char *argv[])
 	enum format format = DEFAULT_FORMAT;
 	enum input input = DEFAULT_INPUT;
 	enum log_level notification_level = LOG_INFORM;
-	bool last_was_progress = false;
+	bool last_was_progress = false, try_stream = true;
 	char *command = NULL, *filter = NULL;
 	struct commando *commando = NULL;
 
@@ -863,6 +1339,22 @@ int main(int argc, char *argv[])
 		case JSMN_ERROR_PART:
 			/* We may actually have a complete token! */
 			if (toks[0].type == JSMN_UNDEFINED || toks[0].end == -1) {
+				/* Huge response?  Print it as it arrives. */
+				if (off > stream_min_response && try_stream) {
+					int ret = stream_response(fd, &resp, &off,
+								  format, method,
+								  command, idstr,
+								  &last_was_progress);
+					if (ret >= 0) {
+						tal_free(ctx);
+						opt_free_table();
+						return ret;
+					}
+					try_stream = false;
+					/* It may have read more: parse that first */
+					parserr = JSMN_ERROR_NOMEM;
+					break;
+				}
 				/* Need more data: make room if necessary */
 				if (off == tal_bytelen(resp) - 1) {
 					if (!tal_resize(&resp, tal_count(resp) * 2))
@@ -880,6 +1372,7 @@ int main(int argc, char *argv[])
 				off -= len;
 				jsmn_init(&parser);
 				toks[0].type = JSMN_UNDEFINED;
+				try_stream = true;
 				/* Don't force another read! */
 				parserr = JSMN_ERROR_NOMEM;
 			}
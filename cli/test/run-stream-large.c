@@ -0,0 +1,341 @@
+#include "config.h"
+#include "config_test.h"
+#include <ccan/array_size/array_size.h>
+#include <common/amount.h>
+#include <common/bigsize.h>
+#include <common/channel_id.h>
+#include <common/configvar.h>
+#include <common/json_stream.h>
+#include <common/node_id.h>
+#include <common/setup.h>
+#include <common/wireaddr.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+
+int test_main(int argc, char *argv[]);
+ssize_t test_read(int fd, void *buf, size_t len);
+int test_socket(int domain, int type, int protocol);
+int test_connect(int sockfd, const struct sockaddr *addr,
+		 socklen_t addrlen);
+int test_getpid(void);
+int test_printf(const char *format, ...);
+int test_fputc(int c, FILE *stream);
+int test_chdir(const char *path);
+
+#define main test_main
+#define cli_read test_read
+#define socket test_socket
+#define connect test_connect
+#define getpid test_getpid
+#define printf test_printf
+#define fputc test_fputc
+#define chdir test_chdir
+
+  #include "../lightning-cli.c"
+#undef main
+
+/* AUTOGENERATED MOCKS START */
+/* Generated stub for amount_asset_is_main */
+bool amount_asset_is_main(struct amount_asset *asset UNNEEDED)
+{ fprintf(stderr, "amount_asset_is_main called!\n"); abort(); }
+/* Generated stub for amount_asset_to_sat */
+struct amount_sat amount_asset_to_sat(struct amount_asset *asset UNNEEDED)
+{ fprintf(stderr, "amount_asset_to_sat called!\n"); abort(); }
+/* Generated stub for amount_sat */
+struct amount_sat amount_sat(u64 satoshis UNNEEDED)
+{ fprintf(stderr, "amount_sat called!\n"); abort(); }
+/* Generated stub for amount_sat_add */
+ bool amount_sat_add(struct amount_sat *val UNNEEDED,
+				       struct amount_sat a UNNEEDED,
+				       struct amount_sat b UNNEEDED)
+{ fprintf(stderr, "amount_sat_add called!\n"); abort(); }
+/* Generated stub for amount_sat_div */
+struct amount_sat amount_sat_div(struct amount_sat sat UNNEEDED, u64 div UNNEEDED)
+{ fprintf(stderr, "amount_sat_div called!\n"); abort(); }
+/* Generated stub for amount_sat_eq */
+bool amount_sat_eq(struct amount_sat a UNNEEDED, struct amount_sat b UNNEEDED)
+{ fprintf(stderr, "amount_sat_eq called!\n"); abort(); }
+/* Generated stub for amount_sat_greater_eq */
+bool amount_sat_greater_eq(struct amount_sat a UNNEEDED, struct amount_sat b UNNEEDED)
+{ fprintf(stderr, "amount_sat_greater_eq called!\n"); abort(); }
+/* Generated stub for amount_sat_mul */
+bool amount_sat_mul(struct amount_sat *res UNNEEDED, struct amount_sat sat UNNEEDED, u64 mul UNNEEDED)
+{ fprintf(stderr, "amount_sat_mul called!\n"); abort(); }
+/* Generated stub for amount_sat_sub */
+ bool amount_sat_sub(struct amount_sat *val UNNEEDED,
+				       struct amount_sat a UNNEEDED,
+				       struct amount_sat b UNNEEDED)
+{ fprintf(stderr, "amount_sat_sub called!\n"); abort(); }
+/* Generated stub for amount_sat_to_asset */
+struct amount_asset amount_sat_to_asset(struct amount_sat *sat UNNEEDED, const u8 *asset UNNEEDED)
+{ fprintf(stderr, "amount_sat_to_asset called!\n"); abort(); }
+/* Generated stub for amount_tx_fee */
+struct amount_sat amount_tx_fee(u32 fee_per_kw UNNEEDED, size_t weight UNNEEDED)
+{ fprintf(stderr, "amount_tx_fee called!\n"); abort(); }
+/* Generated stub for fromwire_amount_msat */
+struct amount_msat fromwire_amount_msat(const u8 **cursor UNNEEDED, size_t *max UNNEEDED)
+{ fprintf(stderr, "fromwire_amount_msat called!\n"); abort(); }
+/* Generated stub for fromwire_amount_sat */
+struct amount_sat fromwire_amount_sat(const u8 **cursor UNNEEDED, size_t *max UNNEEDED)
+{ fprintf(stderr, "fromwire_amount_sat called!\n"); abort(); }
+/* Generated stub for fromwire_bigsize */
+bigsize_t fromwire_bigsize(const u8 **cursor UNNEEDED, size_t *max UNNEEDED)
+{ fprintf(stderr, "fromwire_bigsize called!\n"); abort(); }
+/* Generated stub for fromwire_channel_id */
+bool fromwire_channel_id(const u8 **cursor UNNEEDED, size_t *max UNNEEDED,
+			 struct channel_id *channel_id UNNEEDED)
+{ fprintf(stderr, "fromwire_channel_id called!\n"); abort(); }
+/* Generated stub for fromwire_node_id */
+void fromwire_node_id(const u8 **cursor UNNEEDED, size_t *max UNNEEDED, struct node_id *id UNNEEDED)
+{ fprintf(stderr, "fromwire_node_id called!\n"); abort(); }
+/* Generated stub for log_level_name */
+const char *log_level_name(enum log_level level UNNEEDED)
+{ fprintf(stderr, "log_level_name called!\n"); abort(); }
+/* Generated stub for log_level_parse */
+bool log_level_parse(const char *levelstr UNNEEDED, size_t len UNNEEDED,
+		     enum log_level *level UNNEEDED)
+{ fprintf(stderr, "log_level_parse called!\n"); abort(); }
+/* Generated stub for towire_amount_msat */
+void towire_amount_msat(u8 **pptr UNNEEDED, const struct amount_msat msat UNNEEDED)
+{ fprintf(stderr, "towire_amount_msat called!\n"); abort(); }
+/* Generated stub for towire_amount_sat */
+void towire_amount_sat(u8 **pptr UNNEEDED, const struct amount_sat sat UNNEEDED)
+{ fprintf(stderr, "towire_amount_sat called!\n"); abort(); }
+/* Generated stub for towire_bigsize */
+void towire_bigsize(u8 **pptr UNNEEDED, const bigsize_t val UNNEEDED)
+{ fprintf(stderr, "towire_bigsize called!\n"); abort(); }
+/* Generated stub for towire_channel_id */
+void towire_channel_id(u8 **pptr UNNEEDED, const struct channel_id *channel_id UNNEEDED)
+{ fprintf(stderr, "towire_channel_id called!\n"); abort(); }
+/* Generated stub for towire_node_id */
+void towire_node_id(u8 **pptr UNNEEDED, const struct node_id *id UNNEEDED)
+{ fprintf(stderr, "towire_node_id called!\n"); abort(); }
+/* AUTOGENERATED MOCKS END */
+
+int test_socket(int domain UNUSED, int type UNUSED, int protocol UNUSED)
+{
+	/* We give a real fd, as it writes to it */
+	return open("/dev/null", O_WRONLY);
+}
+
+int test_connect(int sockfd UNUSED, const struct sockaddr *addr UNUSED,
+		 socklen_t addrlen UNUSED)
+{
+	return 0;
+}
+
+int test_getpid(void)
+{
+	return 9999;
+}
+
+int test_chdir(const char *path)
+{
+	return 0;
+}
+
+/* Output is captured here, unless NULL (then we discard it). */
+static char *output;
+
+int test_printf(const char *fmt, ...)
+{
+	va_list ap;
+
+	if (!output)
+		return 0;
+	va_start(ap, fmt);
+	tal_append_vfmt(&output, fmt, ap);
+	va_end(ap);
+	return 1;
+}
+
+int test_fputc(int c, FILE *stream)
+{
+	if (output)
+		tal_append_fmt(&output, "%c", c);
+	return (unsigned)c;
+}
+
+#define ENVELOPE "{\"jsonrpc\": \"2.0\", \"id\": \"cli:test#9999\", \"result\": "
+
+/* The response is generated as it's read: head, elements, tail. */
+struct response {
+	const char *head, *elem, *tail;
+	size_t num_elems;
+};
+
+static const struct response *response;
+static size_t piece, piece_off;
+
+static const char *response_piece(size_t n)
+{
+	if (n == 0)
+		return response->head;
+	if (n == 1)
+		return response->num_elems ? response->elem : response->tail;
+	if (n <= response->num_elems)
+		return tal_fmt(tmpctx, ",\n%s", response->elem);
+	if (n == response->num_elems + 1)
+		return response->tail;
+	return "";
+}
+
+ssize_t test_read(int fd UNUSED, void *buf, size_t len)
+{
+	const char *p = response_piece(piece);
+	size_t plen = strlen(p + piece_off);
+
+	/* Like a real socket, give them small-ish pieces */
+	if (len > 4096)
+		len = 4096;
+	if (len > plen)
+		len = plen;
+	memcpy(buf, p + piece_off, len);
+	piece_off += len;
+	if (piece_off == strlen(p)) {
+		piece++;
+		piece_off = 0;
+		clean_tmpctx();
+	}
+	return len;
+}
+
+static int run(const struct response *r, const char *format)
+{
+	char *fake_argv[] = { "lightning-cli", "--lightning-dir=/tmp/",
+			      "test", "-N", "none", (char *)format, NULL };
+
+	response = r;
+	piece = piece_off = 0;
+	return test_main(format ? 6 : 5, fake_argv);
+}
+
+/* Streamed output must be exactly what we'd print if we buffered it all. */
+static void check_format(const struct response *r, const char *format)
+{
+	char *buffered, *streamed;
+
+	stream_min_response = SIZE_MAX;
+	output = tal_strdup(NULL, "");
+	assert(run(r, format) == 0);
+	buffered = output;
+
+	stream_min_response = 0;
+	output = tal_strdup(NULL, "");
+	assert(run(r, format) == 0);
+	streamed = output;
+	output = NULL;
+
+	assert(streq(buffered, streamed));
+	tal_free(buffered);
+	tal_free(streamed);
+}
+
+static const struct response multi = {
+	ENVELOPE "{\"num\": 1, \"s\": \"x\\ny\\tz\", \"empty\": [],"
+	" \"obj\": {\"k\": \"v\", \"n\": [1, 2]}, \"entries\": [",
+	"{\"type\": \"DEBUG\", \"log\": \"some \\\"quoted\\\" {text}\","
+	" \"num\": [1, {\"a\": null}]}",
+	"], \"last\": true} }\n\n",
+	10
+};
+
+static const struct response hinted = {
+	ENVELOPE "{\"format-hint\": \"simple\", \"peers\": [",
+	"{\"id\": \"02b78caed0f45120acc48efe867aa506e8ea60f0712a23303178471da0ca2213f5\", \"connected\": false}",
+	"]}}\n\n",
+	3
+};
+
+static const struct response single = {
+	ENVELOPE "{\"log\": [",
+	"\"line\\twith\\ttabs\"",
+	"]}}\n\n",
+	5
+};
+
+/* Like listfunds: more than one array member. */
+static const struct response arrays = {
+	ENVELOPE "{\"outputs\": [",
+	"{\"txid\": \"a1\", \"output\": 0}",
+	"], \"channels\": [{\"peer_id\": \"b2\"}, {\"peer_id\": \"c3\"}]}}\n\n",
+	4
+};
+
+static const struct response object = {
+	ENVELOPE "{\"info\": {\"a\": 1, \"b\": \"c\"}}}\n\n",
+	NULL,
+	"",
+	0
+};
+
+static const struct response empty = {
+	ENVELOPE "{}}\n\n",
+	NULL,
+	"",
+	0
+};
+
+/* Something like listlogs, but much bigger */
+static struct response huge = {
+	ENVELOPE "{\"creation_time\": \"1515999039.806099043\","
+	" \"bytes_used\": 10787759, \"bytes_max\": 20971520, \"log\": [",
+	"{\"type\": \"DEBUG\", \"time\": \"241693.051558854\", \"source\": \"lightning_gossipd(14581):\", \"log\": \"TRACE: nonlocal_gossip_broadcast_done\"}",
+	"]}}\n\n",
+	/* ~140MB */
+	1000000
+};
+
+static long max_rss_kb(void)
+{
+	struct rusage ru;
+
+	if (getrusage(RUSAGE_SELF, &ru) != 0)
+		abort();
+	return ru.ru_maxrss;
+}
+
+int main(int argc UNUSED, char *argv[])
+{
+	const char *formats[] = { "-J", "-F", "-H", "-R" };
+	bool slow = false;
+	const char *v;
+	long before;
+
+	common_setup(argv[0]);
+
+	for (size_t i = 0; i < ARRAY_SIZE(formats); i++) {
+		check_format(&multi, formats[i]);
+		check_format(&hinted, formats[i]);
+		check_format(&single, formats[i]);
+		check_format(&arrays, formats[i]);
+		check_format(&object, formats[i]);
+		check_format(&empty, formats[i]);
+	}
+	/* The default (no hint) is JSON, except "help". */
+	check_format(&multi, NULL);
+	check_format(&single, NULL);
+
+	v = getenv("VALGRIND");
+	if (v && atoi(v) == 1)
+		slow = true;
+	v = getenv("SLOW_MACHINE");
+	if (v && atoi(v) == 1)
+		slow = true;
+	if (slow)
+		huge.num_elems /= 100;
+
+	/* Far more than we'd buffer: memory usage should not grow with it. */
+	stream_min_response = 1024 * 1024;
+	before = max_rss_kb();
+	assert(run(&huge, NULL) == 0);
+	assert(piece == huge.num_elems + 2);
+	if (!slow)
+		assert(max_rss_kb() - before < 32 * 1024);
+
+	assert(!taken_any());
+	common_shutdown();
+	return 0;
+}
@@ -11,6 +11,9 @@ struct daemon_conn {
 	u8 *msg_in;
 	int fd_in;
 
+	/* Messages we've read but not yet handled (NULL if we can get fds) */
+	struct wire_rbuf *rbuf;
+
 	/* Queue of outgoing messages */
 	struct msg_queue *out;
 
@@ -41,6 +44,9 @@ struct io_plan *daemon_conn_read_next(struct io_conn *conn,
 	/* FIXME: We could use disposable parent instead, and recv() could
 	 * tal_steal() it?  If they did that now, we'd free it here. */
 	tal_free(dc->msg_in);
+	if (dc->rbuf)
+		return io_read_wire_buffered(conn, dc, &dc->msg_in, dc->rbuf,
+					     handle_read, dc);
 	return io_read_wire(conn, dc, &dc->msg_in, handle_read, dc);
 }
 
@@ -60,6 +66,8 @@ struct io_plan *daemon_conn_read_with_fd_(struct io_conn *conn,
 {
 	/* We only get this for the type! */
 	assert(arg == dc->arg);
+	/* We might have read the fd's byte already! */
+	assert(!dc->rbuf);
 	dc->recv_fd = recv_fd;
 	return io_recv_fd(conn, &dc->fd_in, handle_recv_fd, dc);
 }
@@ -67,25 +75,24 @@ struct io_plan *daemon_conn_read_with_fd_(struct io_conn *conn,
 static struct io_plan *daemon_conn_write_next(struct io_conn *conn,
 					      struct daemon_conn *dc)
 {
-	const u8 *msg;
-
-	msg = msg_dequeue(dc->out);
+	const u8 *msg, **msgs;
 
 	/* If nothing in queue, give empty callback a chance to queue somthing */
-	if (!msg && dc->outq_empty) {
+	if (!msg_queue_length(dc->out) && dc->outq_empty)
 		dc->outq_empty(dc->arg);
-		msg = msg_dequeue(dc->out);
-	}
 
+	/* Send everything up to the next fd in one go. */
+	msgs = msg_dequeue_many(dc, dc->out, WIRE_WRITE_BATCH);
+	if (msgs)
+		return io_write_wires(conn, take(msgs),
+				      daemon_conn_write_next, dc);
+
+	msg = msg_dequeue(dc->out);
 	if (msg) {
 		int fd = msg_extract_fd(dc->out, msg);
-		if (fd >= 0) {
-			tal_free(msg);
-			return io_send_fd(conn, fd, true,
-					  daemon_conn_write_next, dc);
-		}
-		return io_write_wire(conn, take(msg), daemon_conn_write_next,
-				     dc);
+		assert(fd >= 0);
+		tal_free(msg);
+		return io_send_fd(conn, fd, true, daemon_conn_write_next, dc);
 	}
 	return msg_queue_wait(conn, dc->out, daemon_conn_write_next, dc);
 }
@@ -136,12 +143,13 @@ static void destroy_dc_from_conn(struct io_conn *conn, struct daemon_conn *dc)
 	tal_free(dc);
 }
 
-struct daemon_conn *daemon_conn_new_(const tal_t *ctx, int fd,
-				     struct io_plan *(*recv)(struct io_conn *,
-							     const u8 *,
-							     void *),
-				     void (*outq_empty)(void *),
-				     void *arg)
+static struct daemon_conn *new_daemon_conn(int fd,
+					    struct io_plan *(*recv)(struct io_conn *,
+								    const u8 *,
+								    void *),
+					    void (*outq_empty)(void *),
+					    void *arg,
+					    bool readahead)
 {
 	struct daemon_conn *dc = tal(NULL, struct daemon_conn);
 
@@ -149,6 +157,8 @@ struct daemon_conn *daemon_conn_new_(const tal_t *ctx, int fd,
 	dc->outq_empty = outq_empty;
 	dc->arg = arg;
 	dc->msg_in = NULL;
+	/* This must be set before io_new_conn, which starts reading. */
+	dc->rbuf = readahead ? wire_rbuf_new(dc) : NULL;
 	dc->out = msg_queue_new(dc, true);
 
 	dc->conn = io_new_conn(dc, fd, daemon_conn_start, dc);
@@ -156,6 +166,26 @@ struct daemon_conn *daemon_conn_new_(const tal_t *ctx, int fd,
 	return dc;
 }
 
+struct daemon_conn *daemon_conn_new_(const tal_t *ctx, int fd,
+				     struct io_plan *(*recv)(struct io_conn *,
+							     const u8 *,
+							     void *),
+				     void (*outq_empty)(void *),
+				     void *arg)
+{
+	return new_daemon_conn(fd, recv, outq_empty, arg, true);
+}
+
+struct daemon_conn *daemon_conn_new_noreadahead_(const tal_t *ctx, int fd,
+						 struct io_plan *(*recv)(struct io_conn *,
+									 const u8 *,
+									 void *),
+						 void (*outq_empty)(void *),
+						 void *arg)
+{
+	return new_daemon_conn(fd, recv, outq_empty, arg, false);
+}
+
 void daemon_conn_send(struct daemon_conn *dc, const u8 *msg)
 {
 	msg_enqueue(dc->out, msg);
@@ -29,6 +29,29 @@ struct daemon_conn *daemon_conn_new_(const tal_t *ctx, int fd,
 				     void (*outq_empty)(void *),
 				     void *arg);
 
+/**
+ * daemon_conn_new_noreadahead - Allocate a daemon connection which can get fds
+ *
+ * Like daemon_conn_new, but only reads one message at a time: reading as
+ * much as is available could swallow an fd.  Use this if you use
+ * daemon_conn_read_with_fd.
+ */
+#define daemon_conn_new_noreadahead(ctx, fd, recv, outq_empty, arg)	\
+	daemon_conn_new_noreadahead_((ctx), (fd),			\
+			 typesafe_cb_preargs(struct io_plan *, void *, \
+					     (recv), (arg), 	       \
+					     struct io_conn *,		\
+					     const u8 *),		\
+			 typesafe_cb(void, void *,  (outq_empty), (arg)), \
+			 arg)
+
+struct daemon_conn *daemon_conn_new_noreadahead_(const tal_t *ctx, int fd,
+						 struct io_plan *(*recv)(struct io_conn *,
+									 const u8 *,
+									 void *),
+						 void (*outq_empty)(void *),
+						 void *arg);
+
 /**
  * daemon_conn_send - Enqueue an outgoing message to be sent
  */
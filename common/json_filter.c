@@ -44,6 +44,28 @@ bool json_filter_ok(const struct json_filter *filter, const char *member)
 	return strmap_get(&filter->filter_map, member) != NULL;
 }
 
+/* Like json_filter_ok(), but for a member of the objects in the array
+ * we're in, before any of them is started. */
+bool json_filter_array_ok(const struct json_filter *filter, const char *member)
+{
+	const struct json_filter *child;
+
+	if (!filter)
+		return true;
+	if (filter->depth > 0)
+		return filter->positive;
+
+	/* Leaf node means everything in here; an object filter on an array
+	 * means nothing (and is reported as misuse). */
+	if (!filter->filter_array)
+		return strmap_empty(&filter->filter_map);
+
+	child = filter->filter_array;
+	if (!child->filter_array && strmap_empty(&child->filter_map))
+		return true;
+	return strmap_get(&child->filter_map, member) != NULL;
+}
+
 /* Returns true if we should print this new obj/array */
 bool json_filter_down(struct json_filter **filter, const char *member)
 {
@@ -14,6 +14,9 @@ struct json_filter;
 /* Print this? */
 bool json_filter_ok(const struct json_filter *filter, const char *member);
 
+/* Inside an array of objects: would we print this member of each? */
+bool json_filter_array_ok(const struct json_filter *filter, const char *member);
+
 /* Returns true if we should print this new obj/array */
 bool json_filter_down(struct json_filter **filter, const char *member);
 
@@ -71,6 +71,17 @@ const char *json_stream_detach_filter(const tal_t *ctx, struct json_stream *js)
 	return err;
 }
 
+bool json_stream_wants(const struct json_stream *js, const char *fieldname)
+{
+	return json_filter_ok(js->filter, fieldname);
+}
+
+bool json_stream_wants_in_array(const struct json_stream *js,
+				const char *fieldname)
+{
+	return json_filter_array_ok(js->filter, fieldname);
+}
+
 struct json_stream *json_stream_dup(const tal_t *ctx,
 				    struct json_stream *original,
 				    struct log *log)
@@ -206,16 +217,6 @@ void json_add_primitive(struct json_stream *js,
 		tal_free(val);
 }
 
-void json_add_string(struct json_stream *js,
-		     const char *fieldname,
-		     const char *str TAKES)
-{
-	if (json_filter_ok(js->filter, fieldname))
-		json_out_addstr(js->jout, fieldname, str);
-	if (taken(str))
-		tal_free(str);
-}
-
 static char *json_member_direct(struct json_stream *js,
 				const char *fieldname, size_t extra)
 {
@@ -225,6 +226,57 @@ static char *json_member_direct(struct json_stream *js,
 	return dest;
 }
 
+/* json_escape_needed() a word at a time: every string we emit goes
+ * through here, and almost none of them need escaping. */
+static bool str_escape_needed(const char *str, size_t len)
+{
+	const u64 ones = 0x0101010101010101ULL;
+	const u64 highs = 0x8080808080808080ULL;
+	size_t i;
+
+	for (i = 0; i + sizeof(u64) <= len; i += sizeof(u64)) {
+		u64 v;
+
+		memcpy(&v, str + i, sizeof(v));
+		/* Sets the high bit of some byte if any byte is < ' ', '"',
+		 * '\\' or 127 (and maybe spuriously for a later one). */
+		if (((v - ones * ' ')
+		     | ((v ^ (ones * '"')) - ones)
+		     | ((v ^ (ones * '\\')) - ones)
+		     | ((v ^ (ones * 127)) - ones)) & ~v & highs)
+			break;
+	}
+	return json_escape_needed(str + i, len - i);
+}
+
+/* Quote @len bytes of @str into the output, which must not need escaping */
+static void json_add_unescaped(struct json_stream *js,
+			       const char *fieldname,
+			       const char *str, size_t len)
+{
+	char *dest = json_member_direct(js, fieldname, 1 + len + 1);
+
+	dest[0] = '"';
+	memcpy(dest + 1, str, len);
+	dest[1 + len] = '"';
+}
+
+void json_add_string(struct json_stream *js,
+		     const char *fieldname,
+		     const char *str TAKES)
+{
+	if (json_filter_ok(js->filter, fieldname)) {
+		size_t len = strlen(str);
+
+		if (!str_escape_needed(str, len))
+			json_add_unescaped(js, fieldname, str, len);
+		else
+			json_out_addstr(js->jout, fieldname, str);
+	}
+	if (taken(str))
+		tal_free(str);
+}
+
 void json_add_jsonstr(struct json_stream *js,
 		      const char *fieldname,
 		      const char *jsonstr,
@@ -315,7 +367,14 @@ void json_add_s32(struct json_stream *result, const char *fieldname,
 void json_add_stringn(struct json_stream *result, const char *fieldname,
 		      const char *value TAKES, size_t value_len)
 {
-	json_add_str_fmt(result, fieldname, "%.*s", (int)value_len, value);
+	if (json_filter_ok(result->filter, fieldname)) {
+		if (!str_escape_needed(value, value_len))
+			json_add_unescaped(result, fieldname, value, value_len);
+		else
+			json_add_escaped_string(result, fieldname,
+						take(json_escape_len(NULL, value,
+								     value_len)));
+	}
 	if (taken(value))
 		tal_free(value);
 }
@@ -330,17 +389,30 @@ void json_add_null(struct json_stream *stream, const char *fieldname)
 	json_add_primitive(stream, fieldname, "null");
 }
 
+static char *hex_byte(char *dest, u8 byte)
+{
+	static const char hexdigits[] = "0123456789abcdef";
+
+	*(dest++) = hexdigits[byte >> 4];
+	*(dest++) = hexdigits[byte & 0xF];
+	return dest;
+}
+
 void json_add_hex(struct json_stream *js, const char *fieldname,
 		  const void *data, size_t len)
 {
-	/* Size without NUL term */
-	size_t hexlen = hex_str_size(len);
-	char str[hexlen];
+	const u8 *p = data;
+	char *dest;
 
-	if (!hex_encode(data, len, str, hexlen))
-		abort();
+	if (!json_filter_ok(js->filter, fieldname))
+		return;
 
-	json_add_string(js, fieldname, str);
+	/* Hex never needs escaping, so encode straight into the output */
+	dest = json_member_direct(js, fieldname, 1 + len * 2 + 1);
+	*(dest++) = '"';
+	for (size_t i = 0; i < len; i++)
+		dest = hex_byte(dest, p[i]);
+	*dest = '"';
 }
 
 void json_add_hex_talarr(struct json_stream *result,
@@ -355,12 +427,7 @@ void json_add_escaped_string(struct json_stream *result, const char *fieldname,
 {
 	if (json_filter_ok(result->filter, fieldname)) {
 		/* Already escaped, don't re-escape! */
-		char *dest = json_member_direct(result, fieldname,
-						1 + strlen(esc->s) + 1);
-
-		dest[0] = '"';
-		memcpy(dest + 1, esc->s, strlen(esc->s));
-		dest[1+strlen(esc->s)] = '"';
+		json_add_unescaped(result, fieldname, esc->s, strlen(esc->s));
 	}
 	if (taken(esc))
 		tal_free(esc);
@@ -392,6 +459,9 @@ void json_add_timeiso(struct json_stream *result,
 	char iso8601_msec_fmt[sizeof("YYYY-mm-ddTHH:MM:SS.%03dZ")];
 	char iso8601_s[sizeof("YYYY-mm-ddTHH:MM:SS.nnnZ")];
 
+	if (!json_filter_ok(result->filter, fieldname))
+		return;
+
 	strftime(iso8601_msec_fmt, sizeof(iso8601_msec_fmt),
 		 "%FT%T.%%03dZ", gmtime(&time->ts.tv_sec));
 	snprintf(iso8601_s, sizeof(iso8601_s),
@@ -462,10 +532,19 @@ void json_add_bip340sig(struct json_stream *response,
 void json_add_txid(struct json_stream *result, const char *fieldname,
 		   const struct bitcoin_txid *txid)
 {
-	char hex[hex_str_size(sizeof(*txid))];
+	const u8 *p = txid->shad.sha.u.u8;
+	char *dest;
 
-	bitcoin_txid_to_hex(txid, hex, sizeof(hex));
-	json_add_string(result, fieldname, hex);
+	if (!json_filter_ok(result->filter, fieldname))
+		return;
+
+	/* Like bitcoin_txid_to_hex(), txids are displayed backwards */
+	dest = json_member_direct(result, fieldname,
+				  1 + sizeof(*txid) * 2 + 1);
+	*(dest++) = '"';
+	for (size_t i = sizeof(*txid); i > 0; i--)
+		dest = hex_byte(dest, p[i-1]);
+	*dest = '"';
 }
 
 void json_add_outpoint(struct json_stream *result, const char *fieldname,
@@ -596,6 +675,8 @@ void json_add_tx(struct json_stream *result,
 		 const char *fieldname,
 		 const struct bitcoin_tx *tx)
 {
+	if (!json_filter_ok(result->filter, fieldname))
+		return;
 	json_add_hex_talarr(result, fieldname, linearize_tx(tmpctx, tx));
 }
 
@@ -604,8 +685,11 @@ void json_add_psbt(struct json_stream *stream,
 		   const struct wally_psbt *psbt TAKES)
 {
 	const char *psbt_b64;
-	psbt_b64 = psbt_to_b64(NULL, psbt);
-	json_add_string(stream, fieldname, take(psbt_b64));
+
+	if (json_filter_ok(stream->filter, fieldname)) {
+		psbt_b64 = psbt_to_b64(NULL, psbt);
+		json_add_string(stream, fieldname, take(psbt_b64));
+	}
 	if (taken(psbt))
 		tal_free(psbt);
 }
@@ -90,6 +90,15 @@ void json_stream_attach_filter(struct json_stream *js,
 /* Detach the filter: returns non-NULL string if it was misused. */
 const char *json_stream_detach_filter(const tal_t *ctx, struct json_stream *js);
 
+/* Would @fieldname be printed here?  Lets callers skip the work of
+ * gathering fields the filter would discard anyway. */
+bool json_stream_wants(const struct json_stream *js, const char *fieldname);
+
+/* Same, for @fieldname of each object in the array we're in: useful to
+ * decide what to fetch before iterating. */
+bool json_stream_wants_in_array(const struct json_stream *js,
+				const char *fieldname);
+
 /**
  * json_stream_close - finished writing to a JSON stream.
  * @js: the json_stream.
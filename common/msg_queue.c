@@ -60,6 +60,26 @@ const u8 *msg_dequeue(struct msg_queue *q)
 	return msg;
 }
 
+const u8 **msg_dequeue_many(const tal_t *ctx, struct msg_queue *q, size_t max)
+{
+	size_t n, total = tal_count(q->q);
+	const u8 **msgs;
+
+	for (n = 0; n < total && n < max; n++) {
+		if (q->fd_passing && fromwire_peektype(q->q[n]) == MSG_PASS_FD)
+			break;
+	}
+	if (!n)
+		return NULL;
+
+	msgs = tal_arr(ctx, const u8 *, n);
+	for (size_t i = 0; i < n; i++)
+		msgs[i] = tal_steal(msgs, q->q[i]);
+	memmove(q->q, q->q + n, sizeof(*q->q) * (total - n));
+	tal_resize(&q->q, total - n);
+	return msgs;
+}
+
 int msg_extract_fd(const struct msg_queue *q, const u8 *msg)
 {
 	const u8 *p = msg + sizeof(u16);
@@ -27,6 +27,10 @@ void msg_wake(const struct msg_queue *q);
 /* Returns NULL if nothing to do. */
 const u8 *msg_dequeue(struct msg_queue *q);
 
+/* Returns up to max messages from the front (as a tal array off ctx,
+ * owning them), stopping at any fd.  NULL if there are none. */
+const u8 **msg_dequeue_many(const tal_t *ctx, struct msg_queue *q, size_t max);
+
 /* Returns -1 if not an fd: close after sending. */
 int msg_extract_fd(const struct msg_queue *q, const u8 *msg);
 
@@ -16,6 +16,7 @@ static int status_fd = -1;
 static struct daemon_conn *status_conn;
 volatile bool logging_io = false;
 static bool was_logging_io;
+enum log_level status_log_level = LOG_DBG;
 
 /* If we're more than this many msgs deep, don't add debug messages. */
 #define TRACE_QUEUE_LIMIT 20
@@ -149,6 +150,11 @@ void status_vfmt(enum log_level level,
 {
 	char *str;
 
+	/* Don't bother formatting what lightningd won't print (though if
+	 * they've asked for IO logging, they get everything). */
+	if (level < status_log_level && !logging_io)
+		return;
+
 	/* We only suppress async debug msgs.  IO messages are even spammier
 	 * but they only occur when explicitly asked for */
 	if (level == LOG_DBG && status_conn) {
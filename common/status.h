@@ -27,6 +27,10 @@ void status_vfmt(enum log_level level,
 /* Usually we only log the packet names, not contents. */
 extern volatile bool logging_io;
 
+/* Lowest level lightningd will print (from --log-level): we don't send
+ * anything below this. */
+extern enum log_level status_log_level;
+
 /* This logs a debug summary if IO logging not enabled. */
 void status_peer_io(enum log_level iodir,
 		    const struct node_id *peer,
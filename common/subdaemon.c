@@ -1,4 +1,6 @@
 #include "config.h"
+#include <ccan/err/err.h>
+#include <ccan/str/str.h>
 #include <common/status.h>
 #include <common/subdaemon.h>
 #include <common/version.h>
@@ -28,6 +30,11 @@ void subdaemon_setup(int argc, char *argv[])
 	for (int i = 1; i < argc; i++) {
 		if (streq(argv[i], "--log-io"))
 			logging_io = true;
+		else if (strstarts(argv[i], "--log-level=")) {
+			const char *l = argv[i] + strlen("--log-level=");
+			if (!log_level_parse(l, strlen(l), &status_log_level))
+				errx(1, "Bad %s", argv[i]);
+		}
 	}
 
 	daemon_maybe_debug(argv);
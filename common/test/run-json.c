@@ -16,6 +16,9 @@ bool fromwire_tlv(const u8 **cursor UNNEEDED, size_t *max UNNEEDED,
 		  void *record UNNEEDED, struct tlv_field **fields UNNEEDED,
 		  const u64 *extra_types UNNEEDED, size_t *err_off UNNEEDED, u64 *err_type UNNEEDED)
 { fprintf(stderr, "fromwire_tlv called!\n"); abort(); }
+/* Generated stub for json_filter_array_ok */
+bool json_filter_array_ok(const struct json_filter *filter UNNEEDED, const char *member UNNEEDED)
+{ fprintf(stderr, "json_filter_array_ok called!\n"); abort(); }
 /* Generated stub for json_filter_down */
 bool json_filter_down(struct json_filter **filter UNNEEDED, const char *member UNNEEDED)
 { fprintf(stderr, "json_filter_down called!\n"); abort(); }
@@ -0,0 +1,365 @@
+#include "config.h"
+#include "../json_filter.c"
+#include "../json_stream.c"
+#include <assert.h>
+#include <ccan/array_size/array_size.h>
+#include <ccan/str/hex/hex.h>
+#include <ccan/tal/str/str.h>
+#include <common/setup.h>
+#include <stdio.h>
+
+/* AUTOGENERATED MOCKS START */
+/* Generated stub for amount_asset_is_main */
+bool amount_asset_is_main(struct amount_asset *asset UNNEEDED)
+{ fprintf(stderr, "amount_asset_is_main called!\n"); abort(); }
+/* Generated stub for amount_asset_to_sat */
+struct amount_sat amount_asset_to_sat(struct amount_asset *asset UNNEEDED)
+{ fprintf(stderr, "amount_asset_to_sat called!\n"); abort(); }
+/* Generated stub for amount_msat */
+struct amount_msat amount_msat(u64 millisatoshis UNNEEDED)
+{ fprintf(stderr, "amount_msat called!\n"); abort(); }
+/* Generated stub for amount_sat */
+struct amount_sat amount_sat(u64 satoshis UNNEEDED)
+{ fprintf(stderr, "amount_sat called!\n"); abort(); }
+/* Generated stub for amount_sat_add */
+ bool amount_sat_add(struct amount_sat *val UNNEEDED,
+				       struct amount_sat a UNNEEDED,
+				       struct amount_sat b UNNEEDED)
+{ fprintf(stderr, "amount_sat_add called!\n"); abort(); }
+/* Generated stub for amount_sat_div */
+struct amount_sat amount_sat_div(struct amount_sat sat UNNEEDED, u64 div UNNEEDED)
+{ fprintf(stderr, "amount_sat_div called!\n"); abort(); }
+/* Generated stub for amount_sat_eq */
+bool amount_sat_eq(struct amount_sat a UNNEEDED, struct amount_sat b UNNEEDED)
+{ fprintf(stderr, "amount_sat_eq called!\n"); abort(); }
+/* Generated stub for amount_sat_greater_eq */
+bool amount_sat_greater_eq(struct amount_sat a UNNEEDED, struct amount_sat b UNNEEDED)
+{ fprintf(stderr, "amount_sat_greater_eq called!\n"); abort(); }
+/* Generated stub for amount_sat_mul */
+bool amount_sat_mul(struct amount_sat *res UNNEEDED, struct amount_sat sat UNNEEDED, u64 mul UNNEEDED)
+{ fprintf(stderr, "amount_sat_mul called!\n"); abort(); }
+/* Generated stub for amount_sat_sub */
+ bool amount_sat_sub(struct amount_sat *val UNNEEDED,
+				       struct amount_sat a UNNEEDED,
+				       struct amount_sat b UNNEEDED)
+{ fprintf(stderr, "amount_sat_sub called!\n"); abort(); }
+/* Generated stub for amount_sat_to_asset */
+struct amount_asset amount_sat_to_asset(struct amount_sat *sat UNNEEDED, const u8 *asset UNNEEDED)
+{ fprintf(stderr, "amount_sat_to_asset called!\n"); abort(); }
+/* Generated stub for amount_sat_to_msat */
+ bool amount_sat_to_msat(struct amount_msat *msat UNNEEDED,
+					   struct amount_sat sat UNNEEDED)
+{ fprintf(stderr, "amount_sat_to_msat called!\n"); abort(); }
+/* Generated stub for amount_tx_fee */
+struct amount_sat amount_tx_fee(u32 fee_per_kw UNNEEDED, size_t weight UNNEEDED)
+{ fprintf(stderr, "amount_tx_fee called!\n"); abort(); }
+/* Generated stub for command_fail */
+struct command_result *command_fail(struct command *cmd UNNEEDED, enum jsonrpc_errcode code UNNEEDED,
+				    const char *fmt UNNEEDED, ...)
+
+{ fprintf(stderr, "command_fail called!\n"); abort(); }
+/* Generated stub for command_filter_ptr */
+struct json_filter **command_filter_ptr(struct command *cmd UNNEEDED)
+{ fprintf(stderr, "command_filter_ptr called!\n"); abort(); }
+/* Generated stub for fmt_amount_sat */
+const char *fmt_amount_sat(const tal_t *ctx UNNEEDED, struct amount_sat sat UNNEEDED)
+{ fprintf(stderr, "fmt_amount_sat called!\n"); abort(); }
+/* Generated stub for fmt_wireaddr_without_port */
+char *fmt_wireaddr_without_port(const tal_t *ctx UNNEEDED, const struct wireaddr *a UNNEEDED)
+{ fprintf(stderr, "fmt_wireaddr_without_port called!\n"); abort(); }
+/* Generated stub for fromwire */
+const u8 *fromwire(const u8 **cursor UNNEEDED, size_t *max UNNEEDED, void *copy UNNEEDED, size_t n UNNEEDED)
+{ fprintf(stderr, "fromwire called!\n"); abort(); }
+/* Generated stub for fromwire_bool */
+bool fromwire_bool(const u8 **cursor UNNEEDED, size_t *max UNNEEDED)
+{ fprintf(stderr, "fromwire_bool called!\n"); abort(); }
+/* Generated stub for fromwire_fail */
+void *fromwire_fail(const u8 **cursor UNNEEDED, size_t *max UNNEEDED)
+{ fprintf(stderr, "fromwire_fail called!\n"); abort(); }
+/* Generated stub for fromwire_secp256k1_ecdsa_signature */
+void fromwire_secp256k1_ecdsa_signature(const u8 **cursor UNNEEDED, size_t *max UNNEEDED,
+					secp256k1_ecdsa_signature *signature UNNEEDED)
+{ fprintf(stderr, "fromwire_secp256k1_ecdsa_signature called!\n"); abort(); }
+/* Generated stub for fromwire_sha256 */
+void fromwire_sha256(const u8 **cursor UNNEEDED, size_t *max UNNEEDED, struct sha256 *sha256 UNNEEDED)
+{ fprintf(stderr, "fromwire_sha256 called!\n"); abort(); }
+/* Generated stub for fromwire_tal_arrn */
+u8 *fromwire_tal_arrn(const tal_t *ctx UNNEEDED,
+		       const u8 **cursor UNNEEDED, size_t *max UNNEEDED, size_t num UNNEEDED)
+{ fprintf(stderr, "fromwire_tal_arrn called!\n"); abort(); }
+/* Generated stub for fromwire_u32 */
+u32 fromwire_u32(const u8 **cursor UNNEEDED, size_t *max UNNEEDED)
+{ fprintf(stderr, "fromwire_u32 called!\n"); abort(); }
+/* Generated stub for fromwire_u64 */
+u64 fromwire_u64(const u8 **cursor UNNEEDED, size_t *max UNNEEDED)
+{ fprintf(stderr, "fromwire_u64 called!\n"); abort(); }
+/* Generated stub for fromwire_u8 */
+u8 fromwire_u8(const u8 **cursor UNNEEDED, size_t *max UNNEEDED)
+{ fprintf(stderr, "fromwire_u8 called!\n"); abort(); }
+/* Generated stub for fromwire_u8_array */
+void fromwire_u8_array(const u8 **cursor UNNEEDED, size_t *max UNNEEDED, u8 *arr UNNEEDED, size_t num UNNEEDED)
+{ fprintf(stderr, "fromwire_u8_array called!\n"); abort(); }
+/* Generated stub for json_next */
+const jsmntok_t *json_next(const jsmntok_t *tok UNNEEDED)
+{ fprintf(stderr, "json_next called!\n"); abort(); }
+/* Generated stub for json_to_bool */
+bool json_to_bool(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED, bool *b UNNEEDED)
+{ fprintf(stderr, "json_to_bool called!\n"); abort(); }
+/* Generated stub for json_tok_full */
+const char *json_tok_full(const char *buffer UNNEEDED, const jsmntok_t *t UNNEEDED)
+{ fprintf(stderr, "json_tok_full called!\n"); abort(); }
+/* Generated stub for json_tok_full_len */
+int json_tok_full_len(const jsmntok_t *t UNNEEDED)
+{ fprintf(stderr, "json_tok_full_len called!\n"); abort(); }
+/* Generated stub for towire */
+void towire(u8 **pptr UNNEEDED, const void *data UNNEEDED, size_t len UNNEEDED)
+{ fprintf(stderr, "towire called!\n"); abort(); }
+/* Generated stub for towire_bool */
+void towire_bool(u8 **pptr UNNEEDED, bool v UNNEEDED)
+{ fprintf(stderr, "towire_bool called!\n"); abort(); }
+/* Generated stub for towire_secp256k1_ecdsa_signature */
+void towire_secp256k1_ecdsa_signature(u8 **pptr UNNEEDED,
+			      const secp256k1_ecdsa_signature *signature UNNEEDED)
+{ fprintf(stderr, "towire_secp256k1_ecdsa_signature called!\n"); abort(); }
+/* Generated stub for towire_sha256 */
+void towire_sha256(u8 **pptr UNNEEDED, const struct sha256 *sha256 UNNEEDED)
+{ fprintf(stderr, "towire_sha256 called!\n"); abort(); }
+/* Generated stub for towire_u32 */
+void towire_u32(u8 **pptr UNNEEDED, u32 v UNNEEDED)
+{ fprintf(stderr, "towire_u32 called!\n"); abort(); }
+/* Generated stub for towire_u64 */
+void towire_u64(u8 **pptr UNNEEDED, u64 v UNNEEDED)
+{ fprintf(stderr, "towire_u64 called!\n"); abort(); }
+/* Generated stub for towire_u8 */
+void towire_u8(u8 **pptr UNNEEDED, u8 v UNNEEDED)
+{ fprintf(stderr, "towire_u8 called!\n"); abort(); }
+/* Generated stub for towire_u8_array */
+void towire_u8_array(u8 **pptr UNNEEDED, const u8 *arr UNNEEDED, size_t num UNNEEDED)
+{ fprintf(stderr, "towire_u8_array called!\n"); abort(); }
+/* AUTOGENERATED MOCKS END */
+
+/* How things were emitted before: format into a temporary, then let
+ * json_out_addstr() scan and copy it. */
+static void old_json_add_hex(struct json_stream *js, const char *fieldname,
+			     const void *data, size_t len)
+{
+	size_t hexlen = hex_str_size(len);
+	char str[hexlen];
+
+	if (!hex_encode(data, len, str, hexlen))
+		abort();
+	if (json_filter_ok(js->filter, fieldname))
+		json_out_addstr(js->jout, fieldname, str);
+}
+
+static void old_json_add_txid(struct json_stream *js, const char *fieldname,
+			      const struct bitcoin_txid *txid)
+{
+	char hex[hex_str_size(sizeof(*txid))];
+
+	bitcoin_txid_to_hex(txid, hex, sizeof(hex));
+	if (json_filter_ok(js->filter, fieldname))
+		json_out_addstr(js->jout, fieldname, hex);
+}
+
+static void old_json_add_string(struct json_stream *js, const char *fieldname,
+				const char *str)
+{
+	if (json_filter_ok(js->filter, fieldname))
+		json_out_addstr(js->jout, fieldname, str);
+}
+
+static void old_json_add_stringn(struct json_stream *js, const char *fieldname,
+				 const char *str, size_t len)
+{
+	json_add_str_fmt(js, fieldname, "%.*s", (int)len, str);
+}
+
+static const char *contents(struct json_stream *js)
+{
+	size_t len;
+	const char *p = json_out_contents(js->jout, &len);
+	return tal_strndup(tmpctx, p, len);
+}
+
+static void test_same_output(void)
+{
+	const char special[] = { '"', '\\', '\n', '\t', 1, 0x1F, 127 };
+	struct bitcoin_txid txid;
+	u8 data[100];
+
+	for (size_t i = 0; i < sizeof(data); i++)
+		data[i] = i * 37;
+	memcpy(&txid, data, sizeof(txid));
+
+	for (size_t len = 0; len <= sizeof(data); len++) {
+		struct json_stream *js1 = new_json_stream(tmpctx, NULL, NULL);
+		struct json_stream *js2 = new_json_stream(tmpctx, NULL, NULL);
+
+		json_object_start(js1, NULL);
+		json_object_start(js2, NULL);
+		json_add_hex(js1, "hex", data, len);
+		old_json_add_hex(js2, "hex", data, len);
+		json_add_txid(js1, "txid", &txid);
+		old_json_add_txid(js2, "txid", &txid);
+		json_object_end(js1);
+		json_object_end(js2);
+		assert(streq(contents(js1), contents(js2)));
+	}
+
+	/* Every special char, at every offset (word-at-a-time check!) */
+	for (size_t s = 0; s < ARRAY_SIZE(special); s++) {
+		for (size_t len = 1; len < 40; len++) {
+			for (size_t off = 0; off < len; off++) {
+				struct json_stream *js1, *js2;
+				char *str = tal_arr(tmpctx, char, len + 1);
+
+				memset(str, 'a' + off % 26, len);
+				str[off] = special[s];
+				str[len] = '\0';
+
+				js1 = new_json_stream(tmpctx, NULL, NULL);
+				js2 = new_json_stream(tmpctx, NULL, NULL);
+				json_array_start(js1, NULL);
+				json_array_start(js2, NULL);
+				json_add_string(js1, NULL, str);
+				old_json_add_string(js2, NULL, str);
+				json_add_stringn(js1, NULL, str, len);
+				old_json_add_stringn(js2, NULL, str, len);
+				/* Partial string, stopping before special */
+				json_add_stringn(js1, NULL, str, off);
+				old_json_add_stringn(js2, NULL, str, off);
+				json_array_end(js1);
+				json_array_end(js2);
+				assert(streq(contents(js1), contents(js2)));
+				assert(strstr(contents(js1), "\\"));
+			}
+		}
+	}
+
+	/* Non-ASCII bytes don't need escaping */
+	assert(!str_escape_needed("\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9", 10));
+	assert(!str_escape_needed("0123456789abcdef~~~~~~~~", 24));
+}
+
+/* Roughly a listtransactions entry: a ~250 byte tx, two in, two out */
+static void add_tx(struct json_stream *js, bool old,
+		   const struct bitcoin_txid *txid, const u8 *rawtx)
+{
+	json_object_start(js, NULL);
+	if (old) {
+		old_json_add_txid(js, "hash", txid);
+		old_json_add_hex(js, "rawtx", rawtx, tal_bytelen(rawtx));
+	} else {
+		json_add_txid(js, "hash", txid);
+		json_add_hex_talarr(js, "rawtx", rawtx);
+	}
+	json_add_u32(js, "blockheight", 800000);
+	json_add_u32(js, "txindex", 7);
+	json_add_u32(js, "locktime", 0);
+	json_add_u32(js, "version", 2);
+	json_array_start(js, "inputs");
+	for (size_t i = 0; i < 2; i++) {
+		json_object_start(js, NULL);
+		if (old)
+			old_json_add_txid(js, "txid", txid);
+		else
+			json_add_txid(js, "txid", txid);
+		json_add_u32(js, "index", i);
+		json_add_u32(js, "sequence", 0xFFFFFFFD);
+		json_object_end(js);
+	}
+	json_array_end(js);
+	json_array_start(js, "outputs");
+	for (size_t i = 0; i < 2; i++) {
+		json_object_start(js, NULL);
+		json_add_u32(js, "index", i);
+		json_add_u64(js, "amount_msat", 100000000);
+		if (old)
+			old_json_add_hex(js, "scriptPubKey", rawtx, 34);
+		else
+			json_add_hex(js, "scriptPubKey", rawtx, 34);
+		json_object_end(js);
+	}
+	json_array_end(js);
+	json_object_end(js);
+}
+
+/* Roughly a listinvoices entry */
+static void add_invoice(struct json_stream *js, bool old,
+			const char *label, const char *bolt11,
+			const struct sha256 *hash)
+{
+	json_object_start(js, NULL);
+	if (old) {
+		old_json_add_string(js, "label", label);
+		old_json_add_string(js, "bolt11", bolt11);
+		old_json_add_hex(js, "payment_hash", hash, sizeof(*hash));
+		old_json_add_string(js, "status", "paid");
+		old_json_add_stringn(js, "description", bolt11, 40);
+		old_json_add_hex(js, "payment_preimage", hash, sizeof(*hash));
+	} else {
+		json_add_string(js, "label", label);
+		json_add_string(js, "bolt11", bolt11);
+		json_add_sha256(js, "payment_hash", hash);
+		json_add_string(js, "status", "paid");
+		json_add_stringn(js, "description", bolt11, 40);
+		json_add_hex(js, "payment_preimage", hash, sizeof(*hash));
+	}
+	json_add_u64(js, "amount_msat", 100000);
+	json_add_u64(js, "expires_at", 1700000000);
+	json_add_u64(js, "pay_index", 1);
+	json_object_end(js);
+}
+
+static const char *gen_listtransactions(size_t num, bool old)
+{
+	struct json_stream *js = new_json_stream(tmpctx, NULL, NULL);
+	struct bitcoin_txid txid;
+	u8 *rawtx = tal_arr(tmpctx, u8, 250);
+
+	memset(&txid, 0x11, sizeof(txid));
+	for (size_t i = 0; i < tal_count(rawtx); i++)
+		rawtx[i] = i;
+
+	json_object_start(js, NULL);
+	json_array_start(js, "transactions");
+	for (size_t i = 0; i < num; i++)
+		add_tx(js, old, &txid, rawtx);
+	json_array_end(js);
+	json_object_end(js);
+	return contents(js);
+}
+
+static const char *gen_listinvoices(size_t num, bool old)
+{
+	struct json_stream *js = new_json_stream(tmpctx, NULL, NULL);
+	struct sha256 hash;
+	char *bolt11 = tal_strdup(tmpctx, "lnbcrt1");
+
+	while (strlen(bolt11) < 600)
+		tal_append_fmt(&bolt11, "qpzry9x8gf2tvdw0s3jn54khce6mua7l");
+	memset(&hash, 0x22, sizeof(hash));
+
+	json_object_start(js, NULL);
+	json_array_start(js, "invoices");
+	for (size_t i = 0; i < num; i++)
+		add_invoice(js, old, "some-label-for-invoice", bolt11, &hash);
+	json_array_end(js);
+	json_object_end(js);
+	return contents(js);
+}
+
+int main(int argc, char *argv[])
+{
+	common_setup(argv[0]);
+
+	test_same_output();
+
+	assert(streq(gen_listtransactions(10, true),
+		     gen_listtransactions(10, false)));
+	assert(streq(gen_listinvoices(10, true),
+		     gen_listinvoices(10, false)));
+
+	common_shutdown();
+}
@@ -280,5 +280,53 @@ int main(int argc, char *argv[])
 
 	str = json_out_contents(js->jout, &len);
 	assert(strncmp(str, "{\"result\":\"resultstr\"", len) == 0);
+
+	/* Asking what the filter wants, before generating it. */
+	js = new_json_stream(tmpctx, NULL, NULL);
+	/* No filter: everything. */
+	assert(json_stream_wants(js, "anything"));
+	assert(json_stream_wants_in_array(js, "anything"));
+
+	filter = json_filter_new(js);
+	subf = json_filter_subobj(filter, "result", strlen("result"));
+	json_filter_subobj(subf, "wholearr", strlen("wholearr"));
+	subf = json_filter_subobj(subf, "messages", strlen("messages"));
+	subf = json_filter_subarr(subf);
+	json_filter_subobj(subf, "string", strlen("string"));
+	json_object_start(js, NULL);
+	json_stream_attach_filter(js, filter);
+
+	assert(json_stream_wants(js, "result"));
+	assert(!json_stream_wants(js, "ignored"));
+	json_object_start(js, "result");
+	assert(json_stream_wants(js, "messages"));
+	assert(!json_stream_wants(js, "ignored"));
+	json_array_start(js, "messages");
+	assert(json_stream_wants_in_array(js, "string"));
+	assert(!json_stream_wants_in_array(js, "ignored"));
+	json_object_start(js, NULL);
+	assert(json_stream_wants(js, "string"));
+	assert(!json_stream_wants(js, "ignored"));
+	json_object_end(js);
+	json_array_end(js);
+
+	/* A whole array */
+	json_array_start(js, "wholearr");
+	assert(json_stream_wants_in_array(js, "anything"));
+	json_object_start(js, NULL);
+	assert(json_stream_wants(js, "anything"));
+	json_object_end(js);
+	json_array_end(js);
+
+	/* An array which isn't wanted at all */
+	json_array_start(js, "ignored");
+	assert(!json_stream_wants_in_array(js, "string"));
+	json_object_start(js, NULL);
+	assert(!json_stream_wants(js, "string"));
+	json_object_end(js);
+	json_array_end(js);
+	json_object_end(js);
+	assert(!json_stream_detach_filter(tmpctx, js));
+
 	common_shutdown();
 }
@@ -0,0 +1,115 @@
+#include "config.h"
+#include "../status.c"
+#include "../status_levels.c"
+#include <ccan/err/err.h>
+#include <common/setup.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <unistd.h>
+
+/* AUTOGENERATED MOCKS START */
+/* Generated stub for daemon_conn_queue_length */
+size_t daemon_conn_queue_length(const struct daemon_conn *dc UNNEEDED)
+{ fprintf(stderr, "daemon_conn_queue_length called!\n"); abort(); }
+/* Generated stub for daemon_conn_send */
+void daemon_conn_send(struct daemon_conn *dc UNNEEDED, const u8 *msg UNNEEDED)
+{ fprintf(stderr, "daemon_conn_send called!\n"); abort(); }
+/* Generated stub for daemon_conn_sync_flush */
+bool daemon_conn_sync_flush(struct daemon_conn *dc UNNEEDED)
+{ fprintf(stderr, "daemon_conn_sync_flush called!\n"); abort(); }
+/* Generated stub for send_backtrace */
+void send_backtrace(const char *why UNNEEDED)
+{ fprintf(stderr, "send_backtrace called!\n"); abort(); }
+/* Generated stub for version */
+const char *version(void)
+{ fprintf(stderr, "version called!\n"); abort(); }
+/* AUTOGENERATED MOCKS END */
+
+bool is_msg_for_gossipd(const u8 *cursor UNNEEDED)
+{
+	return false;
+}
+
+const char *peer_wire_name(int e UNNEEDED)
+{
+	return "WIRE_COMMITMENT_SIGNED";
+}
+
+/* The status traffic channeld generates for one HTLC, added and
+ * fulfilled: mostly debug, with the peer messages summarized. */
+static void one_htlc(u64 id, const u8 *peer_msg,
+		     const char *txid, const char *wscript, const char *key)
+{
+	struct node_id *peer = NULL;
+
+	for (size_t i = 0; i < 4; i++) {
+		status_peer_io(LOG_IO_IN, peer, peer_msg);
+		status_peer_io(LOG_IO_OUT, peer, peer_msg);
+	}
+	status_debug("Adding HTLC %"PRIu64" amount=%"PRIu64"msat cltv=%u gave %s",
+		     id, id * 1000, 800000, "CHANNEL_ERR_ADD_OK");
+	for (size_t i = 0; i < 2; i++) {
+		status_debug("Telling master we're about to commit...");
+		status_debug("Creating commit_sig signature %"PRIu64" %s for tx %s wscript %s key %s",
+			     id, "3045022100", txid, wscript, key);
+		status_debug("Creating HTLC signature %s for tx %s wscript %s key %s",
+			     "3045022100", txid, wscript, key);
+		status_debug("Sending commit_sig with %zu htlc sigs", (size_t)1);
+		status_debug("Received commit_sig with %zu htlc sigs", (size_t)1);
+		status_debug("revoke_and_ack %s: remote_per_commit = %s, old_remote_per_commit = %s",
+			     "LOCAL", key, key);
+		status_debug("HTLC %"PRIu64"[%s] => %s",
+			     id, "REMOTE", "RCVD_ADD_ACK_REVOCATION");
+	}
+}
+
+static off_t bytes_sent(enum log_level level, bool io, const u8 *peer_msg)
+{
+	off_t before = lseek(status_fd, 0, SEEK_CUR);
+	const char *hex = tal_hex(tmpctx, peer_msg);
+
+	status_log_level = level;
+	logging_io = io;
+	one_htlc(1, peer_msg, hex, hex, hex);
+	logging_io = false;
+	return lseek(status_fd, 0, SEEK_CUR) - before;
+}
+
+int main(int argc, char *argv[])
+{
+	u8 *peer_msg = tal_arr(NULL, u8, 0);
+	FILE *f;
+	off_t before;
+
+	common_setup(argv[0]);
+
+	towire_u16(&peer_msg, WIRE_COMMITMENT_SIGNED);
+	towire_pad(&peer_msg, 32 + 64 + 2);
+
+	/* Count what we'd send to lightningd. */
+	f = tmpfile();
+	if (!f)
+		err(1, "tmpfile");
+	status_fd = fileno(f);
+
+	assert(bytes_sent(LOG_DBG, false, peer_msg) > 0);
+	assert(bytes_sent(LOG_INFORM, false, peer_msg) == 0);
+	assert(bytes_sent(LOG_UNUSUAL, false, peer_msg) == 0);
+	/* IO logging (e.g. SIGUSR1) means we send everything. */
+	assert(bytes_sent(LOG_INFORM, true, peer_msg)
+	       > bytes_sent(LOG_DBG, false, peer_msg));
+
+	/* Levels at or above the threshold still go out. */
+	status_log_level = LOG_UNUSUAL;
+	before = lseek(status_fd, 0, SEEK_CUR);
+	status_info("Not sent");
+	assert(lseek(status_fd, 0, SEEK_CUR) == before);
+	status_unusual("Sent");
+	status_broken("Sent");
+	assert(lseek(status_fd, 0, SEEK_CUR) > before);
+	fclose(f);
+
+	tal_free(peer_msg);
+	common_shutdown();
+	return 0;
+}
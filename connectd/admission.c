@@ -0,0 +1,245 @@
+#include "config.h"
+#include <ccan/crypto/siphash24/siphash24.h>
+#include <ccan/htable/htable_type.h>
+#include <ccan/mem/mem.h>
+#include <common/memleak.h>
+#include <common/pseudorand.h>
+#include <common/wireaddr.h>
+#include <connectd/admission.h>
+
+/* An address, or the prefix of one (a subnet) */
+struct addr_key {
+	/* ADDR_TYPE_IPV4 or ADDR_TYPE_IPV6 */
+	u8 type;
+	/* How many bytes of addr matter (the rest are zero) */
+	u8 len;
+	u8 addr[16];
+};
+
+struct addr_bucket {
+	struct addr_key key;
+	/* Connections we'll allow right now. */
+	double tokens;
+	struct timemono last;
+	/* A peer we have a channel with: never forgotten, never limited. */
+	bool known;
+};
+
+static const struct addr_key *addr_bucket_keyof(const struct addr_bucket *b)
+{
+	return &b->key;
+}
+
+static size_t addr_key_hash(const struct addr_key *key)
+{
+	/* Attackers choose their addresses, so use siphash. */
+	return siphash24(siphash_seed(), key, sizeof(*key));
+}
+
+static bool addr_bucket_eq(const struct addr_bucket *b,
+			   const struct addr_key *key)
+{
+	return memeq(&b->key, sizeof(b->key), key, sizeof(*key));
+}
+
+HTABLE_DEFINE_TYPE(struct addr_bucket,
+		   addr_bucket_keyof,
+		   addr_key_hash,
+		   addr_bucket_eq,
+		   addr_bucket_map);
+
+struct admission {
+	struct addr_bucket_map *buckets;
+	/* Handshakes in progress */
+	size_t in_progress;
+	/* So we don't try to prune on every connection */
+	struct timemono last_prune;
+};
+
+struct admission_slot {
+	struct admission *adm;
+};
+
+#if DEVELOPER
+static void memleak_help_admission(struct htable *memtable,
+				   struct addr_bucket_map *buckets)
+{
+	memleak_scan_htable(memtable, &buckets->raw);
+}
+#endif /* DEVELOPER */
+
+struct admission *new_admission(const tal_t *ctx)
+{
+	struct admission *adm = tal(ctx, struct admission);
+
+	adm->buckets = tal(adm, struct addr_bucket_map);
+	addr_bucket_map_init(adm->buckets);
+	memleak_add_helper(adm->buckets, memleak_help_admission);
+	adm->in_progress = 0;
+	adm->last_prune = time_mono();
+	return adm;
+}
+
+/* Returns false for things we don't rate-limit by address: local sockets,
+ * and localhost (which is where Tor connections come from!). */
+static bool addr_keys(const struct wireaddr_internal *addr,
+		      struct addr_key *host, struct addr_key *subnet)
+{
+	const struct wireaddr *wa;
+	static const u8 v6_loopback[16] = { [15] = 1 };
+
+	if (addr->itype != ADDR_INTERNAL_WIREADDR)
+		return false;
+	wa = &addr->u.wireaddr.wireaddr;
+
+	memset(host, 0, sizeof(*host));
+	memset(subnet, 0, sizeof(*subnet));
+	switch (wa->type) {
+	case ADDR_TYPE_IPV4:
+		if (wa->addr[0] == 127)
+			return false;
+		/* Each IPv4 address, and /24 */
+		host->len = 4;
+		subnet->len = 3;
+		break;
+	case ADDR_TYPE_IPV6:
+		if (memeq(wa->addr, 16, v6_loopback, sizeof(v6_loopback)))
+			return false;
+		/* Hosts usually get a /64, and sites a /48 */
+		host->len = 8;
+		subnet->len = 6;
+		break;
+	default:
+		return false;
+	}
+
+	host->type = subnet->type = wa->type;
+	memcpy(host->addr, wa->addr, host->len);
+	memcpy(subnet->addr, wa->addr, subnet->len);
+	return true;
+}
+
+static bool is_subnet(const struct addr_key *key)
+{
+	return key->len == 3 || key->len == 6;
+}
+
+static double bucket_burst(const struct addr_bucket *b)
+{
+	return is_subnet(&b->key) ? ADMISSION_SUBNET_BURST : ADMISSION_ADDR_BURST;
+}
+
+static void refill(struct addr_bucket *b, struct timemono now)
+{
+	double per_sec = is_subnet(&b->key)
+		? ADMISSION_SUBNET_PER_SEC : ADMISSION_ADDR_PER_SEC;
+
+	b->tokens += time_to_usec(timemono_between(now, b->last))
+		* per_sec / 1000000.0;
+	if (b->tokens > bucket_burst(b))
+		b->tokens = bucket_burst(b);
+	b->last = now;
+}
+
+/* Full buckets are the same as ones we've never seen, so forget them. */
+static void prune_buckets(struct admission *adm, struct timemono now)
+{
+	struct addr_bucket *b;
+	struct addr_bucket_map_iter it;
+
+	if (time_less(timemono_between(now, adm->last_prune),
+		      time_from_sec(1)))
+		return;
+	adm->last_prune = now;
+
+	for (b = addr_bucket_map_first(adm->buckets, &it);
+	     b;
+	     b = addr_bucket_map_next(adm->buckets, &it)) {
+		if (b->known)
+			continue;
+		refill(b, now);
+		if (b->tokens < bucket_burst(b))
+			continue;
+		addr_bucket_map_delval(adm->buckets, &it);
+		tal_free(b);
+	}
+}
+
+static struct addr_bucket *get_bucket(struct admission *adm,
+				      const struct addr_key *key,
+				      struct timemono now)
+{
+	struct addr_bucket *b = addr_bucket_map_get(adm->buckets, key);
+
+	if (!b) {
+		b = tal(adm->buckets, struct addr_bucket);
+		b->key = *key;
+		b->tokens = bucket_burst(b);
+		b->last = now;
+		b->known = false;
+		addr_bucket_map_add(adm->buckets, b);
+	}
+	return b;
+}
+
+void admission_add_known(struct admission *adm,
+			 const struct wireaddr_internal *addr)
+{
+	struct addr_key host, subnet;
+
+	if (!addr_keys(addr, &host, &subnet))
+		return;
+
+	get_bucket(adm, &host, time_mono())->known = true;
+}
+
+static void destroy_admission_slot(struct admission_slot *slot)
+{
+	slot->adm->in_progress--;
+}
+
+struct admission_slot *admission_start(const tal_t *ctx,
+				       struct admission *adm,
+				       const struct wireaddr_internal *addr,
+				       struct timemono now)
+{
+	struct admission_slot *slot;
+	struct addr_key host, subnet;
+	struct addr_bucket *hb = NULL;
+	bool known = false;
+
+	if (addr_bucket_map_count(adm->buckets) >= ADMISSION_MAX_BUCKETS)
+		prune_buckets(adm, now);
+
+	if (addr_keys(addr, &host, &subnet)) {
+		hb = get_bucket(adm, &host, now);
+		known = hb->known;
+	}
+
+	if (adm->in_progress >= ADMISSION_MAX_HANDSHAKES
+	    + (known ? ADMISSION_RESERVED_HANDSHAKES : 0))
+		return NULL;
+
+	if (hb && !known) {
+		struct addr_bucket *sb = get_bucket(adm, &subnet, now);
+
+		refill(hb, now);
+		refill(sb, now);
+		/* Don't drain the subnet for an address over its limit */
+		if (hb->tokens < 1 || sb->tokens < 1)
+			return NULL;
+		hb->tokens--;
+		sb->tokens--;
+	}
+
+	slot = tal(ctx, struct admission_slot);
+	slot->adm = adm;
+	adm->in_progress++;
+	tal_add_destructor(slot, destroy_admission_slot);
+	return slot;
+}
+
+size_t admission_in_progress(const struct admission *adm)
+{
+	return adm->in_progress;
+}
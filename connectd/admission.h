@@ -0,0 +1,48 @@
+/* This decides whether we start a handshake with an incoming connection:
+ * each handshake costs us an ECDH in hsmd, so we limit how many are in
+ * flight, and how fast any one address (or subnet) can ask for them. */
+#ifndef LIGHTNING_CONNECTD_ADMISSION_H
+#define LIGHTNING_CONNECTD_ADMISSION_H
+#include "config.h"
+#include <ccan/tal/tal.h>
+#include <ccan/time/time.h>
+
+struct wireaddr_internal;
+
+/* Unauthenticated handshakes we allow at once... */
+#define ADMISSION_MAX_HANDSHAKES 256
+/* ...plus these, which only known peers can use. */
+#define ADMISSION_RESERVED_HANDSHAKES 64
+
+/* Token buckets: how many connections at once, and refill rate. */
+#define ADMISSION_ADDR_BURST 8
+#define ADMISSION_ADDR_PER_SEC 1
+#define ADMISSION_SUBNET_BURST 32
+#define ADMISSION_SUBNET_PER_SEC 8
+
+/* We forget buckets which have refilled once we have this many. */
+#define ADMISSION_MAX_BUCKETS 8192
+
+struct admission;
+
+/* While you hold this, you're using a handshake slot: free it once the
+ * handshake is done (it's usually a child of the conn, so that works). */
+struct admission_slot;
+
+struct admission *new_admission(const tal_t *ctx);
+
+/* This address belongs to a peer we have a channel with: it bypasses
+ * the rate limits, and can use the reserved handshake slots. */
+void admission_add_known(struct admission *adm,
+			 const struct wireaddr_internal *addr);
+
+/* Can we start a handshake with this address?  NULL means no (hang up). */
+struct admission_slot *admission_start(const tal_t *ctx,
+				       struct admission *adm,
+				       const struct wireaddr_internal *addr,
+				       struct timemono now);
+
+/* How many handshakes are in progress? */
+size_t admission_in_progress(const struct admission *adm);
+
+#endif /* LIGHTNING_CONNECTD_ADMISSION_H */
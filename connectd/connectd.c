@@ -30,6 +30,7 @@
 #include <common/timeout.h>
 #include <common/type_to_string.h>
 #include <common/wire_error.h>
+#include <connectd/admission.h>
 #include <connectd/connectd.h>
 #include <connectd/connectd_gossipd_wiregen.h>
 #include <connectd/connectd_wiregen.h>
@@ -41,6 +42,7 @@
 #include <connectd/tor_autoservice.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <hsmd/hsmd_wiregen.h>
 #include <netdb.h>
 #include <netinet/in.h>
 #include <signal.h>
@@ -51,12 +53,14 @@
 #include <wire/wire_io.h>
 #include <wire/wire_sync.h>
 
-/*~ We are passed two file descriptors when exec'ed from `lightningd`: the
- * first is a connection to `hsmd`, which we need for the cryptographic
- * handshake, and the second is to `gossipd`: it gathers network gossip and
- * thus may know how to reach certain peers. */
+/*~ We are passed three file descriptors when exec'ed from `lightningd`: the
+ * first is a connection to `hsmd`, the second is to `gossipd`: it gathers
+ * network gossip and thus may know how to reach certain peers.  The third is
+ * another connection to `hsmd`, used only for the cryptographic handshake so
+ * we never block waiting for it (see handshake_ecdh_ below). */
 #define HSM_FD 3
 #define GOSSIPCTL_FD 4
+#define HSM_HANDSHAKE_FD 5
 
 /* Peers we're trying to reach: we iterate through addrs until we succeed
  * or fail. */
@@ -231,6 +235,7 @@ void destroy_peer(struct peer *peer)
 /*~ This is where we create a new peer. */
 static struct peer *new_peer(struct daemon *daemon,
 			     const struct node_id *id,
+			     const struct wireaddr_internal *addr,
 			     const struct crypto_state *cs,
 			     const u8 *their_features,
 			     enum is_websocket is_websocket,
@@ -241,6 +246,7 @@ static struct peer *new_peer(struct daemon *daemon,
 
 	peer->daemon = daemon;
 	peer->id = *id;
+	peer->addr = *addr;
 	peer->counter = daemon->connection_counter++;
 	peer->cs = *cs;
 	peer->subds = tal_arr(peer, struct subd *, 0);
@@ -337,7 +343,7 @@ struct io_plan *peer_connected(struct io_conn *conn,
 			      conn, find_connecting(daemon, id)->conn);
 
 	/* This contains the per-peer state info; gossipd fills in pps->gs */
-	peer = new_peer(daemon, id, cs, their_features, is_websocket, conn, &subd_fd);
+	peer = new_peer(daemon, id, addr, cs, their_features, is_websocket, conn, &subd_fd);
 	/* Only takes over conn if it succeeds. */
 	if (!peer)
 		return io_close(conn);
@@ -367,6 +373,86 @@ struct io_plan *peer_connected(struct io_conn *conn,
 	return multiplex_peer_setup(conn, peer);
 }
 
+/*~ handshake.c needs hsmd to do an ECDH for every handshake.  Doing that
+ * synchronously (as common/ecdh_hsmd.c does) means every other peer waits
+ * whenever connections queue up at hsmd, so we use a separate hsmd
+ * connection just for this.  hsmd answers in order, so we simply queue the
+ * secrets we're waiting for.  handshake.c doesn't know about the daemon, so
+ * (like common/ecdh_hsmd.c) we stash it. */
+static struct daemon *ecdh_daemon;
+
+struct pending_ecdh {
+	struct list_node list;
+	/* NULL if the connection closed while we were waiting. */
+	struct secret *ss;
+};
+
+static void destroy_ecdh_secret(struct secret *ss, struct pending_ecdh *pe)
+{
+	pe->ss = NULL;
+}
+
+struct io_plan *handshake_ecdh_(struct io_conn *conn,
+				const struct pubkey *point,
+				struct secret *ss,
+				struct io_plan *(*next)(struct io_conn *,
+							void *arg),
+				void *arg)
+{
+	struct pending_ecdh *pe = tal(ecdh_daemon, struct pending_ecdh);
+
+	pe->ss = ss;
+	tal_add_destructor2(ss, destroy_ecdh_secret, pe);
+	list_add_tail(&ecdh_daemon->pending_ecdh, &pe->list);
+	daemon_conn_send(ecdh_daemon->hsmd_handshake,
+			 take(towire_hsmd_ecdh_req(NULL, point)));
+
+	/* recv_hsmd_ecdh() wakes us. */
+	return io_wait(conn, ss, next, arg);
+}
+
+static struct io_plan *recv_hsmd_ecdh(struct io_conn *conn,
+				      const u8 *msg,
+				      struct daemon *daemon)
+{
+	struct pending_ecdh *pe;
+	struct secret ss;
+
+	if (!fromwire_hsmd_ecdh_resp(msg, &ss))
+		status_failed(STATUS_FAIL_HSM_IO, "Invalid hsmd ECDH response %s",
+			      tal_hex(tmpctx, msg));
+
+	pe = list_pop(&daemon->pending_ecdh, struct pending_ecdh, list);
+	if (!pe)
+		status_failed(STATUS_FAIL_HSM_IO, "Unexpected hsmd ECDH response");
+
+	if (pe->ss) {
+		tal_del_destructor2(pe->ss, destroy_ecdh_secret, pe);
+		*pe->ss = ss;
+		io_wake(pe->ss);
+	}
+	tal_free(pe);
+
+	return daemon_conn_read_next(conn, daemon->hsmd_handshake);
+}
+
+/*~ Every handshake costs an ECDH in hsmd, and some memory until it's done,
+ * so admission.c limits how many we start (see there for the details). */
+static struct admission_slot *admit_connection(struct daemon *daemon,
+					       struct io_conn *conn,
+					       const struct wireaddr_internal *addr)
+{
+	struct admission_slot *slot;
+
+	slot = admission_start(conn, daemon->admission, addr, time_mono());
+	if (!slot)
+		status_debug("Refusing connection from %s (%zu handshakes in progress)",
+			     type_to_string(tmpctx, struct wireaddr_internal,
+					    addr),
+			     admission_in_progress(daemon->admission));
+	return slot;
+}
+
 /*~ handshake.c's handles setting up the crypto state once we get a connection
  * in; we hand it straight to peer_exchange_initmsg() to send and receive INIT
  * and call peer_connected(). */
@@ -435,6 +521,7 @@ struct conn_in {
 	struct wireaddr_internal addr;
 	struct daemon *daemon;
 	enum is_websocket is_websocket;
+	struct admission_slot *slot;
 };
 
 /*~ Once we've got a connection in, we set it up here (whether it's via the
@@ -450,6 +537,10 @@ static struct io_plan *conn_in(struct io_conn *conn,
 			       time_from_sec(daemon->timeout_secs),
 			       conn_timeout, conn);
 
+	/* We hold the handshake slot until they've sent init: the timeout
+	 * lives exactly that long. */
+	tal_steal(timeout, conn_in_arg->slot);
+
 	/*~ The crypto handshake differs depending on whether you received or
 	 * initiated the socket connection, so there are two entry points.
 	 * Note, again, the notleak() to avoid our simplistic leak detection
@@ -472,6 +563,10 @@ static struct io_plan *connection_in(struct io_conn *conn,
 	if (!get_remote_address(conn, &conn_in_arg.addr))
 		return io_close(conn);
 
+	conn_in_arg.slot = admit_connection(daemon, conn, &conn_in_arg.addr);
+	if (!conn_in_arg.slot)
+		return io_close(conn);
+
 	conn_in_arg.daemon = daemon;
 	conn_in_arg.is_websocket = false;
 	return conn_in(conn, &conn_in_arg);
@@ -492,6 +587,11 @@ static struct io_plan *websocket_connection_in(struct io_conn *conn,
 	if (!get_remote_address(conn, &conn_in_arg.addr))
 		return io_close(conn);
 
+	/* Check before we go to the trouble of forking a helper! */
+	conn_in_arg.slot = admit_connection(daemon, conn, &conn_in_arg.addr);
+	if (!conn_in_arg.slot)
+		return io_close(conn);
+
 	status_debug("Websocket connection in from %s",
 		     type_to_string(tmpctx, struct wireaddr_internal,
 				    &conn_in_arg.addr));
@@ -1498,8 +1598,8 @@ static void connect_init(struct daemon *daemon, const u8 *msg)
 
 #if DEVELOPER
 	if (dev_disconnect) {
-		daemon->dev_disconnect_fd = 5;
-		dev_disconnect_init(5);
+		daemon->dev_disconnect_fd = 6;
+		dev_disconnect_init(6);
 	} else {
 		daemon->dev_disconnect_fd = -1;
 	}
@@ -1987,6 +2087,10 @@ static void dev_report_fds(struct daemon *daemon, const u8 *msg)
 			status_info("dev_report_fds: %i -> gossipd fd", fd);
 			continue;
 		}
+		if (fd == HSM_HANDSHAKE_FD) {
+			status_info("dev_report_fds: %i -> hsm handshake fd", fd);
+			continue;
+		}
 #if DEVELOPER
 		if (fd == daemon->dev_disconnect_fd) {
 			status_info("dev_report_fds: %i -> dev_disconnect_fd", fd);
@@ -2166,6 +2270,11 @@ static void gossipd_failed(struct daemon_conn *gossipd)
 	status_failed(STATUS_FAIL_GOSSIP_IO, "gossipd exited?");
 }
 
+static void hsmd_handshake_failed(struct daemon_conn *hsmd)
+{
+	status_failed(STATUS_FAIL_HSM_IO, "hsmd handshake connection closed?");
+}
+
 int main(int argc, char *argv[])
 {
 	setup_locale();
@@ -2183,13 +2292,16 @@ int main(int argc, char *argv[])
 	peer_htable_init(daemon->peers);
 	memleak_add_helper(daemon, memleak_daemon_cb);
 	list_head_init(&daemon->connecting);
+	list_head_init(&daemon->pending_ecdh);
+	daemon->admission = new_admission(daemon);
 	timers_init(&daemon->timers, time_mono());
 	daemon->gossip_store_fd = -1;
 	daemon->shutting_down = false;
 
-	/* stdin == control */
-	daemon->master = daemon_conn_new(daemon, STDIN_FILENO, recv_req, NULL,
-					 daemon);
+	/* stdin == control: lightningd hands us fds on this, so no reading
+	 * ahead! */
+	daemon->master = daemon_conn_new_noreadahead(daemon, STDIN_FILENO,
+						      recv_req, NULL, daemon);
 	tal_add_destructor(daemon->master, master_gone);
 
 	/* This tells the status_* subsystem to use this connection to send
@@ -2210,6 +2322,13 @@ int main(int argc, char *argv[])
 	 * status_failed on error. */
 	ecdh_hsmd_setup(HSM_FD, status_failed);
 
+	/* But handshakes use their own connection, and don't wait. */
+	ecdh_daemon = daemon;
+	daemon->hsmd_handshake = daemon_conn_new(daemon, HSM_HANDSHAKE_FD,
+						 recv_hsmd_ecdh, NULL,
+						 daemon);
+	tal_add_destructor(daemon->hsmd_handshake, hsmd_handshake_failed);
+
 	for (;;) {
 		struct timer *expired;
 		io_loop(&daemon->timers, &expired);
@@ -12,6 +12,7 @@
 #include <common/wireaddr.h>
 #include <connectd/handshake.h>
 
+struct admission;
 struct io_conn;
 struct connecting;
 struct wireaddr_internal;
@@ -51,6 +52,8 @@ struct peer {
 
 	/* The pubkey of the node */
 	struct node_id id;
+	/* Where they connected from (or where we connected to) */
+	struct wireaddr_internal addr;
 	/* Counters and keys for symmetric crypto */
 	struct crypto_state cs;
 
@@ -149,6 +152,13 @@ struct daemon {
 	/* Connection to gossip daemon. */
 	struct daemon_conn *gossipd;
 
+	/* Connection to hsmd for handshakes, and what we're waiting for */
+	struct daemon_conn *hsmd_handshake;
+	struct list_head pending_ecdh;
+
+	/* Limits on incoming handshakes. */
+	struct admission *admission;
+
 	/* Any listening sockets we have. */
 	struct io_listener **listeners;
 
@@ -6,7 +6,6 @@
 #include <ccan/io/io.h>
 #include <ccan/mem/mem.h>
 #include <common/crypto_state.h>
-#include <common/ecdh.h>
 #include <common/status.h>
 #include <common/type_to_string.h>
 #include <common/utils.h>
@@ -449,6 +448,9 @@ static struct handshake *new_handshake(const tal_t *ctx,
 	return handshake;
 }
 
+static struct io_plan *act_three_initiator2(struct io_conn *conn,
+					    struct handshake *h);
+
 static struct io_plan *act_three_initiator(struct io_conn *conn,
 					   struct handshake *h)
 {
@@ -482,7 +484,12 @@ static struct io_plan *act_three_initiator(struct io_conn *conn,
 	 *     * where `re` is the ephemeral public key of the responder
 	 */
 	h->ss = tal(h, struct secret);
-	ecdh(&h->re, h->ss);
+	return handshake_ecdh(conn, &h->re, h->ss, act_three_initiator2, h);
+}
+
+static struct io_plan *act_three_initiator2(struct io_conn *conn,
+					    struct handshake *h)
+{
 	SUPERVERBOSE("# ss=0x%s", tal_hexstr(tmpctx, h->ss, sizeof(*h->ss)));
 
 	/* BOLT #8:
@@ -871,6 +878,9 @@ static struct io_plan *act_two_responder(struct io_conn *conn,
 	return io_write(conn, &h->act2, ACT_TWO_SIZE, act_three_responder, h);
 }
 
+static struct io_plan *act_one_responder3(struct io_conn *conn,
+					  struct handshake *h);
+
 static struct io_plan *act_one_responder2(struct io_conn *conn,
 					 struct handshake *h)
 {
@@ -911,7 +921,12 @@ static struct io_plan *act_one_responder2(struct io_conn *conn,
 	 *      the initiator's ephemeral public key.
 	 */
 	h->ss = tal(h, struct secret);
-	ecdh(&h->re, h->ss);
+	return handshake_ecdh(conn, &h->re, h->ss, act_one_responder3, h);
+}
+
+static struct io_plan *act_one_responder3(struct io_conn *conn,
+					  struct handshake *h)
+{
 	SUPERVERBOSE("# ss=0x%s", tal_hexstr(tmpctx, h->ss, sizeof(*h->ss)));
 
 	/* BOLT #8:
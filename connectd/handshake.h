@@ -7,6 +7,7 @@ struct io_conn;
 struct wireaddr_internal;
 struct pubkey;
 struct oneshot;
+struct secret;
 
 /*~ Sometimes it's nice to have an explicit enum instead of a bool to make
  * arguments clearer: it kind of hacks around C's lack of naming formal
@@ -71,4 +72,20 @@ struct io_plan *responder_handshake_(struct io_conn *conn,
 							   enum is_websocket,
 							   void *cbarg),
 				     void *cbarg);
+/*~ The handshake needs ECDH with our node key, which only hsmd has.  That's
+ * a round trip, and we don't want every other peer to wait while we make it,
+ * so connectd supplies this: it fills in *ss then calls next(). */
+#define handshake_ecdh(conn, point, ss, next, arg)			\
+	handshake_ecdh_((conn), (point), (ss),				\
+			typesafe_cb_preargs(struct io_plan *, void *,	\
+					    (next), (arg),		\
+					    struct io_conn *),		\
+			(arg))
+
+struct io_plan *handshake_ecdh_(struct io_conn *conn,
+				const struct pubkey *point,
+				struct secret *ss,
+				struct io_plan *(*next)(struct io_conn *,
+							void *arg),
+				void *arg);
 #endif /* LIGHTNING_CONNECTD_HANDSHAKE_H */
@@ -18,6 +18,7 @@
 #include <common/type_to_string.h>
 #include <common/utils.h>
 #include <common/wire_error.h>
+#include <connectd/admission.h>
 #include <connectd/connectd.h>
 #include <connectd/connectd_gossipd_wiregen.h>
 #include <connectd/connectd_wiregen.h>
@@ -55,6 +56,8 @@ struct subd {
 
 	/* Input buffer */
 	u8 *in;
+	/* Messages read ahead from subd (it never sends us fds) */
+	struct wire_rbuf *rbuf;
 
 	/* Output buffer */
 	struct msg_queue *outq;
@@ -996,22 +999,22 @@ static struct io_plan *read_from_subd_done(struct io_conn *subd_conn,
 static struct io_plan *read_from_subd(struct io_conn *subd_conn,
 				      struct subd *subd)
 {
-	return io_read_wire(subd_conn, subd, &subd->in,
-			    read_from_subd_done, subd);
+	return io_read_wire_buffered(subd_conn, subd, &subd->in, subd->rbuf,
+				     read_from_subd_done, subd);
 }
 
 /* These four function handle peer->subd */
 static struct io_plan *write_to_subd(struct io_conn *subd_conn,
 				     struct subd *subd)
 {
-	const u8 *msg;
+	const u8 **msgs;
 	assert(subd->conn == subd_conn);
 
 	/* Pop tail of send queue */
-	msg = msg_dequeue(subd->outq);
+	msgs = msg_dequeue_many(subd, subd->outq, WIRE_WRITE_BATCH);
 
 	/* Nothing to send? */
-	if (!msg) {
+	if (!msgs) {
 		/* If peer is closed, close this. */
 		if (!subd->peer->to_peer)
 			return io_close(subd_conn);
@@ -1024,7 +1027,7 @@ static struct io_plan *write_to_subd(struct io_conn *subd_conn,
 				      write_to_subd, subd);
 	}
 
-	return io_write_wire(subd_conn, take(msg), write_to_subd, subd);
+	return io_write_wires(subd_conn, take(msgs), write_to_subd, subd);
 }
 
 static void destroy_subd(struct subd *subd)
@@ -1053,6 +1056,7 @@ static struct subd *new_subd(struct peer *peer,
 	subd = tal(peer, struct subd);
 	subd->peer = peer;
 	subd->outq = msg_queue_new(subd, false);
+	subd->rbuf = wire_rbuf_new(subd);
 	subd->channel_id = *channel_id;
 	subd->temporary_channel_id = NULL;
 	subd->opener_revocation_basepoint = NULL;
@@ -1256,6 +1260,10 @@ void peer_connect_subd(struct daemon *daemon, const u8 *msg, int fd)
 		return;
 	}
 
+	/* lightningd wants to talk to them (usually, they have a channel
+	 * with us): let them back in even when we're busy. */
+	admission_add_known(daemon->admission, &peer->addr);
+
 	/* If peer said something, we created this and queued msg. */
 	subd = find_subd(peer, &channel_id);
 	if (!subd)
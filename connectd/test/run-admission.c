@@ -0,0 +1,354 @@
+#include "config.h"
+#include "../admission.c"
+#include <assert.h>
+#include <ccan/asort/asort.h>
+#include <common/setup.h>
+#include <common/utils.h>
+#include <stdio.h>
+
+/* AUTOGENERATED MOCKS START */
+/* Generated stub for memleak_add_helper_ */
+void memleak_add_helper_(const tal_t *p UNNEEDED, void (*cb)(struct htable *memtable UNNEEDED,
+						    const tal_t *)){ }
+/* Generated stub for memleak_scan_htable */
+void memleak_scan_htable(struct htable *memtable UNNEEDED, const struct htable *ht UNNEEDED)
+{ fprintf(stderr, "memleak_scan_htable called!\n"); abort(); }
+/* AUTOGENERATED MOCKS END */
+
+static struct timemono base;
+
+static struct timemono at_usec(u64 usec)
+{
+	return timemono_add(base, time_from_usec(usec));
+}
+
+static struct wireaddr_internal ipv4(u8 a, u8 b, u8 c, u8 d)
+{
+	struct wireaddr_internal addr;
+
+	memset(&addr, 0, sizeof(addr));
+	addr.itype = ADDR_INTERNAL_WIREADDR;
+	addr.u.wireaddr.wireaddr.type = ADDR_TYPE_IPV4;
+	addr.u.wireaddr.wireaddr.addrlen = 4;
+	addr.u.wireaddr.wireaddr.addr[0] = a;
+	addr.u.wireaddr.wireaddr.addr[1] = b;
+	addr.u.wireaddr.wireaddr.addr[2] = c;
+	addr.u.wireaddr.wireaddr.addr[3] = d;
+	addr.u.wireaddr.wireaddr.port = 9735;
+	return addr;
+}
+
+/* Slots are allocated off adm, so they're freed before it is. */
+static void check_limits(void)
+{
+	struct admission *adm = new_admission(tmpctx);
+	struct wireaddr_internal addr, known;
+	struct admission_slot **slots;
+
+	/* One address gets its burst, then one per second. */
+	addr = ipv4(1, 2, 3, 4);
+	for (size_t i = 0; i < ADMISSION_ADDR_BURST; i++)
+		assert(admission_start(adm, adm, &addr, at_usec(0)));
+	assert(!admission_start(adm, adm, &addr, at_usec(0)));
+	assert(!admission_start(adm, adm, &addr, at_usec(999999)));
+	assert(admission_start(adm, adm, &addr, at_usec(1000000)));
+	assert(!admission_start(adm, adm, &addr, at_usec(1000000)));
+	tal_free(adm);
+
+	/* Addresses in the same /24 share a bucket. */
+	adm = new_admission(tmpctx);
+	for (size_t i = 0; i < ADMISSION_SUBNET_BURST; i++) {
+		addr = ipv4(1, 2, 3, 1 + i / ADMISSION_ADDR_BURST);
+		assert(admission_start(adm, adm, &addr, at_usec(0)));
+	}
+	addr = ipv4(1, 2, 3, 100);
+	assert(!admission_start(adm, adm, &addr, at_usec(0)));
+	addr = ipv4(1, 2, 4, 100);
+	assert(admission_start(adm, adm, &addr, at_usec(0)));
+
+	/* An address over its limit doesn't use up its subnet's. */
+	for (size_t i = 0; i < ADMISSION_SUBNET_BURST * 2; i++)
+		admission_start(adm, adm, &addr, at_usec(0));
+	for (size_t i = 0;
+	     i < ADMISSION_SUBNET_BURST - ADMISSION_ADDR_BURST;
+	     i++) {
+		addr = ipv4(1, 2, 4, 101 + i / ADMISSION_ADDR_BURST);
+		assert(admission_start(adm, adm, &addr, at_usec(0)));
+	}
+
+	/* Localhost (e.g. Tor) and local sockets are only limited by slots. */
+	addr = ipv4(127, 0, 0, 1);
+	for (size_t i = 0; i < ADMISSION_SUBNET_BURST * 2; i++)
+		assert(admission_start(adm, adm, &addr, at_usec(0)));
+	addr.itype = ADDR_INTERNAL_SOCKNAME;
+	assert(admission_start(adm, adm, &addr, at_usec(0)));
+	tal_free(adm);
+
+	/* Slots are limited: known peers get some more. */
+	adm = new_admission(tmpctx);
+	known = ipv4(5, 5, 5, 5);
+	admission_add_known(adm, &known);
+
+	slots = tal_arr(tmpctx, struct admission_slot *, 0);
+	for (size_t i = 0; i < ADMISSION_MAX_HANDSHAKES; i++) {
+		addr = ipv4(10, i >> 8, i & 0xFF, 1);
+		tal_arr_expand(&slots,
+			       admission_start(adm, adm, &addr, at_usec(0)));
+		assert(slots[i]);
+	}
+	assert(admission_in_progress(adm) == ADMISSION_MAX_HANDSHAKES);
+	addr = ipv4(11, 0, 0, 1);
+	assert(!admission_start(adm, adm, &addr, at_usec(0)));
+
+	/* Known peers aren't rate limited either. */
+	for (size_t i = 0; i < ADMISSION_RESERVED_HANDSHAKES; i++)
+		assert(admission_start(adm, adm, &known, at_usec(0)));
+	assert(!admission_start(adm, adm, &known, at_usec(0)));
+
+	/* Finishing a handshake frees a slot. */
+	tal_free(slots[0]);
+	assert(admission_start(adm, adm, &known, at_usec(0)));
+
+	/* Others wait until we're back under the normal limit. */
+	for (size_t i = 1; i <= ADMISSION_RESERVED_HANDSHAKES; i++)
+		tal_free(slots[i]);
+	assert(!admission_start(adm, adm, &addr, at_usec(0)));
+	tal_free(slots[ADMISSION_RESERVED_HANDSHAKES + 1]);
+	assert(admission_start(adm, adm, &addr, at_usec(0)));
+	tal_free(adm);
+}
+
+static void check_prune(void)
+{
+	struct admission *adm = new_admission(tmpctx);
+	struct wireaddr_internal addr, known;
+	size_t count;
+
+	known = ipv4(5, 5, 5, 5);
+	admission_add_known(adm, &known);
+
+	/* Each takes a host and a subnet bucket. */
+	for (size_t i = 0;
+	     addr_bucket_map_count(adm->buckets) < ADMISSION_MAX_BUCKETS;
+	     i++) {
+		addr = ipv4(10, i >> 8, i & 0xFF, 1);
+		tal_free(admission_start(adm, adm, &addr, at_usec(0)));
+	}
+	count = addr_bucket_map_count(adm->buckets);
+
+	/* We don't try to prune too often. */
+	addr = ipv4(11, 0, 0, 1);
+	tal_free(admission_start(adm, adm, &addr, at_usec(500000)));
+	assert(addr_bucket_map_count(adm->buckets) == count + 2);
+
+	/* Now they've all refilled, so they're forgotten: except the known
+	 * peer, and the one we're asking about. */
+	addr = ipv4(12, 0, 0, 1);
+	tal_free(admission_start(adm, adm, &addr, at_usec(2000000)));
+	assert(addr_bucket_map_count(adm->buckets) == 3);
+	tal_free(adm);
+}
+
+/* Now a simulation of connectd under a connection flood.  Everything
+ * takes place on connectd's single loop, except ECDH, which is done by
+ * hsmd: all times in usec. */
+#define PEER_MSG_COST 5
+#define REFUSE_COST 3
+#define ACT_ONE_COST 10
+#define ACT_ONE_DONE_COST 5
+#define HSMD_ECDH_COST 60
+
+enum sim_mode {
+	/* What we used to do: take everyone, block on hsmd */
+	SIM_SYNC_ECDH,
+	/* Don't block on hsmd, but take everyone */
+	SIM_ASYNC_ECDH,
+	/* What we do now */
+	SIM_ADMISSION,
+};
+
+/* An ECDH we're waiting for hsmd to finish. */
+struct sim_ecdh {
+	u64 done;
+	/* When the connection arrived, if it's the known peer. */
+	u64 known_start;
+	struct admission_slot *slot;
+};
+
+struct sim_result {
+	u64 *msg_latency;
+	u64 *known_latency;
+	size_t max_in_progress;
+};
+
+static int cmp_u64(const u64 *a, const u64 *b, void *unused)
+{
+	if (*a < *b)
+		return -1;
+	return *a > *b;
+}
+
+static u64 percentile(u64 *arr, size_t pct)
+{
+	asort(arr, tal_count(arr), cmp_u64, NULL);
+	return arr[(tal_count(arr) - 1) * pct / 100];
+}
+
+static struct sim_result *simulate(const tal_t *ctx,
+				   enum sim_mode mode,
+				   u64 duration,
+				   size_t num_peers,
+				   u64 flood_interval)
+{
+	struct sim_result *res = tal(ctx, struct sim_result);
+	struct admission *adm = new_admission(tmpctx);
+	struct wireaddr_internal known = ipv4(5, 5, 5, 5);
+	/* hsmd answers in order, so this is ordered by done time. */
+	struct sim_ecdh *ecdhs = tal_arr(tmpctx, struct sim_ecdh, 0);
+	size_t ecdh_next = 0;
+	u64 next_msg = 0, next_flood = 0, next_known = 0;
+	u64 loop_free = 0, hsmd_free = 0;
+	/* Our established peers each talk every 10 msec. */
+	const u64 msg_interval = 10000 / num_peers;
+	/* The known peer reconnects every 100 msec. */
+	const u64 known_interval = 100000;
+
+	admission_add_known(adm, &known);
+	res->msg_latency = tal_arr(res, u64, 0);
+	res->known_latency = tal_arr(res, u64, 0);
+	res->max_in_progress = 0;
+
+	for (;;) {
+		u64 now, start;
+		struct sim_ecdh *e = NULL;
+		bool is_known = false;
+
+		/* Which happens next? */
+		now = next_msg;
+		if (next_flood < now)
+			now = next_flood;
+		if (next_known < now)
+			now = next_known;
+		if (ecdh_next < tal_count(ecdhs) && ecdhs[ecdh_next].done <= now) {
+			e = &ecdhs[ecdh_next++];
+			now = e->done;
+		}
+		if (now >= duration)
+			break;
+
+		/* We get to it when we've finished whatever we were doing */
+		start = now > loop_free ? now : loop_free;
+
+		if (e) {
+			/* Their act one MAC is bad (or known peer gets to
+			 * act two): either way we're done with the slot. */
+			loop_free = start + ACT_ONE_DONE_COST;
+			if (e->known_start != -1ULL)
+				tal_arr_expand(&res->known_latency,
+					       loop_free - e->known_start);
+			tal_free(e->slot);
+			continue;
+		}
+
+		if (now == next_msg) {
+			loop_free = start + PEER_MSG_COST;
+			tal_arr_expand(&res->msg_latency, loop_free - now);
+			next_msg += msg_interval;
+			continue;
+		}
+
+		/* A connection: from the flood, or the known peer. */
+		if (now == next_known) {
+			is_known = true;
+			next_known += known_interval;
+		} else
+			next_flood += flood_interval;
+
+		if (mode == SIM_ADMISSION) {
+			struct wireaddr_internal addr;
+			struct admission_slot *slot;
+
+			if (is_known)
+				addr = known;
+			else
+				/* Random addresses from a /16 */
+				addr = ipv4(10, 99,
+					    pseudorand(256), pseudorand(256));
+			slot = admission_start(tmpctx, adm, &addr,
+					       at_usec(start));
+			if (!slot) {
+				loop_free = start + REFUSE_COST;
+				continue;
+			}
+			tal_arr_expand(&ecdhs, (struct sim_ecdh){ .slot = slot });
+		} else
+			tal_arr_expand(&ecdhs, (struct sim_ecdh){ .slot = NULL });
+
+		/* We handle act one, then hand off to hsmd */
+		loop_free = start + ACT_ONE_COST;
+		e = &ecdhs[tal_count(ecdhs) - 1];
+		e->known_start = is_known ? now : -1ULL;
+		if (hsmd_free < loop_free)
+			hsmd_free = loop_free;
+		hsmd_free += HSMD_ECDH_COST;
+		e->done = hsmd_free;
+
+		/* Old way, we sit there waiting for the answer. */
+		if (mode == SIM_SYNC_ECDH) {
+			loop_free = e->done;
+			ecdh_next++;
+			loop_free += ACT_ONE_DONE_COST;
+			if (is_known)
+				tal_arr_expand(&res->known_latency,
+					       loop_free - now);
+		}
+
+		if (tal_count(ecdhs) - ecdh_next > res->max_in_progress)
+			res->max_in_progress = tal_count(ecdhs) - ecdh_next;
+	}
+
+	/* Anything left over never finished: count it as taking forever. */
+	for (size_t i = ecdh_next; i < tal_count(ecdhs); i++) {
+		if (ecdhs[i].known_start != -1ULL)
+			tal_arr_expand(&res->known_latency,
+				       duration - ecdhs[i].known_start);
+		tal_free(ecdhs[i].slot);
+	}
+
+	tal_free(adm);
+	return res;
+}
+
+int main(int argc, char *argv[])
+{
+	struct sim_result *sync, *async, *admission;
+	/* 1 second of 40,000 connections/sec */
+	u64 duration = 1000000, flood_interval = 25;
+
+	common_setup(argv[0]);
+	base = time_mono();
+
+	check_limits();
+	check_prune();
+
+	sync = simulate(tmpctx, SIM_SYNC_ECDH, duration, 50, flood_interval);
+	async = simulate(tmpctx, SIM_ASYNC_ECDH, duration, 50, flood_interval);
+	admission = simulate(tmpctx, SIM_ADMISSION, duration, 50, flood_interval);
+
+	/* Blocking on hsmd: everyone waits behind the flood. */
+	assert(percentile(sync->msg_latency, 99) > 100000);
+	/* Not blocking, peers are fine, but hsmd falls behind... */
+	assert(percentile(async->msg_latency, 99) < 1000);
+	assert(percentile(async->known_latency, 50) > 100000);
+	/* ...unless we limit what we give it. */
+	assert(percentile(admission->msg_latency, 99) < 1000);
+	/* Known peers only wait behind as many as we let in. */
+	assert(percentile(admission->known_latency, 99)
+	       < (ADMISSION_MAX_HANDSHAKES + ADMISSION_RESERVED_HANDSHAKES)
+	       * HSMD_ECDH_COST + 1000);
+	assert(admission->max_in_progress
+	       <= ADMISSION_MAX_HANDSHAKES + ADMISSION_RESERVED_HANDSHAKES);
+
+	common_shutdown();
+	return 0;
+}
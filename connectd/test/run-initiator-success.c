@@ -298,11 +298,17 @@ static struct io_plan *success(struct io_conn *conn UNUSED,
 	exit(0);
 }
 
-void ecdh(const struct pubkey *point, struct secret *ss)
+struct io_plan *handshake_ecdh_(struct io_conn *conn,
+				const struct pubkey *point,
+				struct secret *ss,
+				struct io_plan *(*next)(struct io_conn *,
+							void *arg),
+				void *arg)
 {
 	if (secp256k1_ecdh(secp256k1_ctx, ss->data, &point->pubkey,
 			   ls_priv.secret.data, NULL, NULL) != 1)
 		abort();
+	return next(conn, arg);
 }
 
 int main(int argc, char *argv[])
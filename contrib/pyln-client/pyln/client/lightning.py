@@ -965,15 +965,31 @@ class LightningRpc(UnixDomainSocketRpc):
         }
         return self.call("invoice", payload)
 
-    def listchannels(self, short_channel_id=None, source=None, destination=None):
+    def listchannelbalances(self, since=None):
+        """
+        Show the spendable and receivable amounts of our channels,
+        only those which changed after generation {since} if specified.
+        """
+        payload = {
+            "since": since,
+        }
+        return self.call("listchannelbalances", payload)
+
+    def listchannels(self, short_channel_id=None, source=None, destination=None,
+                     since=None, start=None, limit=None):
         """
         Show all known channels or filter by optional
-        {short_channel_id}, {source} or {destination}.
+        {short_channel_id}, {source} or {destination}, and only those
+        updated {since} a timestamp.  Page through all channels using
+        {start} and {limit}.
         """
         payload = {
             "short_channel_id": short_channel_id,
             "source": source,
-            "destination": destination
+            "destination": destination,
+            "since": since,
+            "start": start,
+            "limit": limit,
         }
         return self.call("listchannels", payload)
 
@@ -274,6 +274,7 @@ def listchannels_channels2py(m):
 def listchannels2py(m):
     return remove_default({
         "channels": [listchannels_channels2py(i) for i in m.channels],  # ArrayField[composite] in generate_composite
+        "next_start": m.next_start,  # PrimitiveField in generate_composite
     })
 
 
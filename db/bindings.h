@@ -61,7 +61,7 @@ void db_bind_talarr(struct db_stmt *stmt, int col, const u8 *arr);
 /* Modern variants: get columns by name from SELECT */
 /* Bridge function to get column number from SELECT
    (must exist) */
-size_t db_query_colnum(const struct db_stmt *stmt, const char *colname);
+size_t db_query_colnum(struct db_stmt *stmt, const char *colname);
 
 u64 db_col_u64(struct db_stmt *stmt, const char *colname);
 size_t db_col_bytes(struct db_stmt *stmt, const char *colname);
@@ -3,7 +3,6 @@
 #include "config.h"
 #include <ccan/list/list.h>
 #include <ccan/short_types/short_types.h>
-#include <ccan/strset/strset.h>
 #include <common/autodata.h>
 #include <common/utils.h>
 #include <stdarg.h>
@@ -78,6 +77,8 @@ struct db_query {
 	/* If this is a select statement, what column names */
 	const struct sqlname_map *colnames;
 	size_t num_colnames;
+	/* And how many columns it returns (colnames[].val < num_cols) */
+	size_t num_cols;
 };
 
 enum db_binding_type {
@@ -125,12 +126,23 @@ struct db_stmt {
 
 	int row;
 
+	/* Columns as the caller asked for them in the first row: later rows
+	 * ask in the same order, with the same (literal) names, so
+	 * db_query_colnum() only has to compare pointers. */
+	struct db_col_cache *colcache;
+	size_t colcache_next;
+
 #if DEVELOPER
-	/* Map as we reference into a SELECT statement in query. */
-	struct strset *cols_used;
+	/* Which columns of a SELECT statement we referenced. */
+	bool *cols_used;
 #endif
 };
 
+struct db_col_cache {
+	const char *colname;
+	size_t col;
+};
+
 struct db_query_set {
 	const char *name;
 	const struct db_query *query_table;
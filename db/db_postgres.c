@@ -14,9 +14,38 @@
 #define INT4OID			23
 #define TEXTOID			25
 
+/* db->conn for postgres */
+struct postgres_conn {
+	PGconn *pg;
+
+	/* Do we queue writes in pipeline mode? */
+	bool use_pipeline;
+	/* Are we in pipeline mode now? */
+	bool pipelined;
+	/* What we've sent in pipeline mode, whose results we haven't read */
+	struct pipelined_cmd *pending;
+};
+
+struct pipelined_cmd {
+	/* NULL if it's BEGIN/COMMIT, or the statement was already freed */
+	struct db_stmt *stmt;
+	const char *query;
+};
+
+/* A pipelined statement's inner_stmt points here until we've read its
+ * result. */
+static char result_pending;
+
+static PGconn *pgconn(const struct db *db)
+{
+	const struct postgres_conn *pc = db->conn;
+	return pc->pg;
+}
+
 static bool db_postgres_setup(struct db *db)
 {
 	size_t prefix_len = strlen("postgres://");
+	struct postgres_conn *pc = tal(db, struct postgres_conn);
 
 	/* We attempt to parse the connection string without the `postgres://`
 	prefix first, so we can correctly handle the key-value-pair style of
@@ -30,27 +59,164 @@ static bool db_postgres_setup(struct db *db)
 
 	if (info != NULL) {
 		PQconninfoFree(info);
-		db->conn = PQconnectdb(db->filename + prefix_len);
+		pc->pg = PQconnectdb(db->filename + prefix_len);
 	} else {
-		db->conn = PQconnectdb(db->filename);
+		pc->pg = PQconnectdb(db->filename);
 	}
 
-	if (PQstatus(db->conn) != CONNECTION_OK) {
-		db->error = tal_fmt(db, "Could not connect to %s: %s", db->filename, PQerrorMessage(db->conn));
+	if (PQstatus(pc->pg) != CONNECTION_OK) {
+		db->error = tal_fmt(db, "Could not connect to %s: %s", db->filename, PQerrorMessage(pc->pg));
+		tal_free(pc);
 		db->conn = NULL;
 		return false;
 	}
+
+	/* Each statement is a round trip to the server: so writes, whose
+	 * results nobody usually looks at, go out together in pipeline mode
+	 * (libpq >= 14), and we only wait for them when we have to. */
+#ifdef LIBPQ_HAS_PIPELINING
+	pc->use_pipeline = true;
+#if DEVELOPER
+	if (getenv("LIGHTNINGD_POSTGRES_NO_PIPELINE")
+	    && streq(getenv("LIGHTNINGD_POSTGRES_NO_PIPELINE"), "1"))
+		pc->use_pipeline = false;
+#endif
+#else
+	pc->use_pipeline = false;
+#endif
+	pc->pipelined = false;
+	pc->pending = tal_arr(pc, struct pipelined_cmd, 0);
+	db->conn = pc;
+	return true;
+}
+
+#ifdef LIBPQ_HAS_PIPELINING
+static bool pipeline_enter(struct postgres_conn *pc)
+{
+	if (!pc->pipelined && pc->use_pipeline)
+		pc->pipelined = PQenterPipelineMode(pc->pg);
+	return pc->pipelined;
+}
+
+static void pipeline_add(struct postgres_conn *pc,
+			 struct db_stmt *stmt, const char *query)
+{
+	struct pipelined_cmd cmd;
+
+	cmd.stmt = stmt;
+	cmd.query = query;
+	tal_arr_expand(&pc->pending, cmd);
+	if (stmt)
+		stmt->inner_stmt = &result_pending;
+}
+
+/* Send a command we don't have a db_stmt for. */
+static bool pipeline_send(struct db *db, const char *query)
+{
+	struct postgres_conn *pc = db->conn;
+
+	if (!PQsendQueryParams(pc->pg, query, 0, NULL, NULL, NULL, NULL, 1)) {
+		db->error = tal_fmt(db, "%s failed: %s",
+				    query, PQerrorMessage(pc->pg));
+		return false;
+	}
+	pipeline_add(pc, NULL, query);
 	return true;
 }
 
+/* Wait for everything we've sent, and leave pipeline mode.  Sets
+ * db->error to the first command which failed. */
+static bool pipeline_flush(struct db *db)
+{
+	struct postgres_conn *pc = db->conn;
+	const char *err = NULL;
+	PGresult *res;
+
+	if (!pc->pipelined)
+		return true;
+
+	if (!PQpipelineSync(pc->pg))
+		err = tal_fmt(tmpctx, "pipeline sync failed: %s",
+			      PQerrorMessage(pc->pg));
+
+	for (size_t i = 0; i < tal_count(pc->pending) && !err; i++) {
+		struct pipelined_cmd *cmd = &pc->pending[i];
+
+		res = PQgetResult(pc->pg);
+		if (!res) {
+			err = tal_fmt(tmpctx, "%s: no result: %s", cmd->query,
+				      PQerrorMessage(pc->pg));
+			break;
+		}
+		/* Once one fails, the server skips the rest until the sync */
+		if (PQresultStatus(res) != PGRES_COMMAND_OK
+		    && PQresultStatus(res) != PGRES_PIPELINE_ABORTED)
+			err = tal_fmt(tmpctx, "%s: %s", cmd->query,
+				      PQresultErrorMessage(res));
+
+		if (cmd->stmt)
+			cmd->stmt->inner_stmt = res;
+		else
+			PQclear(res);
+
+		/* Each command's results end with a NULL. */
+		res = PQgetResult(pc->pg);
+		assert(!res);
+	}
+
+	if (!err) {
+		res = PQgetResult(pc->pg);
+		if (PQresultStatus(res) != PGRES_PIPELINE_SYNC)
+			err = tal_fmt(tmpctx, "pipeline sync missing: %s",
+				      PQerrorMessage(pc->pg));
+		PQclear(res);
+	}
+
+	/* Anything we didn't get a result for is gone. */
+	for (size_t i = 0; i < tal_count(pc->pending); i++) {
+		if (pc->pending[i].stmt
+		    && pc->pending[i].stmt->inner_stmt == &result_pending)
+			pc->pending[i].stmt->inner_stmt = NULL;
+	}
+	tal_free(pc->pending);
+	pc->pending = tal_arr(pc, struct pipelined_cmd, 0);
+
+	if (err || !PQexitPipelineMode(pc->pg)) {
+		if (!err)
+			err = PQerrorMessage(pc->pg);
+		db->error = tal_fmt(db, "Pipelined command failed: %s", err);
+		return false;
+	}
+	pc->pipelined = false;
+	return true;
+}
+#else
+static bool pipeline_flush(struct db *db)
+{
+	return true;
+}
+#endif /* !LIBPQ_HAS_PIPELINING */
+
+/* We need results now: if any pipelined command failed, that's fatal. */
+static void pipeline_flush_or_fatal(struct db *db)
+{
+	if (!pipeline_flush(db))
+		db_fatal(db, "%s", db->error);
+}
+
 static bool db_postgres_begin_tx(struct db *db)
 {
 	assert(db->conn);
 	PGresult *res;
-	res = PQexec(db->conn, "BEGIN;");
+
+#ifdef LIBPQ_HAS_PIPELINING
+	if (pipeline_enter(db->conn))
+		return pipeline_send(db, "BEGIN;");
+#endif
+	res = PQexec(pgconn(db), "BEGIN;");
 	if (PQresultStatus(res) != PGRES_COMMAND_OK) {
 		db->error = tal_fmt(db, "BEGIN command failed: %s",
-				    PQerrorMessage(db->conn));
+				    PQerrorMessage(pgconn(db)));
 		PQclear(res);
 		return false;
 	}
@@ -62,10 +228,16 @@ static bool db_postgres_commit_tx(struct db *db)
 {
 	assert(db->conn);
 	PGresult *res;
-	res = PQexec(db->conn, "COMMIT;");
+
+#ifdef LIBPQ_HAS_PIPELINING
+	/* This is where we find out if any of our writes failed. */
+	if (((struct postgres_conn *)db->conn)->pipelined)
+		return pipeline_send(db, "COMMIT;") && pipeline_flush(db);
+#endif
+	res = PQexec(pgconn(db), "COMMIT;");
 	if (PQresultStatus(res) != PGRES_COMMAND_OK) {
 		db->error = tal_fmt(db, "COMMIT command failed: %s",
-				    PQerrorMessage(db->conn));
+				    PQerrorMessage(pgconn(db)));
 		PQclear(res);
 		return false;
 	}
@@ -73,7 +245,8 @@ static bool db_postgres_commit_tx(struct db *db)
 	return true;
 }
 
-static PGresult *db_postgres_do_exec(struct db_stmt *stmt)
+/* If res is NULL, we only send it (in pipeline mode) */
+static bool db_postgres_do_exec(struct db_stmt *stmt, PGresult **res)
 {
 	int slots = stmt->query->placeholders;
 	const char *paramValues[slots];
@@ -129,19 +302,32 @@ static PGresult *db_postgres_do_exec(struct db_stmt *stmt)
 			break;
 		}
 	}
-	return PQexecParams(stmt->db->conn, stmt->query->query, slots,
+	if (!res)
+		return PQsendQueryParams(pgconn(stmt->db), stmt->query->query,
+					 slots, paramTypes, paramValues,
+					 paramLengths, paramFormats,
+					 resultFormat);
+
+	*res = PQexecParams(pgconn(stmt->db), stmt->query->query, slots,
 			    paramTypes, paramValues, paramLengths, paramFormats,
 			    resultFormat);
+	return true;
 }
 
 static bool db_postgres_query(struct db_stmt *stmt)
 {
-	stmt->inner_stmt = db_postgres_do_exec(stmt);
+	PGresult *pgres;
 	int res;
+
+	/* Reads see (and wait for) the writes before them */
+	pipeline_flush_or_fatal(stmt->db);
+
+	db_postgres_do_exec(stmt, &pgres);
+	stmt->inner_stmt = pgres;
 	res = PQresultStatus(stmt->inner_stmt);
 
 	if (res != PGRES_EMPTY_QUERY && res != PGRES_TUPLES_OK) {
-		stmt->error = PQerrorMessage(stmt->db->conn);
+		stmt->error = PQerrorMessage(pgconn(stmt->db));
 		PQclear(stmt->inner_stmt);
 		stmt->inner_stmt = NULL;
 		return false;
@@ -215,26 +401,54 @@ static const unsigned char *db_postgres_column_text(struct db_stmt *stmt, int co
 
 static void db_postgres_stmt_free(struct db_stmt *stmt)
 {
-	if (stmt->inner_stmt)
+	struct postgres_conn *pc = stmt->db->conn;
+
+	if (stmt->inner_stmt == &result_pending) {
+		/* Still want to say what failed, if it does. */
+		for (size_t i = 0; i < tal_count(pc->pending); i++) {
+			if (pc->pending[i].stmt != stmt)
+				continue;
+			pc->pending[i].stmt = NULL;
+			pc->pending[i].query = tal_strdup(pc->pending,
+							  stmt->query->query);
+		}
+	} else if (stmt->inner_stmt)
 		PQclear(stmt->inner_stmt);
 	stmt->inner_stmt = NULL;
 }
 
 static bool db_postgres_exec(struct db_stmt *stmt)
 {
+	PGresult *res;
 	bool ok;
-	stmt->inner_stmt = db_postgres_do_exec(stmt);
+
+#ifdef LIBPQ_HAS_PIPELINING
+	/* Errors get reported when we next wait: at latest, on commit. */
+	if (stmt->db->in_transaction && pipeline_enter(stmt->db->conn)) {
+		if (!db_postgres_do_exec(stmt, NULL)) {
+			stmt->error = PQerrorMessage(pgconn(stmt->db));
+			return false;
+		}
+		pipeline_add(stmt->db->conn, stmt, stmt->query->query);
+		return true;
+	}
+#endif
+	db_postgres_do_exec(stmt, &res);
+	stmt->inner_stmt = res;
 	ok = PQresultStatus(stmt->inner_stmt) == PGRES_COMMAND_OK;
 
 	if (!ok)
-		stmt->error = PQerrorMessage(stmt->db->conn);
+		stmt->error = PQerrorMessage(pgconn(stmt->db));
 
 	return ok;
 }
 
 static u64 db_postgres_last_insert_id(struct db_stmt *stmt)
 {
-	PGresult *res = PQexec(stmt->db->conn, "SELECT lastval()");
+	PGresult *res;
+
+	pipeline_flush_or_fatal(stmt->db);
+	res = PQexec(pgconn(stmt->db), "SELECT lastval()");
 	int id = atoi(PQgetvalue(res, 0, 0));
 	PQclear(res);
 	return id;
@@ -242,7 +456,11 @@ static u64 db_postgres_last_insert_id(struct db_stmt *stmt)
 
 static size_t db_postgres_count_changes(struct db_stmt *stmt)
 {
-	PGresult *res = (PGresult*)stmt->inner_stmt;
+	PGresult *res;
+
+	if (stmt->inner_stmt == &result_pending)
+		pipeline_flush_or_fatal(stmt->db);
+	res = (PGresult*)stmt->inner_stmt;
 	char *count = PQcmdTuples(res);
 	return atoi(count);
 }
@@ -262,10 +480,13 @@ static bool db_postgres_vacuum(struct db *db)
 		return true;
 #endif
 
-	res = PQexec(db->conn, "VACUUM FULL;");
+	if (!pipeline_flush(db))
+		return false;
+
+	res = PQexec(pgconn(db), "VACUUM FULL;");
 	if (PQresultStatus(res) != PGRES_COMMAND_OK) {
 		db->error = tal_fmt(db, "VACUUM command failed: %s",
-				    PQerrorMessage(db->conn));
+				    PQerrorMessage(pgconn(db)));
 		PQclear(res);
 		return false;
 	}
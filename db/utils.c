@@ -13,8 +13,8 @@ static u32 hash_djb2(const char *str)
 	return hash;
 }
 
-size_t db_query_colnum(const struct db_stmt *stmt,
-		       const char *colname)
+static size_t db_query_colnum_slow(const struct db_stmt *stmt,
+				   const char *colname)
 {
 	u32 col;
 
@@ -31,11 +31,33 @@ size_t db_query_colnum(const struct db_stmt *stmt,
 		col = (col + 1) % stmt->query->num_colnames;
 	}
 
+	return stmt->query->colnames[col].val;
+}
+
+size_t db_query_colnum(struct db_stmt *stmt,
+		       const char *colname)
+{
+	size_t col, n = stmt->colcache_next++;
+
+	/* Same name, at the same point in the row, as last time? */
+	if (n < tal_count(stmt->colcache)
+	    && stmt->colcache[n].colname == colname) {
+		col = stmt->colcache[n].col;
+	} else {
+		col = db_query_colnum_slow(stmt, colname);
+		if (!stmt->colcache)
+			stmt->colcache = tal_arr(stmt, struct db_col_cache, 0);
+		if (n >= tal_count(stmt->colcache))
+			tal_resize(&stmt->colcache, n + 1);
+		stmt->colcache[n].colname = colname;
+		stmt->colcache[n].col = col;
+	}
+
 #if DEVELOPER
-	strset_add(stmt->cols_used, colname);
+	stmt->cols_used[col] = true;
 #endif
 
-	return stmt->query->colnames[col].val;
+	return col;
 }
 
 static void db_stmt_free(struct db_stmt *stmt)
@@ -49,14 +71,12 @@ static void db_stmt_free(struct db_stmt *stmt)
 		for (size_t i = 0; i < stmt->query->num_colnames; i++) {
 			if (!stmt->query->colnames[i].sqlname)
 				continue;
-			if (!strset_get(stmt->cols_used,
-					stmt->query->colnames[i].sqlname)) {
+			if (!stmt->cols_used[stmt->query->colnames[i].val]) {
 				db_fatal(stmt->db, "Never accessed column %s in query %s",
 					  stmt->query->colnames[i].sqlname,
 					  stmt->query->query);
 			}
 		}
-		strset_clear(stmt->cols_used);
 	}
 #endif
 	if (stmt->inner_stmt)
@@ -81,6 +101,8 @@ static struct db_stmt *db_prepare_core(struct db *db,
 	stmt->query = db_query;
 	stmt->executed = false;
 	stmt->inner_stmt = NULL;
+	stmt->colcache = NULL;
+	stmt->colcache_next = 0;
 
 	tal_add_destructor(stmt, db_stmt_free);
 
@@ -133,6 +155,7 @@ struct db_stmt *db_prepare_untranslated(struct db *db, const char *query)
 	/* Use raw accessors! */
 	db_query->colnames = NULL;
 	db_query->num_colnames = 0;
+	db_query->num_cols = 0;
 
 	stmt = db_prepare_core(db, "db_prepare_untranslated", db_query);
 	tal_steal(stmt, db_query);
@@ -164,13 +187,13 @@ bool db_step(struct db_stmt *stmt)
 
 	assert(stmt->executed);
 	ret = stmt->db->config->step_fn(stmt);
+	/* New row: expect the columns in the same order as last time */
+	stmt->colcache_next = 0;
 
 #if DEVELOPER
 	/* We only track cols_used if we return a result! */
-	if (ret && !stmt->cols_used) {
-		stmt->cols_used = tal(stmt, struct strset);
-		strset_init(stmt->cols_used);
-	}
+	if (ret && !stmt->cols_used)
+		stmt->cols_used = tal_arrz(stmt, bool, stmt->query->num_cols);
 #endif
 	return ret;
 }
@@ -7,7 +7,7 @@
 struct db;
 struct db_stmt;
 
-size_t db_query_colnum(const struct db_stmt *stmt,
+size_t db_query_colnum(struct db_stmt *stmt,
 		       const char *colname);
 
 /* Return next 'row' result of statement */
@@ -88,11 +88,17 @@ static bool opt_show_network(char *buf, size_t len, const void *unused)
 	return true;
 }
 
-void ecdh(const struct pubkey *point, struct secret *ss)
+struct io_plan *handshake_ecdh_(struct io_conn *conn,
+				const struct pubkey *point,
+				struct secret *ss,
+				struct io_plan *(*next)(struct io_conn *,
+							void *arg),
+				void *arg)
 {
 	if (secp256k1_ecdh(secp256k1_ctx, ss->data, &point->pubkey,
 			   notsosecret.data, NULL, NULL) != 1)
 		abort();
+	return next(conn, arg);
 }
 
 /* We don't want to discard *any* messages. */
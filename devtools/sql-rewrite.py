@@ -154,6 +154,7 @@ const struct db_query db_${f}_queries[] = {
 % if elem['colnames'] is not None:
          .colnames = ${elem['colnames']},
          .num_colnames = ARRAY_SIZE(${elem['colnames']}),
+         .num_cols = ${elem['num_cols']},
 % endif
 % endif
     },
@@ -221,8 +222,10 @@ def extract_queries(pofile):
         if is_select:
             colnames = 'col_table{}'.format(len(queries))
             colhtables[colnames] = colname_htable(query)
+            num_cols = max(t[1] for t in colhtables[colnames]) + 1
         else:
             colnames = None
+            num_cols = 0
 
         queries.append({
             'name': query,
@@ -230,6 +233,7 @@ def extract_queries(pofile):
             'placeholders': query.count('?'),
             'readonly': "true" if is_select else "false",
             'colnames': colnames,
+            'num_cols': num_cols,
         })
     return colhtables, queries_htable(queries)
 
@@ -127,6 +127,29 @@ void peer_supplied_good_gossip(struct daemon *daemon,
 	peer->gossip_counter += amount;
 }
 
+/* Like peer_supplied_good_gossip, but we also note how stale it was */
+void peer_supplied_novel_gossip(struct daemon *daemon,
+				const struct node_id *source_peer,
+				u32 timestamp)
+{
+	struct peer *peer;
+	u64 now;
+
+	if (!source_peer)
+		return;
+
+	peer = find_peer(daemon, source_peer);
+	if (!peer)
+		return;
+
+	peer->gossip_counter++;
+
+	now = gossip_time_now(daemon->rstate).ts.tv_sec;
+	if (timestamp < now)
+		peer->gossip_delay_total += now - timestamp;
+	peer->gossip_delay_count++;
+}
+
 /* Queue a gossip message for the peer: connectd simply forwards it to
  * the peer. */
 void queue_peer_msg(struct peer *peer, const u8 *msg TAKES)
@@ -487,6 +510,10 @@ static void connectd_new_peer(struct daemon *daemon, const u8 *msg)
 	/* Populate the rest of the peer info. */
 	peer->daemon = daemon;
 	peer->gossip_counter = 0;
+	peer->gossip_bytes = 0;
+	peer->gossip_delay_total = 0;
+	peer->gossip_delay_count = 0;
+	peer->gossip_last_score = -1;
 	peer->scid_queries = NULL;
 	peer->scid_query_idx = 0;
 	peer->scid_query_nodes = NULL;
@@ -577,12 +604,15 @@ static void handle_recv_gossip(struct daemon *daemon, const u8 *outermsg)
 	/* These are messages relayed from peer */
 	switch ((enum peer_wire)fromwire_peektype(msg)) {
 	case WIRE_CHANNEL_ANNOUNCEMENT:
+		peer->gossip_bytes += tal_bytelen(msg);
 		err = handle_channel_announcement_msg(peer->daemon, &id, msg);
 		goto handled_msg;
 	case WIRE_CHANNEL_UPDATE:
+		peer->gossip_bytes += tal_bytelen(msg);
 		err = handle_channel_update_msg(peer, msg);
 		goto handled_msg;
 	case WIRE_NODE_ANNOUNCEMENT:
+		peer->gossip_bytes += tal_bytelen(msg);
 		err = handle_node_announce(peer, msg);
 		goto handled_msg;
 	case WIRE_QUERY_CHANNEL_RANGE:
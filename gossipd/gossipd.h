@@ -106,6 +106,17 @@ struct peer {
 	/* How much contribution have we made to gossip? */
 	size_t gossip_counter;
 
+	/* How many bytes of gossip have they sent us (useful or not)? */
+	size_t gossip_bytes;
+
+	/* Total delay (in seconds) between the timestamp of novel gossip
+	 * they sent and when we got it, and how many messages that covers. */
+	u64 gossip_delay_total;
+	size_t gossip_delay_count;
+
+	/* Score from the last time they were streaming us gossip (or -1) */
+	double gossip_last_score;
+
 	/* The two features gossip cares about (so far) */
 	bool gossip_queries_feature, initial_routing_sync_feature;
 
@@ -139,6 +150,12 @@ void peer_supplied_good_gossip(struct daemon *daemon,
 			       const struct node_id *source_peer,
 			       size_t amount);
 
+/* This peer (may be NULL) gave us gossip we didn't have, with this
+ * timestamp. */
+void peer_supplied_novel_gossip(struct daemon *daemon,
+				const struct node_id *source_peer,
+				u32 timestamp);
+
 /* Get a random peer.  NULL if no peers. */
 struct peer *first_random_peer(struct daemon *daemon,
 			       struct peer_node_id_map_iter *it);
@@ -297,6 +297,7 @@ struct routing_state *new_routing_state(const tal_t *ctx,
 
 	uintmap_init(&rstate->chanmap);
 	uintmap_init(&rstate->unupdated_chanmap);
+	uintmap_init(&rstate->unannounced_node_chans);
 	rstate->num_txout_failures = 0;
 	uintmap_init(&rstate->txout_failures);
 	uintmap_init(&rstate->txout_failures_old);
@@ -482,6 +483,28 @@ static void force_node_announce_rexmit(struct routing_state *rstate,
 	}
 }
 
+/* Keep rstate->unannounced_node_chans up to date for this channel */
+static void update_unannounced_node_chan(struct routing_state *rstate,
+					 const struct chan *chan)
+{
+	if (is_chan_public(chan)
+	    && (!chan->nodes[0]->bcast.index || !chan->nodes[1]->bcast.index))
+		uintmap_add(&rstate->unannounced_node_chans, chan->scid.u64, true);
+	else
+		uintmap_del(&rstate->unannounced_node_chans, chan->scid.u64);
+}
+
+/* Node gained or lost its node_announcement: update its channels */
+static void update_unannounced_node_chans(struct routing_state *rstate,
+					  const struct node *node)
+{
+	struct chan_map_iter i;
+	struct chan *c;
+
+	for (c = first_chan(node, &i); c; c = next_chan(node, &i))
+		update_unannounced_node_chan(rstate, c);
+}
+
 static void remove_chan_from_node(struct routing_state *rstate,
 				  struct node *node, const struct chan *chan)
 {
@@ -529,6 +552,7 @@ static void remove_chan_from_node(struct routing_state *rstate,
 				    WIRE_NODE_ANNOUNCEMENT);
 		node->rgraph.index = node->bcast.index = 0;
 		node->rgraph.timestamp = node->bcast.timestamp = 0;
+		update_unannounced_node_chans(rstate, node);
 	} else if (node_announce_predates_channels(node)) {
 		/* node announcement predates all channel announcements?
 		 * Move to end (we could, in theory, move to just past next
@@ -562,6 +586,7 @@ void free_chan(struct routing_state *rstate, struct chan *chan)
 {
 	free_chans_from_node(rstate, chan);
 	uintmap_del(&rstate->chanmap, chan->scid.u64);
+	uintmap_del(&rstate->unannounced_node_chans, chan->scid.u64);
 
 	tal_free(chan);
 }
@@ -574,6 +599,7 @@ static void init_half_chan(struct routing_state *rstate,
 
 	broadcastable_init(&c->bcast);
 	broadcastable_init(&c->rgraph);
+	c->bcast_fingerprint = 0;
 	c->tokens = TOKEN_MAX;
 	c->zombie = false;
 }
@@ -849,6 +875,7 @@ static void add_channel_announce_to_broadcast(struct routing_state *rstate,
 						     false,
 						     addendum);
 	rstate->local_channel_announced |= is_local;
+	update_unannounced_node_chan(rstate, chan);
 }
 
 static void delete_chan_messages_from_store(struct routing_state *rstate,
@@ -1300,6 +1327,39 @@ static void update_pending(struct pending_cannouncement *pending,
 	}
 }
 
+/* Hash everything but signature and timestamp of a (valid!) channel_update,
+ * i.e. the parts cupdate_different() compares. */
+static u32 cupdate_fingerprint(const u8 *cupdate)
+{
+	struct siphash24_ctx ctx;
+	/* 2 byte msg type + 64 byte signature */
+	size_t off = 2 + 64;
+	/* chain_hash + short_channel_id, then u32 timestamp */
+	size_t prelen = 32 + 8, tslen = 4;
+
+	siphash24_init(&ctx, siphash_seed());
+	siphash24_update(&ctx, cupdate + off, prelen);
+	siphash24_update(&ctx, cupdate + off + prelen + tslen,
+			 tal_count(cupdate) - (off + prelen + tslen));
+	return siphash24_done(&ctx);
+}
+
+/* Is this the same as the last update we broadcast? */
+static bool cupdate_redundant(const struct routing_state *rstate,
+			      const struct half_chan *hc,
+			      u32 timestamp, u32 fingerprint,
+			      const u8 *cupdate)
+{
+	/* Allow redundant updates once every 7 days */
+	if (timestamp >= hc->bcast.timestamp + GOSSIP_PRUNE_INTERVAL(rstate->dev_fast_gossip_prune) / 2)
+		return false;
+	if (fingerprint != hc->bcast_fingerprint)
+		return false;
+	/* Almost certainly the same, but a collision must not make us
+	 * drop a real update. */
+	return !cupdate_different(rstate->gs, hc, cupdate);
+}
+
 static void delete_spam_update(struct routing_state *rstate,
 			       struct half_chan *hc,
 			       bool update_is_public)
@@ -1339,6 +1399,7 @@ bool routing_add_channel_update(struct routing_state *rstate,
 	struct amount_sat sat;
 	bool spam;
 	bool zombie;
+	u32 fingerprint;
 
 	/* Make sure we own msg, even if we don't save it. */
 	if (taken(update))
@@ -1354,6 +1415,7 @@ bool routing_add_channel_update(struct routing_state *rstate,
 		return false;
 
 	direction = channel_flags & 0x1;
+	fingerprint = cupdate_fingerprint(update);
 	chan = get_channel(rstate, &short_channel_id);
 
 	if (chan) {
@@ -1422,9 +1484,8 @@ bool routing_add_channel_update(struct routing_state *rstate,
 			return true;
 		}
 
-		/* Allow redundant updates once every 7 days */
-		if (timestamp < hc->bcast.timestamp + GOSSIP_PRUNE_INTERVAL(rstate->dev_fast_gossip_prune) / 2
-		    && !cupdate_different(rstate->gs, hc, update)) {
+		if (cupdate_redundant(rstate, hc, timestamp, fingerprint,
+				      update)) {
 			SUPERVERBOSE("Ignoring redundant update for %s/%u"
 				     " (last %u, now %u)",
 				     type_to_string(tmpctx,
@@ -1468,8 +1529,10 @@ bool routing_add_channel_update(struct routing_state *rstate,
 
 	/* Update timestamp(s) */
 	hc->rgraph.timestamp = timestamp;
-	if (!spam)
+	if (!spam) {
 		hc->bcast.timestamp = timestamp;
+		hc->bcast_fingerprint = fingerprint;
+	}
 
 	/* BOLT #7:
 	 *   - MUST consider the `timestamp` of the `channel_announcement` to be
@@ -1584,7 +1647,8 @@ bool routing_add_channel_update(struct routing_state *rstate,
 		if (!spam)
 			hc->bcast.index = hc->rgraph.index;
 
-		peer_supplied_good_gossip(rstate->daemon, source_peer, 1);
+		peer_supplied_novel_gossip(rstate->daemon, source_peer,
+					   timestamp);
 	}
 
 	if (uc) {
@@ -1614,6 +1678,40 @@ bool would_ratelimit_cupdate(struct routing_state *rstate,
 		>= TOKENS_PER_MSG;
 }
 
+/* Would routing_add_channel_update() ignore this update anyway?  Checking
+ * is much cheaper than checking the signature, and we usually receive the
+ * same update from many peers. */
+static bool cupdate_ignorable(struct routing_state *rstate,
+			      const struct short_channel_id *scid,
+			      int direction, u32 timestamp,
+			      struct amount_msat htlc_maximum,
+			      const u8 *update)
+{
+	const struct chan *chan = get_channel(rstate, scid);
+	const struct half_chan *hc;
+
+	/* Leave unupdated channels to routing_add_channel_update() */
+	if (!chan)
+		return false;
+
+	if (amount_msat_greater_sat(htlc_maximum, chan->sat))
+		return true;
+
+	if (!timestamp_reasonable(rstate, timestamp))
+		return true;
+
+	hc = &chan->half[direction];
+	if (!is_halfchan_defined(hc))
+		return false;
+
+	/* Outdated (including the exact update we already have) */
+	if (timestamp <= hc->rgraph.timestamp)
+		return true;
+
+	return cupdate_redundant(rstate, hc, timestamp,
+				 cupdate_fingerprint(update), update);
+}
+
 static const struct node_id *get_channel_owner(struct routing_state *rstate,
 					       const struct short_channel_id *scid,
 					       int direction)
@@ -1720,6 +1818,16 @@ u8 *handle_channel_update(struct routing_state *rstate, const u8 *update TAKES,
 		return NULL;
 	}
 
+	/* Don't bother checking the signature if we'd ignore it. */
+	if (!force && cupdate_ignorable(rstate, &short_channel_id, direction,
+					timestamp, htlc_maximum, serialized)) {
+		SUPERVERBOSE("Ignoring duplicate/outdated update for %s/%u",
+			     type_to_string(tmpctx, struct short_channel_id,
+					    &short_channel_id),
+			     direction);
+		return NULL;
+	}
+
 	warn = check_channel_update(rstate, owner, &signature, serialized);
 	if (warn) {
 		/* BOLT #7:
@@ -1906,9 +2014,13 @@ bool routing_add_node_announcement(struct routing_state *rstate,
 		if (!spam)
 			node->bcast.index = node->rgraph.index;
 
-		peer_supplied_good_gossip(rstate->daemon, source_peer, 1);
+		peer_supplied_novel_gossip(rstate->daemon, source_peer,
+					   timestamp);
 	}
 
+	if (node->bcast.index)
+		update_unannounced_node_chans(rstate, node);
+
 	/* Only log this if *not* loading from store. */
 	if (!index)
 		status_peer_debug(source_peer,
@@ -2196,6 +2308,8 @@ void remove_all_gossip(struct routing_state *rstate)
 		tal_free(c);
 	}
 
+	uintmap_clear(&rstate->unannounced_node_chans);
+
 	while ((uc = uintmap_first(&rstate->unupdated_chanmap, &index)) != NULL)
 		tal_free(uc);
 
@@ -28,6 +28,10 @@ struct half_chan {
 	 * non-broadcastable. If there is no spam, rgraph == bcast. */
 	struct broadcastable rgraph;
 
+	/* Hash of bcast's contents (minus signature and timestamp), so we
+	 * only read the store to check likely redundant updates. */
+	u32 bcast_fingerprint;
+
 	/* Token bucket */
 	u8 tokens;
 
@@ -217,6 +221,10 @@ struct routing_state {
 	 * we haven't got a channel_update for these yet. */
 	UINTMAP(struct unupdated_channel *) unupdated_chanmap;
 
+	/* Public channels where one or both nodes have no node_announcement:
+	 * the seeker probes these rather than walking the whole chanmap. */
+	UINTMAP(bool) unannounced_node_chans;
+
 	/* Has one of our own channels been announced? */
 	bool local_channel_announced;
 
@@ -9,6 +9,7 @@
 #include <common/random_select.h>
 #include <common/status.h>
 #include <common/timeout.h>
+#include <common/type_to_string.h>
 #include <gossipd/gossipd.h>
 #include <gossipd/queries.h>
 #include <gossipd/routing.h>
@@ -17,6 +18,15 @@
 #define GOSSIP_SEEKER_INTERVAL(seeker) \
 	DEV_FAST_GOSSIP((seeker)->daemon->rstate->dev_fast_gossip, 5, 60)
 
+/* How many seeker_checks a gossiper gets before we judge it. */
+#define GOSSIPER_MIN_CHECKS 10
+
+/* Typical size of a gossip message, for judging useful bytes. */
+#define GOSSIPER_AVG_MSG_BYTES 200
+
+/* Average gossip delay (seconds) which halves a gossiper's score */
+#define GOSSIPER_DELAY_SCALE 600
+
 enum seeker_state {
 	/* Still streaming gossip from single peer. */
 	STARTING_UP,
@@ -70,8 +80,17 @@ struct seeker {
 	 * missing channels. */
 	bool unknown_nodes;
 
-	/* Peers we've asked to stream us gossip (set to NULL if peer dies) */
-	struct peer *gossiper[5];
+	/* Peers we've asked to stream us gossip (peer NULL if peer dies) */
+	struct gossiper {
+		struct peer *peer;
+		/* seeker->checks, and peer's counters, when we started */
+		u64 start_check;
+		size_t counter_start, bytes_start, delay_count_start;
+		u64 delay_total_start;
+	} gossiper[5];
+
+	/* How many times seeker_check has run: our clock for gossipers */
+	u64 checks;
 
 	/* A peer that told us about unknown gossip (set to NULL if peer dies). */
 	struct peer *preferred_peer;
@@ -136,7 +155,8 @@ struct seeker *new_seeker(struct daemon *daemon)
 	uintmap_init(&seeker->stale_scids);
 	seeker->random_peer = NULL;
 	for (size_t i = 0; i < ARRAY_SIZE(seeker->gossiper); i++)
-		seeker->gossiper[i] = NULL;
+		seeker->gossiper[i].peer = NULL;
+	seeker->checks = 0;
 	seeker->preferred_peer = NULL;
 	seeker->unknown_nodes = false;
 	set_state(seeker, STARTING_UP, NULL, "New seeker");
@@ -228,14 +248,57 @@ static void enable_gossip_stream(struct seeker *seeker, struct peer *peer)
 	queue_peer_msg(peer, take(msg));
 }
 
+/* Put this peer in a gossiper slot, and start measuring it */
+static void set_gossiper(struct seeker *seeker, size_t i, struct peer *peer)
+{
+	struct gossiper *g = &seeker->gossiper[i];
+
+	g->peer = peer;
+	g->start_check = seeker->checks;
+	g->counter_start = peer->gossip_counter;
+	g->bytes_start = peer->gossip_bytes;
+	g->delay_count_start = peer->gossip_delay_count;
+	g->delay_total_start = peer->gossip_delay_total;
+}
+
+/* How useful has this gossiper been since we started streaming from it?
+ * This is the novel gossip per check interval, discounted if most of what
+ * they send is stuff we already have, or if it reaches us late. */
+static double gossiper_score(const struct seeker *seeker,
+			     const struct gossiper *g)
+{
+	const struct peer *peer = g->peer;
+	size_t novel = peer->gossip_counter - g->counter_start;
+	size_t bytes = peer->gossip_bytes - g->bytes_start;
+	size_t num_delays = peer->gossip_delay_count - g->delay_count_start;
+	double score;
+
+	score = (double)novel / (seeker->checks - g->start_check + 1);
+
+	if (bytes) {
+		double useful = (double)novel * GOSSIPER_AVG_MSG_BYTES / bytes;
+		if (useful > 1.0)
+			useful = 1.0;
+		score *= (1.0 + useful) / 2;
+	}
+
+	if (num_delays) {
+		double avg_delay = (double)(peer->gossip_delay_total
+					    - g->delay_total_start)
+			/ num_delays;
+		score /= 1.0 + avg_delay / GOSSIPER_DELAY_SCALE;
+	}
+	return score;
+}
+
 static void normal_gossip_start(struct seeker *seeker, struct peer *peer)
 {
 	bool enable_stream = false;
 
 	/* Make this one of our streaming gossipers if we aren't full */
 	for (size_t i = 0; i < ARRAY_SIZE(seeker->gossiper); i++) {
-		if (seeker->gossiper[i] == NULL) {
-			seeker->gossiper[i] = peer;
+		if (seeker->gossiper[i].peer == NULL) {
+			set_gossiper(seeker, i, peer);
 			enable_stream = true;
 			break;
 		}
@@ -449,12 +512,17 @@ static bool get_unannounced_nodes(const tal_t *ctx,
 	 * side-effect this gets the node. */
 	*scids = tal_arr(ctx, struct short_channel_id, max);
 
-	/* FIXME: This is inefficient!  Reuse next_block_range here! */
-	for (struct chan *c = uintmap_first(&rstate->chanmap, &offset);
-	     c;
-	     c = uintmap_after(&rstate->chanmap, &offset)) {
+	/* routing.c keeps an index of exactly these channels for us. */
+	for (bool ok = uintmap_first(&rstate->unannounced_node_chans, &offset);
+	     ok;
+	     ok = uintmap_after(&rstate->unannounced_node_chans, &offset)) {
+		struct short_channel_id scid;
+		struct chan *c;
+
+		scid.u64 = offset;
+		c = get_channel(rstate, &scid);
 		/* Local-only?  Don't ask. */
-		if (!is_chan_public(c))
+		if (!c || !is_chan_public(c))
 			continue;
 
 		if (c->nodes[0]->bcast.index && c->nodes[1]->bcast.index)
@@ -812,45 +880,109 @@ static bool peer_is_not_gossipper(const struct peer *peer)
 	const struct seeker *seeker = peer->daemon->seeker;
 
 	for (size_t i = 0; i < ARRAY_SIZE(seeker->gossiper); i++) {
-		if (seeker->gossiper[i] == peer)
+		if (seeker->gossiper[i].peer == peer)
 			return false;
 	}
 	return true;
 }
 
-/* FIXME: We should look at gossip performance and replace the underperforming
- * peers in preference. */
+static bool peer_can_gossip(const struct peer *peer)
+{
+	return peer_has_gossip_queries(peer) && peer_is_not_gossipper(peer);
+}
+
+/* Best peer to replace a poor gossiper: one we've never streamed from,
+ * otherwise the one which did best last time. */
+static struct peer *best_new_gossiper(struct seeker *seeker,
+				      const struct peer *excluded)
+{
+	struct peer *best = NULL;
+	struct peer *peer, *first;
+	struct peer_node_id_map_iter it;
+
+	peer = first = first_random_peer(seeker->daemon, &it);
+	while (peer) {
+		if (peer != excluded && peer_can_gossip(peer)) {
+			if (peer->gossip_last_score < 0)
+				return peer;
+			if (!best
+			    || peer->gossip_last_score > best->gossip_last_score)
+				best = peer;
+		}
+		peer = next_random_peer(seeker->daemon, first, &it);
+	}
+	return best;
+}
+
+static void replace_gossiper(struct seeker *seeker, size_t i,
+			     struct peer *peer, double score)
+{
+	struct peer *old = seeker->gossiper[i].peer;
+
+	status_peer_debug(&peer->id,
+			  "seeker: replacing slot %zu (%s scored %f)",
+			  i, type_to_string(tmpctx, struct node_id, &old->id),
+			  score);
+	old->gossip_last_score = score;
+	disable_gossip_stream(seeker, old);
+	set_gossiper(seeker, i, peer);
+	enable_gossip_stream(seeker, peer);
+}
+
+/* We replace a gossiper which does much worse than the others, and ~ once
+ * per hour we replace the worst one anyway, to give others a chance. */
 static void maybe_rotate_gossipers(struct seeker *seeker)
 {
 	struct peer *peer;
-	size_t i;
+	size_t i, worst = ARRAY_SIZE(seeker->gossiper), num_judged = 0;
+	double scores[ARRAY_SIZE(seeker->gossiper)], total = 0;
 
 	/* If all peers are gossiping, we're done */
-	peer = random_seeker(seeker, peer_is_not_gossipper);
+	peer = random_seeker(seeker, peer_can_gossip);
 	if (!peer)
 		return;
 
-	/* If we have a slot free, or ~ 1 per hour */
+	/* If we have a slot free, fill it. */
 	for (i = 0; i < ARRAY_SIZE(seeker->gossiper); i++) {
-		if (!seeker->gossiper[i]) {
+		if (!seeker->gossiper[i].peer) {
 			status_peer_debug(&peer->id, "seeker: filling slot %zu",
 					  i);
-			goto set_gossiper;
-		}
-		if (pseudorand(ARRAY_SIZE(seeker->gossiper) * 60) == 0) {
-			status_peer_debug(&peer->id,
-					  "seeker: replacing slot %zu",
-					  i);
-			goto disable_gossiper;
+			set_gossiper(seeker, i, peer);
+			enable_gossip_stream(seeker, peer);
+			return;
 		}
 	}
-	return;
 
-disable_gossiper:
-	disable_gossip_stream(seeker, seeker->gossiper[i]);
-set_gossiper:
-	seeker->gossiper[i] = peer;
-	enable_gossip_stream(seeker, peer);
+	/* Only judge those who've had time to prove themselves. */
+	for (i = 0; i < ARRAY_SIZE(seeker->gossiper); i++) {
+		const struct gossiper *g = &seeker->gossiper[i];
+
+		if (seeker->checks < g->start_check + GOSSIPER_MIN_CHECKS)
+			continue;
+		scores[i] = gossiper_score(seeker, g);
+		total += scores[i];
+		num_judged++;
+		if (worst == ARRAY_SIZE(seeker->gossiper)
+		    || scores[i] < scores[worst])
+			worst = i;
+	}
+
+	if (worst == ARRAY_SIZE(seeker->gossiper))
+		return;
+
+	/* Much worse than the average of the others?  Replace with the best
+	 * candidate we know of. */
+	if (num_judged > 1
+	    && scores[worst] * 2 < (total - scores[worst]) / (num_judged - 1)) {
+		peer = best_new_gossiper(seeker, seeker->gossiper[worst].peer);
+		if (peer)
+			replace_gossiper(seeker, worst, peer, scores[worst]);
+		return;
+	}
+
+	/* ~ 1 per hour, try a random one instead of our worst. */
+	if (pseudorand(60) == 0)
+		replace_gossiper(seeker, worst, peer, scores[worst]);
 }
 
 static bool seek_any_unknown_nodes(struct seeker *seeker)
@@ -866,6 +998,8 @@ static bool seek_any_unknown_nodes(struct seeker *seeker)
 /* Periodic timer to see how our gossip is going. */
 static void seeker_check(struct seeker *seeker)
 {
+	seeker->checks++;
+
 	/* We don't do anything until we're synced. */
 	if (seeker->daemon->current_blockheight == 0)
 		goto out;
@@ -972,8 +1106,8 @@ void seeker_peer_gone(struct seeker *seeker, const struct peer *peer)
 		seeker->random_peer = NULL;
 
 	for (size_t i = 0; i < ARRAY_SIZE(seeker->gossiper); i++) {
-		if (seeker->gossiper[i] == peer)
-			seeker->gossiper[i] = NULL;
+		if (seeker->gossiper[i].peer == peer)
+			seeker->gossiper[i].peer = NULL;
 	}
 
 	if (seeker->preferred_peer == peer)
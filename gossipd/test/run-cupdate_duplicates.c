@@ -0,0 +1,258 @@
+#include "config.h"
+#include "../routing.c"
+#include "../common/timeout.c"
+#include <bitcoin/privkey.h>
+#include <bitcoin/signature.h>
+#include <ccan/mem/mem.h>
+#include <common/blinding.h>
+#include <common/channel_type.h>
+#include <common/ecdh.h>
+#include <common/json_stream.h>
+#include <common/onionreply.h>
+#include <common/setup.h>
+#include <stdio.h>
+
+/* AUTOGENERATED MOCKS START */
+/* Generated stub for blinding_hash_e_and_ss */
+void blinding_hash_e_and_ss(const struct pubkey *e UNNEEDED,
+			    const struct secret *ss UNNEEDED,
+			    struct sha256 *sha UNNEEDED)
+{ fprintf(stderr, "blinding_hash_e_and_ss called!\n"); abort(); }
+/* Generated stub for blinding_next_privkey */
+bool blinding_next_privkey(const struct privkey *e UNNEEDED,
+			   const struct sha256 *h UNNEEDED,
+			   struct privkey *next UNNEEDED)
+{ fprintf(stderr, "blinding_next_privkey called!\n"); abort(); }
+/* Generated stub for blinding_next_pubkey */
+bool blinding_next_pubkey(const struct pubkey *pk UNNEEDED,
+			  const struct sha256 *h UNNEEDED,
+			  struct pubkey *next UNNEEDED)
+{ fprintf(stderr, "blinding_next_pubkey called!\n"); abort(); }
+/* Generated stub for gossip_store_add_private_update */
+u64 gossip_store_add_private_update(struct gossip_store *gs UNNEEDED, const u8 *update UNNEEDED)
+{ fprintf(stderr, "gossip_store_add_private_update called!\n"); abort(); }
+/* Generated stub for gossip_store_get */
+const u8 *gossip_store_get(const tal_t *ctx UNNEEDED,
+			   struct gossip_store *gs UNNEEDED,
+			   u64 offset UNNEEDED)
+{ fprintf(stderr, "gossip_store_get called!\n"); abort(); }
+/* Generated stub for gossip_store_get_private_update */
+const u8 *gossip_store_get_private_update(const tal_t *ctx UNNEEDED,
+					  struct gossip_store *gs UNNEEDED,
+					  u64 offset UNNEEDED)
+{ fprintf(stderr, "gossip_store_get_private_update called!\n"); abort(); }
+/* Generated stub for gossip_store_mark_channel_deleted */
+void gossip_store_mark_channel_deleted(struct gossip_store *gs UNNEEDED,
+				       const struct short_channel_id *scid UNNEEDED)
+{ fprintf(stderr, "gossip_store_mark_channel_deleted called!\n"); abort(); }
+/* Generated stub for memleak_add_helper_ */
+void memleak_add_helper_(const tal_t *p UNNEEDED, void (*cb)(struct htable *memtable UNNEEDED,
+						    const tal_t *)){ }
+/* Generated stub for memleak_scan_htable */
+void memleak_scan_htable(struct htable *memtable UNNEEDED, const struct htable *ht UNNEEDED)
+{ fprintf(stderr, "memleak_scan_htable called!\n"); abort(); }
+/* Generated stub for memleak_scan_intmap_ */
+void memleak_scan_intmap_(struct htable *memtable UNNEEDED, const struct intmap *m UNNEEDED)
+{ fprintf(stderr, "memleak_scan_intmap_ called!\n"); abort(); }
+/* Generated stub for nannounce_different */
+bool nannounce_different(struct gossip_store *gs UNNEEDED,
+			 const struct node *node UNNEEDED,
+			 const u8 *nannounce UNNEEDED,
+			 bool *only_missing_tlv UNNEEDED)
+{ fprintf(stderr, "nannounce_different called!\n"); abort(); }
+/* Generated stub for notleak_ */
+void *notleak_(void *ptr UNNEEDED, bool plus_children UNNEEDED)
+{ fprintf(stderr, "notleak_ called!\n"); abort(); }
+/* Generated stub for sanitize_error */
+char *sanitize_error(const tal_t *ctx UNNEEDED, const u8 *errmsg UNNEEDED,
+		     struct channel_id *channel_id UNNEEDED)
+{ fprintf(stderr, "sanitize_error called!\n"); abort(); }
+/* Generated stub for status_failed */
+void status_failed(enum status_failreason code UNNEEDED,
+		   const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "status_failed called!\n"); abort(); }
+/* AUTOGENERATED MOCKS END */
+
+/* NOOP stub for gossip_store_new */
+struct gossip_store *gossip_store_new(struct routing_state *rstate UNNEEDED)
+{
+	return NULL;
+}
+
+static u64 num_stored;
+/* Everything we stored, by index. */
+static const u8 **stored;
+
+u64 gossip_store_add(struct gossip_store *gs UNNEEDED, const u8 *gossip_msg,
+		     u32 timestamp UNNEEDED, bool zombie UNNEEDED, bool spam UNNEEDED,
+		     const u8 *addendum UNNEEDED)
+{
+	tal_resize(&stored, ++num_stored + 1);
+	stored[num_stored] = tal_dup_talarr(stored, u8, gossip_msg);
+	return num_stored;
+}
+
+/* Everything but the signature and timestamp, like the real one. */
+bool cupdate_different(struct gossip_store *gs UNNEEDED,
+		       const struct half_chan *hc,
+		       const u8 *cupdate)
+{
+	const u8 *orig = stored[hc->bcast.index];
+	/* 2 byte msg type + 64 byte signature, chain_hash + scid */
+	size_t off = 2 + 64, prelen = 32 + 8, tslen = 4;
+
+	return !memeq(orig + off, prelen, cupdate + off, prelen)
+		|| !memeq(orig + off + prelen + tslen,
+			  tal_count(orig) - (off + prelen + tslen),
+			  cupdate + off + prelen + tslen,
+			  tal_count(cupdate) - (off + prelen + tslen));
+}
+
+void gossip_store_delete(struct gossip_store *gs UNNEEDED,
+			 struct broadcastable *bcast UNNEEDED,
+			 int type UNNEEDED)
+{
+}
+
+void peer_supplied_novel_gossip(struct daemon *daemon UNNEEDED,
+				const struct node_id *source_peer UNNEEDED,
+				u32 timestamp UNNEEDED)
+{
+}
+
+void status_fmt(enum log_level level UNNEEDED,
+		const struct node_id *peer UNNEEDED,
+		const char *fmt UNNEEDED, ...)
+{
+}
+
+u8 *towire_warningfmt(const tal_t *ctx,
+		      const struct channel_id *channel UNNEEDED,
+		      const char *fmt UNNEEDED, ...)
+{
+	return tal_arr(ctx, u8, 0);
+}
+
+#define NUM_CHANNELS 10
+/* Every update reaches us from this many peers */
+#define NUM_PEERS 5
+/* Every second round is a redundant (unchanged) update. */
+#define NUM_ROUNDS 6
+
+static struct privkey keys[NUM_CHANNELS];
+static struct node_id peers[NUM_PEERS];
+static struct short_channel_id scids[NUM_CHANNELS];
+static int directions[NUM_CHANNELS];
+
+static u8 *make_update(const tal_t *ctx, size_t i, u32 timestamp, u32 fee)
+{
+	secp256k1_ecdsa_signature sig;
+	struct sha256_double hash;
+	u8 *update;
+
+	memset(&sig, 0, sizeof(sig));
+	for (;;) {
+		update = towire_channel_update(ctx, &sig,
+					       &chainparams->genesis_blockhash,
+					       &scids[i], timestamp,
+					       ROUTING_OPT_HTLC_MAX_MSAT,
+					       directions[i], 6,
+					       AMOUNT_MSAT(1), fee, 10,
+					       AMOUNT_MSAT(100000000));
+		if (!memeqzero(&sig, sizeof(sig)))
+			return update;
+		/* 2 byte msg type + 64 byte signature */
+		sha256_double(&hash, update + 66, tal_count(update) - 66);
+		sign_hash(&keys[i], &hash, &sig);
+		tal_free(update);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	struct routing_state *rstate;
+	struct daemon *daemon;
+	struct node_id other;
+	struct pubkey pk;
+	u32 base = time_now().ts.tv_sec - 11 * 24 * 60 * 60;
+	u8 *update, *bad;
+	u64 expect_stored = 0;
+	struct half_chan *hc;
+
+	common_setup(argv[0]);
+	chainparams = chainparams_for_network("regtest");
+	stored = tal_arr(tmpctx, const u8 *, 1);
+
+	daemon = tal(tmpctx, struct daemon);
+	timers_init(&daemon->timers, time_mono());
+	rstate = new_routing_state(tmpctx, daemon, NULL, false, false);
+
+	for (size_t i = 0; i < NUM_PEERS; i++)
+		memset(&peers[i], 0xF0 + i, sizeof(peers[i]));
+
+	memset(&other, 0x02, sizeof(other));
+	for (size_t i = 0; i < NUM_CHANNELS; i++) {
+		struct node_id id;
+		struct chan *chan;
+
+		memset(&keys[i], i + 1, sizeof(keys[i]));
+		pubkey_from_privkey(&keys[i], &pk);
+		node_id_from_pubkey(&id, &pk);
+		scids[i].u64 = 1000 + i;
+		chan = new_chan(rstate, &scids[i], &id, &other,
+				AMOUNT_SAT(1000000));
+		/* Pretend it's announced */
+		chan->bcast.timestamp = base;
+		directions[i] = node_id_eq(&chan->nodes[0]->id, &id) ? 0 : 1;
+	}
+
+	for (size_t r = 0; r < NUM_ROUNDS; r++) {
+		/* Every 12 hours, so it's never rate-limited */
+		u32 timestamp = base + r * 12 * 60 * 60;
+
+		for (size_t i = 0; i < NUM_CHANNELS; i++) {
+			/* Fee only changes every second round */
+			update = make_update(tmpctx, i, timestamp, r / 2);
+			if (r % 2 == 0)
+				expect_stored++;
+
+			for (size_t p = 0; p < NUM_PEERS; p++)
+				assert(!handle_channel_update(rstate, update,
+							      &peers[p],
+							      NULL, false));
+			assert(num_stored == expect_stored);
+		}
+	}
+
+	/* Duplicates are ignored before checking the signature... */
+	update = make_update(tmpctx, 0, base + (NUM_ROUNDS - 1) * 12 * 60 * 60,
+			     (NUM_ROUNDS - 1) / 2);
+	bad = tal_dup_talarr(tmpctx, u8, update);
+	bad[2 + 20] ^= 1;
+	assert(!handle_channel_update(rstate, bad, &peers[0], NULL, false));
+
+	/* ... but new ones are still checked. */
+	update = make_update(tmpctx, 0, base + NUM_ROUNDS * 12 * 60 * 60,
+			     NUM_ROUNDS);
+	bad = tal_dup_talarr(tmpctx, u8, update);
+	bad[2 + 20] ^= 1;
+	assert(handle_channel_update(rstate, bad, &peers[0], NULL, false));
+	assert(num_stored == expect_stored);
+	assert(!handle_channel_update(rstate, update, &peers[0], NULL, false));
+	assert(num_stored == ++expect_stored);
+
+	/* A fingerprint collision doesn't make us drop a real change. */
+	hc = &get_channel(rstate, &scids[1])->half[directions[1]];
+	update = make_update(tmpctx, 1, hc->bcast.timestamp + 1, 1000);
+	hc->bcast_fingerprint = cupdate_fingerprint(update);
+	assert(!handle_channel_update(rstate, update, &peers[0], NULL, false));
+	assert(num_stored == ++expect_stored);
+	assert(memeq(stored[hc->bcast.index],
+		     tal_bytelen(stored[hc->bcast.index]),
+		     update, tal_bytelen(update)));
+
+	tal_free(rstate);
+	timers_cleanup(&daemon->timers);
+	common_shutdown();
+	return 0;
+}
@@ -0,0 +1,211 @@
+#include "config.h"
+#include "../seeker.c"
+#include <ccan/err/err.h>
+#include <common/blinding.h>
+#include <common/channel_type.h>
+#include <common/ecdh.h>
+#include <common/json_stream.h>
+#include <common/onionreply.h>
+#include <common/setup.h>
+#include <common/wireaddr.h>
+#include <stdio.h>
+
+/* AUTOGENERATED MOCKS START */
+/* Generated stub for blinding_hash_e_and_ss */
+void blinding_hash_e_and_ss(const struct pubkey *e UNNEEDED,
+			    const struct secret *ss UNNEEDED,
+			    struct sha256 *sha UNNEEDED)
+{ fprintf(stderr, "blinding_hash_e_and_ss called!\n"); abort(); }
+/* Generated stub for blinding_next_privkey */
+bool blinding_next_privkey(const struct privkey *e UNNEEDED,
+			   const struct sha256 *h UNNEEDED,
+			   struct privkey *next UNNEEDED)
+{ fprintf(stderr, "blinding_next_privkey called!\n"); abort(); }
+/* Generated stub for blinding_next_pubkey */
+bool blinding_next_pubkey(const struct pubkey *pk UNNEEDED,
+			  const struct sha256 *h UNNEEDED,
+			  struct pubkey *next UNNEEDED)
+{ fprintf(stderr, "blinding_next_pubkey called!\n"); abort(); }
+/* Generated stub for new_reltimer_ */
+struct oneshot *new_reltimer_(struct timers *timers UNNEEDED,
+			      const tal_t *ctx UNNEEDED,
+			      struct timerel expire UNNEEDED,
+			      void (*cb)(void *) UNNEEDED, void *arg UNNEEDED)
+{ fprintf(stderr, "new_reltimer_ called!\n"); abort(); }
+/* Generated stub for query_channel_range */
+bool query_channel_range(struct daemon *daemon UNNEEDED,
+			 struct peer *peer UNNEEDED,
+			 u32 first_blocknum UNNEEDED, u32 number_of_blocks UNNEEDED,
+			 enum query_option_flags qflags UNNEEDED,
+			 void (*cb)(struct peer *peer_ UNNEEDED,
+				    u32 first_blocknum_ UNNEEDED,
+				    u32 number_of_blocks_ UNNEEDED,
+				    const struct range_query_reply *replies_))
+{ fprintf(stderr, "query_channel_range called!\n"); abort(); }
+/* Generated stub for query_short_channel_ids */
+bool query_short_channel_ids(struct daemon *daemon UNNEEDED,
+			     struct peer *peer UNNEEDED,
+			     const struct short_channel_id *scids UNNEEDED,
+			     const u8 *query_flags UNNEEDED,
+			     void (*cb)(struct peer *peer_ UNNEEDED, bool complete))
+{ fprintf(stderr, "query_short_channel_ids called!\n"); abort(); }
+/* Generated stub for random_select */
+bool random_select(double weight UNNEEDED, double *tot_weight UNNEEDED)
+{ fprintf(stderr, "random_select called!\n"); abort(); }
+/* Generated stub for status_failed */
+void status_failed(enum status_failreason code UNNEEDED,
+		   const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "status_failed called!\n"); abort(); }
+/* Generated stub for would_ratelimit_cupdate */
+bool would_ratelimit_cupdate(struct routing_state *rstate UNNEEDED,
+			     const struct half_chan *hc UNNEEDED,
+			     u32 timestamp UNNEEDED)
+{ fprintf(stderr, "would_ratelimit_cupdate called!\n"); abort(); }
+/* AUTOGENERATED MOCKS END */
+
+/* Simulated peers: the first NUM_GOOD are fast and never send junk. */
+#define NUM_PEERS 20
+#define NUM_GOOD 5
+#define NUM_TICKS 2000
+/* New gossip messages appearing in the network each tick */
+#define NEW_MSGS 50
+
+static struct peer *peers[NUM_PEERS];
+/* How long each peer takes to relay gossip to us. */
+static u32 peer_delay[NUM_PEERS];
+static size_t rand_start, rand_off;
+
+void status_fmt(enum log_level level UNNEEDED,
+		const struct node_id *peer UNNEEDED,
+		const char *fmt UNNEEDED, ...)
+{
+}
+
+void queue_peer_msg(struct peer *peer UNNEEDED, const u8 *msg TAKES)
+{
+	if (taken(msg))
+		tal_free(msg);
+}
+
+struct peer *first_random_peer(struct daemon *daemon UNNEEDED,
+			       struct peer_node_id_map_iter *it UNNEEDED)
+{
+	rand_start = pseudorand(NUM_PEERS);
+	rand_off = 0;
+	return peers[rand_start];
+}
+
+struct peer *next_random_peer(struct daemon *daemon UNNEEDED,
+			      const struct peer *first UNNEEDED,
+			      struct peer_node_id_map_iter *it UNNEEDED)
+{
+	if (++rand_off == NUM_PEERS)
+		return NULL;
+	return peers[(rand_start + rand_off) % NUM_PEERS];
+}
+
+static size_t peer_idx(const struct peer *peer)
+{
+	for (size_t i = 0; i < NUM_PEERS; i++)
+		if (peers[i] == peer)
+			return i;
+	abort();
+}
+
+/* Every gossiper sends every new message: the first to arrive is novel,
+ * the rest are redundant.  Bad peers also send a pile of stale gossip. */
+static void simulate_tick(struct seeker *seeker)
+{
+	for (size_t m = 0; m < NEW_MSGS; m++) {
+		struct peer *first = NULL;
+		u32 first_delay = UINT32_MAX;
+
+		for (size_t i = 0; i < ARRAY_SIZE(seeker->gossiper); i++) {
+			struct peer *p = seeker->gossiper[i].peer;
+			u32 delay;
+
+			if (!p)
+				continue;
+			delay = peer_delay[peer_idx(p)] + pseudorand(30);
+			p->gossip_bytes += GOSSIPER_AVG_MSG_BYTES;
+			if (delay < first_delay) {
+				first = p;
+				first_delay = delay;
+			}
+		}
+		if (!first)
+			continue;
+		first->gossip_counter++;
+		first->gossip_delay_total += first_delay;
+		first->gossip_delay_count++;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(seeker->gossiper); i++) {
+		struct peer *p = seeker->gossiper[i].peer;
+		if (p && peer_idx(p) >= NUM_GOOD)
+			p->gossip_bytes += NEW_MSGS * GOSSIPER_AVG_MSG_BYTES;
+	}
+}
+
+static size_t num_good_gossipers(const struct seeker *seeker)
+{
+	size_t num = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(seeker->gossiper); i++) {
+		if (seeker->gossiper[i].peer
+		    && peer_idx(seeker->gossiper[i].peer) < NUM_GOOD)
+			num++;
+	}
+	return num;
+}
+
+int main(int argc, char *argv[])
+{
+	struct seeker *seeker;
+	struct daemon *daemon;
+	size_t good_total = 0;
+
+	common_setup(argv[0]);
+	chainparams = chainparams_for_network("regtest");
+
+	daemon = tal(NULL, struct daemon);
+	daemon->rstate = talz(daemon, struct routing_state);
+	daemon->rstate->last_timestamp = 1000000;
+
+	seeker = tal(daemon, struct seeker);
+	seeker->daemon = daemon;
+	seeker->checks = 0;
+	seeker->preferred_peer = NULL;
+	seeker->random_peer = NULL;
+	for (size_t i = 0; i < ARRAY_SIZE(seeker->gossiper); i++)
+		seeker->gossiper[i].peer = NULL;
+	daemon->seeker = seeker;
+
+	for (size_t i = 0; i < NUM_PEERS; i++) {
+		peers[i] = talz(daemon, struct peer);
+		peers[i]->daemon = daemon;
+		peers[i]->gossip_queries_feature = true;
+		peers[i]->gossip_last_score = -1;
+		memset(&peers[i]->id, i, sizeof(peers[i]->id));
+		if (i < NUM_GOOD)
+			peer_delay[i] = 10 + i;
+		else
+			peer_delay[i] = 1000 + pseudorand(2000);
+	}
+
+	for (size_t t = 0; t < NUM_TICKS; t++) {
+		simulate_tick(seeker);
+		seeker->checks++;
+		maybe_rotate_gossipers(seeker);
+		if (t >= NUM_TICKS / 2)
+			good_total += num_good_gossipers(seeker);
+		clean_tmpctx();
+	}
+
+	/* Random selection would average 1.25; we should mostly have them
+	 * all, except briefly when we try someone new. */
+	assert(good_total * 10 >= (NUM_TICKS - NUM_TICKS / 2) * 45);
+
+	tal_free(daemon);
+	common_shutdown();
+}
@@ -75,11 +75,11 @@ bool nannounce_different(struct gossip_store *gs UNNEEDED,
 /* Generated stub for notleak_ */
 void *notleak_(void *ptr UNNEEDED, bool plus_children UNNEEDED)
 { fprintf(stderr, "notleak_ called!\n"); abort(); }
-/* Generated stub for peer_supplied_good_gossip */
-void peer_supplied_good_gossip(struct daemon *daemon UNNEEDED,
-			       const struct node_id *source_peer UNNEEDED,
-			       size_t amount UNNEEDED)
-{ fprintf(stderr, "peer_supplied_good_gossip called!\n"); abort(); }
+/* Generated stub for peer_supplied_novel_gossip */
+void peer_supplied_novel_gossip(struct daemon *daemon UNNEEDED,
+				const struct node_id *source_peer UNNEEDED,
+				u32 timestamp UNNEEDED)
+{ fprintf(stderr, "peer_supplied_novel_gossip called!\n"); abort(); }
 /* Generated stub for sanitize_error */
 char *sanitize_error(const tal_t *ctx UNNEEDED, const u8 *errmsg UNNEEDED,
 		     struct channel_id *channel_id UNNEEDED)
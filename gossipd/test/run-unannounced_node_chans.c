@@ -0,0 +1,275 @@
+#include "config.h"
+#include "../routing.c"
+#include "../seeker.c"
+#include "../common/timeout.c"
+#include <common/blinding.h>
+#include <common/channel_type.h>
+#include <common/ecdh.h>
+#include <common/json_stream.h>
+#include <common/onionreply.h>
+#include <common/setup.h>
+#include <stdio.h>
+
+/* AUTOGENERATED MOCKS START */
+/* Generated stub for blinding_hash_e_and_ss */
+void blinding_hash_e_and_ss(const struct pubkey *e UNNEEDED,
+			    const struct secret *ss UNNEEDED,
+			    struct sha256 *sha UNNEEDED)
+{ fprintf(stderr, "blinding_hash_e_and_ss called!\n"); abort(); }
+/* Generated stub for blinding_next_privkey */
+bool blinding_next_privkey(const struct privkey *e UNNEEDED,
+			   const struct sha256 *h UNNEEDED,
+			   struct privkey *next UNNEEDED)
+{ fprintf(stderr, "blinding_next_privkey called!\n"); abort(); }
+/* Generated stub for blinding_next_pubkey */
+bool blinding_next_pubkey(const struct pubkey *pk UNNEEDED,
+			  const struct sha256 *h UNNEEDED,
+			  struct pubkey *next UNNEEDED)
+{ fprintf(stderr, "blinding_next_pubkey called!\n"); abort(); }
+/* Generated stub for cupdate_different */
+bool cupdate_different(struct gossip_store *gs UNNEEDED,
+		       const struct half_chan *hc UNNEEDED,
+		       const u8 *cupdate UNNEEDED)
+{ fprintf(stderr, "cupdate_different called!\n"); abort(); }
+/* Generated stub for first_random_peer */
+struct peer *first_random_peer(struct daemon *daemon UNNEEDED,
+			       struct peer_node_id_map_iter *it UNNEEDED)
+{ fprintf(stderr, "first_random_peer called!\n"); abort(); }
+/* Generated stub for gossip_store_add */
+u64 gossip_store_add(struct gossip_store *gs UNNEEDED, const u8 *gossip_msg UNNEEDED,
+		     u32 timestamp UNNEEDED, bool zombie UNNEEDED, bool spam UNNEEDED,
+		     const u8 *addendum UNNEEDED)
+{ fprintf(stderr, "gossip_store_add called!\n"); abort(); }
+/* Generated stub for gossip_store_add_private_update */
+u64 gossip_store_add_private_update(struct gossip_store *gs UNNEEDED, const u8 *update UNNEEDED)
+{ fprintf(stderr, "gossip_store_add_private_update called!\n"); abort(); }
+/* Generated stub for gossip_store_get */
+const u8 *gossip_store_get(const tal_t *ctx UNNEEDED,
+			   struct gossip_store *gs UNNEEDED,
+			   u64 offset UNNEEDED)
+{ fprintf(stderr, "gossip_store_get called!\n"); abort(); }
+/* Generated stub for gossip_store_get_private_update */
+const u8 *gossip_store_get_private_update(const tal_t *ctx UNNEEDED,
+					  struct gossip_store *gs UNNEEDED,
+					  u64 offset UNNEEDED)
+{ fprintf(stderr, "gossip_store_get_private_update called!\n"); abort(); }
+/* Generated stub for gossip_store_mark_channel_deleted */
+void gossip_store_mark_channel_deleted(struct gossip_store *gs UNNEEDED,
+				       const struct short_channel_id *scid UNNEEDED)
+{ fprintf(stderr, "gossip_store_mark_channel_deleted called!\n"); abort(); }
+/* Generated stub for memleak_add_helper_ */
+void memleak_add_helper_(const tal_t *p UNNEEDED, void (*cb)(struct htable *memtable UNNEEDED,
+						    const tal_t *)){ }
+/* Generated stub for memleak_scan_htable */
+void memleak_scan_htable(struct htable *memtable UNNEEDED, const struct htable *ht UNNEEDED)
+{ fprintf(stderr, "memleak_scan_htable called!\n"); abort(); }
+/* Generated stub for memleak_scan_intmap_ */
+void memleak_scan_intmap_(struct htable *memtable UNNEEDED, const struct intmap *m UNNEEDED)
+{ fprintf(stderr, "memleak_scan_intmap_ called!\n"); abort(); }
+/* Generated stub for nannounce_different */
+bool nannounce_different(struct gossip_store *gs UNNEEDED,
+			 const struct node *node UNNEEDED,
+			 const u8 *nannounce UNNEEDED,
+			 bool *only_missing_tlv UNNEEDED)
+{ fprintf(stderr, "nannounce_different called!\n"); abort(); }
+/* Generated stub for next_random_peer */
+struct peer *next_random_peer(struct daemon *daemon UNNEEDED,
+			      const struct peer *first UNNEEDED,
+			      struct peer_node_id_map_iter *it UNNEEDED)
+{ fprintf(stderr, "next_random_peer called!\n"); abort(); }
+/* Generated stub for notleak_ */
+void *notleak_(void *ptr UNNEEDED, bool plus_children UNNEEDED)
+{ fprintf(stderr, "notleak_ called!\n"); abort(); }
+/* Generated stub for peer_supplied_novel_gossip */
+void peer_supplied_novel_gossip(struct daemon *daemon UNNEEDED,
+				const struct node_id *source_peer UNNEEDED,
+				u32 timestamp UNNEEDED)
+{ fprintf(stderr, "peer_supplied_novel_gossip called!\n"); abort(); }
+/* Generated stub for query_channel_range */
+bool query_channel_range(struct daemon *daemon UNNEEDED,
+			 struct peer *peer UNNEEDED,
+			 u32 first_blocknum UNNEEDED, u32 number_of_blocks UNNEEDED,
+			 enum query_option_flags qflags UNNEEDED,
+			 void (*cb)(struct peer *peer_ UNNEEDED,
+				    u32 first_blocknum_ UNNEEDED,
+				    u32 number_of_blocks_ UNNEEDED,
+				    const struct range_query_reply *replies_))
+{ fprintf(stderr, "query_channel_range called!\n"); abort(); }
+/* Generated stub for query_short_channel_ids */
+bool query_short_channel_ids(struct daemon *daemon UNNEEDED,
+			     struct peer *peer UNNEEDED,
+			     const struct short_channel_id *scids UNNEEDED,
+			     const u8 *query_flags UNNEEDED,
+			     void (*cb)(struct peer *peer_ UNNEEDED, bool complete))
+{ fprintf(stderr, "query_short_channel_ids called!\n"); abort(); }
+/* Generated stub for queue_peer_msg */
+void queue_peer_msg(struct peer *peer UNNEEDED, const u8 *msg TAKES UNNEEDED)
+{ fprintf(stderr, "queue_peer_msg called!\n"); abort(); }
+/* Generated stub for random_select */
+bool random_select(double weight UNNEEDED, double *tot_weight UNNEEDED)
+{ fprintf(stderr, "random_select called!\n"); abort(); }
+/* Generated stub for sanitize_error */
+char *sanitize_error(const tal_t *ctx UNNEEDED, const u8 *errmsg UNNEEDED,
+		     struct channel_id *channel_id UNNEEDED)
+{ fprintf(stderr, "sanitize_error called!\n"); abort(); }
+/* Generated stub for status_failed */
+void status_failed(enum status_failreason code UNNEEDED,
+		   const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "status_failed called!\n"); abort(); }
+/* Generated stub for status_fmt */
+void status_fmt(enum log_level level UNNEEDED,
+		const struct node_id *peer UNNEEDED,
+		const char *fmt UNNEEDED, ...)
+
+{ fprintf(stderr, "status_fmt called!\n"); abort(); }
+/* Generated stub for towire_warningfmt */
+u8 *towire_warningfmt(const tal_t *ctx UNNEEDED,
+		      const struct channel_id *channel UNNEEDED,
+		      const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "towire_warningfmt called!\n"); abort(); }
+/* AUTOGENERATED MOCKS END */
+
+/* NOOP stub for gossip_store_new */
+struct gossip_store *gossip_store_new(struct routing_state *rstate UNNEEDED)
+{
+	return NULL;
+}
+
+/* NOOP stub for gossip_store_delete */
+void gossip_store_delete(struct gossip_store *gs UNNEEDED,
+			 struct broadcastable *bcast,
+			 int type UNNEEDED)
+{
+	bcast->index = 0;
+}
+
+static void test_chan(struct routing_state *rstate,
+			     u64 scid_u64,
+			     const struct node_id *id1,
+			     const struct node_id *id2,
+			     bool public)
+{
+	struct short_channel_id scid;
+	struct chan *chan;
+
+	scid.u64 = scid_u64;
+	chan = new_chan(rstate, &scid, id1, id2, AMOUNT_SAT(100000));
+	/* As if loaded from the store, so it doesn't get written. */
+	if (public)
+		add_channel_announce_to_broadcast(rstate, chan, NULL,
+						  100, scid_u64);
+}
+
+static void announce_node(struct routing_state *rstate,
+			  const struct node_id *id, u32 index)
+{
+	struct node *node = get_node(rstate, id);
+
+	node->bcast.index = node->rgraph.index = index;
+	update_unannounced_node_chans(rstate, node);
+}
+
+static bool in_index(struct routing_state *rstate, u64 scid_u64)
+{
+	return uintmap_get(&rstate->unannounced_node_chans, scid_u64) != NULL;
+}
+
+int main(int argc, char *argv[])
+{
+	struct routing_state *rstate;
+	struct daemon *daemon;
+	struct node_id a, b, c, d, e;
+	struct short_channel_id *scids;
+	u8 *query_flags;
+
+	common_setup(argv[0]);
+
+	daemon = tal(tmpctx, struct daemon);
+	memset(&daemon->id, 0xFF, sizeof(daemon->id));
+	timers_init(&daemon->timers, time_mono());
+	rstate = new_routing_state(tmpctx, daemon, NULL, false, false);
+
+	memset(&a, 1, sizeof(a));
+	memset(&b, 2, sizeof(b));
+	memset(&c, 3, sizeof(c));
+	memset(&d, 4, sizeof(d));
+	memset(&e, 5, sizeof(e));
+
+	/* a - b - c are public, c - d - e are private. */
+	test_chan(rstate, 100, &a, &b, true);
+	test_chan(rstate, 200, &b, &c, true);
+	test_chan(rstate, 300, &c, &d, false);
+	test_chan(rstate, 400, &d, &e, false);
+
+	/* Private channels are never in the index. */
+	assert(in_index(rstate, 100));
+	assert(in_index(rstate, 200));
+	assert(!in_index(rstate, 300));
+	assert(!in_index(rstate, 400));
+
+	assert(get_unannounced_nodes(tmpctx, rstate, 10, &scids, &query_flags));
+	assert(tal_count(scids) == 2);
+	assert(scids[0].u64 == 100);
+	assert(scids[1].u64 == 200);
+	assert(query_flags[0] == (SCID_QF_NODE1|SCID_QF_NODE2));
+	assert(query_flags[1] == (SCID_QF_NODE1|SCID_QF_NODE2));
+
+	/* b's announcement leaves a and c to find. */
+	announce_node(rstate, &b, 1000);
+	assert(in_index(rstate, 100));
+	assert(in_index(rstate, 200));
+	assert(get_unannounced_nodes(tmpctx, rstate, 10, &scids, &query_flags));
+	assert(tal_count(scids) == 2);
+	assert(query_flags[0] == SCID_QF_NODE1);
+	assert(query_flags[1] == SCID_QF_NODE2);
+
+	/* Once both ends are announced, the channel leaves the index. */
+	announce_node(rstate, &a, 1001);
+	assert(!in_index(rstate, 100));
+	assert(in_index(rstate, 200));
+	assert(get_unannounced_nodes(tmpctx, rstate, 10, &scids, &query_flags));
+	assert(tal_count(scids) == 1);
+	assert(scids[0].u64 == 200);
+	assert(query_flags[0] == SCID_QF_NODE2);
+
+	/* d has only private channels: announcing it changes nothing. */
+	announce_node(rstate, &d, 1002);
+	assert(!in_index(rstate, 300));
+	assert(!in_index(rstate, 400));
+	assert(get_unannounced_nodes(tmpctx, rstate, 10, &scids, &query_flags));
+	assert(tal_count(scids) == 1);
+
+	/* Freeing a channel removes it from the index. */
+	free_chan(rstate, get_channel(rstate, &scids[0]));
+	assert(!in_index(rstate, 200));
+
+	/* b has no channel_updates left, so it loses its announcement
+	 * and its remaining channel is unannounced again. */
+	assert(!get_node(rstate, &b)->bcast.index);
+	assert(in_index(rstate, 100));
+	assert(get_unannounced_nodes(tmpctx, rstate, 10, &scids, &query_flags));
+	assert(tal_count(scids) == 1);
+	assert(scids[0].u64 == 100);
+	assert(query_flags[0] == SCID_QF_NODE2);
+
+	announce_node(rstate, &b, 1003);
+	assert(uintmap_empty(&rstate->unannounced_node_chans));
+	assert(!get_unannounced_nodes(tmpctx, rstate, 10, &scids, &query_flags));
+
+	/* A new public channel to announced a and unannounced e. */
+	test_chan(rstate, 500, &a, &e, true);
+	assert(in_index(rstate, 500));
+	assert(get_unannounced_nodes(tmpctx, rstate, 10, &scids, &query_flags));
+	assert(tal_count(scids) == 1);
+	assert(query_flags[0] == SCID_QF_NODE2);
+
+	/* Announcing e finishes it. */
+	announce_node(rstate, &e, 1004);
+	assert(!in_index(rstate, 500));
+	assert(uintmap_empty(&rstate->unannounced_node_chans));
+
+	tal_free(rstate);
+	timers_cleanup(&daemon->timers);
+	common_shutdown();
+	return 0;
+}
@@ -174,6 +174,7 @@ static struct io_plan *client_read_next(struct io_conn *conn, struct client *c)
  * closed by the other end. */
 static void destroy_client(struct client *c)
 {
+	hsmd_client_closed(c->hsmd_client);
 	if (!uintmap_del(&clients, c->dbid))
 		status_failed(STATUS_FAIL_INTERNAL_ERROR,
 			      "Failed to remove client dbid %"PRIu64, c->dbid);
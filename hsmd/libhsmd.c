@@ -308,6 +308,100 @@ static void get_channel_seed(const struct node_id *peer_id, u64 dbid,
 		    info, strlen(info));
 }
 
+/*~ Every commitment, HTLC and announcement signature needs keys derived from
+ * the channel seed: that's two HKDFs for the seed, another for the keys, and
+ * a scalar multiplication for each basepoint.  On a busy channel we do this
+ * for every HTLC, so we keep a small cache of the results.
+ *
+ * It's a set-associative cache: the dbid picks the set (they're handed out
+ * sequentially, so this spreads nicely), and we evict the least-recently
+ * used entry in the set.  It's mlocked alongside secretstuff, and wiped
+ * when an entry is evicted or its client goes away. */
+#define CHANNEL_KEYS_CACHE_WAYS 4
+#define CHANNEL_KEYS_CACHE_SETS 64
+
+struct channel_keys {
+	struct node_id peer_id;
+	u64 dbid;
+	/* 0 if this entry is unused, otherwise bumped on each use. */
+	u64 last_used;
+	struct pubkey funding_pubkey;
+	struct basepoints basepoints;
+	struct secrets secrets;
+	struct sha256 shaseed;
+};
+
+static struct {
+	struct channel_keys keys[CHANNEL_KEYS_CACHE_SETS][CHANNEL_KEYS_CACHE_WAYS];
+	u64 counter;
+} channel_keys_cache;
+
+static void wipe_channel_keys(struct channel_keys *keys)
+{
+	sodium_memzero(keys, sizeof(*keys));
+}
+
+static void wipe_channel_keys_cache(void)
+{
+	sodium_memzero(&channel_keys_cache, sizeof(channel_keys_cache));
+}
+
+static struct channel_keys *channel_keys_set(u64 dbid)
+{
+	return channel_keys_cache.keys[dbid % CHANNEL_KEYS_CACHE_SETS];
+}
+
+/*~ This gets all the keys for a particular channel, deriving them only if
+ * they're not already in the cache.  The result is only valid until the next
+ * call! */
+static const struct channel_keys *get_channel_keys(const struct node_id *peer_id,
+						   u64 dbid)
+{
+	struct channel_keys *set = channel_keys_set(dbid), *victim = &set[0];
+	struct secret channel_seed;
+
+	for (size_t i = 0; i < CHANNEL_KEYS_CACHE_WAYS; i++) {
+		if (set[i].last_used
+		    && set[i].dbid == dbid
+		    && node_id_eq(&set[i].peer_id, peer_id)) {
+			set[i].last_used = ++channel_keys_cache.counter;
+			return &set[i];
+		}
+		if (set[i].last_used < victim->last_used)
+			victim = &set[i];
+	}
+
+	wipe_channel_keys(victim);
+	get_channel_seed(peer_id, dbid, &channel_seed);
+	if (!derive_basepoints(&channel_seed, &victim->funding_pubkey,
+			       &victim->basepoints, &victim->secrets,
+			       &victim->shaseed))
+		hsmd_status_failed(STATUS_FAIL_INTERNAL_ERROR,
+				   "Failed deriving channel keys");
+	sodium_memzero(&channel_seed, sizeof(channel_seed));
+
+	victim->peer_id = *peer_id;
+	victim->dbid = dbid;
+	victim->last_used = ++channel_keys_cache.counter;
+	return victim;
+}
+
+void hsmd_client_closed(const struct hsmd_client *client)
+{
+	struct channel_keys *set = channel_keys_set(client->dbid);
+
+	/* Main clients (gossipd, connectd, lightningd) have no channel. */
+	if (client->dbid == 0)
+		return;
+
+	for (size_t i = 0; i < CHANNEL_KEYS_CACHE_WAYS; i++) {
+		if (set[i].last_used
+		    && set[i].dbid == client->dbid
+		    && node_id_eq(&set[i].peer_id, &client->id))
+			wipe_channel_keys(&set[i]);
+	}
+}
+
 /* ~This stub implementation is overriden by fully validating signers
  * that need to manage per-channel state. */
 static u8 *handle_new_channel(struct hsmd_client *c, const u8 *msg_in)
@@ -388,12 +482,9 @@ static u8 *handle_ready_channel(struct hsmd_client *c, const u8 *msg_in)
 static void hsm_unilateral_close_privkey(struct privkey *dst,
 					 struct unilateral_close_info *info)
 {
-	struct secret channel_seed;
-	struct basepoints basepoints;
-	struct secrets secrets;
+	const struct channel_keys *keys;
 
-	get_channel_seed(&info->peer_id, info->channel_id, &channel_seed);
-	derive_basepoints(&channel_seed, NULL, &basepoints, &secrets, NULL);
+	keys = get_channel_keys(&info->peer_id, info->channel_id);
 
 	/* BOLT #3:
 	 *
@@ -405,9 +496,9 @@ static void hsm_unilateral_close_privkey(struct privkey *dst,
 	/* In our UTXO representation, this is indicated by a NULL
 	 * commitment_point. */
 	if (!info->commitment_point)
-		dst->secret = secrets.payment_basepoint_secret;
-	else if (!derive_simple_privkey(&secrets.payment_basepoint_secret,
-					&basepoints.payment,
+		dst->secret = keys->secrets.payment_basepoint_secret;
+	else if (!derive_simple_privkey(&keys->secrets.payment_basepoint_secret,
+					&keys->basepoints.payment,
 					info->commitment_point,
 					dst)) {
 		hsmd_status_failed(STATUS_FAIL_INTERNAL_ERROR,
@@ -814,18 +905,15 @@ static u8 *handle_get_channel_basepoints(struct hsmd_client *c,
 {
 	struct node_id peer_id;
 	u64 dbid;
-	struct secret seed;
-	struct basepoints basepoints;
-	struct pubkey funding_pubkey;
+	const struct channel_keys *keys;
 
 	if (!fromwire_hsmd_get_channel_basepoints(msg_in, &peer_id, &dbid))
 		return hsmd_status_malformed_request(c, msg_in);
 
-	get_channel_seed(&peer_id, dbid, &seed);
-	derive_basepoints(&seed, &funding_pubkey, &basepoints, NULL, NULL);
+	keys = get_channel_keys(&peer_id, dbid);
 
-	return towire_hsmd_get_channel_basepoints_reply(NULL, &basepoints,
-							&funding_pubkey);
+	return towire_hsmd_get_channel_basepoints_reply(NULL, &keys->basepoints,
+							&keys->funding_pubkey);
 }
 
 /*~ The client has asked us to extract the shared secret from an EC Diffie
@@ -861,20 +949,15 @@ static u8 *handle_ecdh(struct hsmd_client *c, const u8 *msg_in)
  * secrets.  We carefully check that this is true, here. */
 static u8 *handle_check_future_secret(struct hsmd_client *c, const u8 *msg_in)
 {
-	struct secret channel_seed;
-	struct sha256 shaseed;
+	const struct channel_keys *keys;
 	u64 n;
 	struct secret secret, suggested;
 
 	if (!fromwire_hsmd_check_future_secret(msg_in, &n, &suggested))
 		return hsmd_status_malformed_request(c, msg_in);
 
-	get_channel_seed(&c->id, c->dbid, &channel_seed);
-	if (!derive_shaseed(&channel_seed, &shaseed))
-		return hsmd_status_bad_request_fmt(c, msg_in,
-						   "bad derive_shaseed");
-
-	if (!per_commit_secret(&shaseed, &secret, n))
+	keys = get_channel_keys(&c->id, c->dbid);
+	if (!per_commit_secret(&keys->shaseed, &secret, n))
 		return hsmd_status_bad_request_fmt(
 		    c, msg_in, "bad commit secret #%" PRIu64, n);
 
@@ -937,9 +1020,7 @@ static u8 *handle_cannouncement_sig(struct hsmd_client *c, const u8 *msg_in)
 	struct sha256_double hash;
 	u8 *reply;
 	u8 *ca;
-	struct pubkey funding_pubkey;
-	struct privkey funding_privkey;
-	struct secret channel_seed;
+	const struct channel_keys *keys;
 
 	/*~ You'll find FIXMEs like this scattered through the code.
 	 * Sometimes they suggest simple improvements which someone like
@@ -949,9 +1030,8 @@ static u8 *handle_cannouncement_sig(struct hsmd_client *c, const u8 *msg_in)
 	/*~ Christian uses TODO(cdecker) or FIXME(cdecker), but I'm sure he won't
 	 * mind if you fix this for him! */
 
-	/* FIXME: We should cache these. */
-	get_channel_seed(&c->id, c->dbid, &channel_seed);
-	derive_funding_key(&channel_seed, &funding_pubkey, &funding_privkey);
+	/* These are cached: see get_channel_keys() */
+	keys = get_channel_keys(&c->id, c->dbid);
 
 	/*~ fromwire_ routines which need to do allocation take a tal context
 	 * as their first field; tmpctx is good here since we won't need it
@@ -971,7 +1051,7 @@ static u8 *handle_cannouncement_sig(struct hsmd_client *c, const u8 *msg_in)
 	sha256_double(&hash, ca + offset, tal_count(ca) - offset);
 
 	sign_hash(&node_pkey, &hash, &node_sig);
-	sign_hash(&funding_privkey, &hash, &bitcoin_sig);
+	sign_hash(&keys->secrets.funding_privkey, &hash, &bitcoin_sig);
 
 	reply = towire_hsmd_cannouncement_sig_reply(NULL, &node_sig,
 						   &bitcoin_sig);
@@ -1077,8 +1157,7 @@ static u8 *handle_channel_update_sig(struct hsmd_client *c, const u8 *msg_in)
  * the previous commitment transaction. */
 static u8 *handle_get_per_commitment_point(struct hsmd_client *c, const u8 *msg_in)
 {
-	struct secret channel_seed;
-	struct sha256 shaseed;
+	const struct channel_keys *keys;
 	struct pubkey per_commitment_point;
 	u64 n;
 	struct secret *old_secret;
@@ -1086,17 +1165,14 @@ static u8 *handle_get_per_commitment_point(struct hsmd_client *c, const u8 *msg_
 	if (!fromwire_hsmd_get_per_commitment_point(msg_in, &n))
 		return hsmd_status_malformed_request(c, msg_in);
 
-	get_channel_seed(&c->id, c->dbid, &channel_seed);
-	if (!derive_shaseed(&channel_seed, &shaseed))
-		return hsmd_status_bad_request(c, msg_in, "bad derive_shaseed");
-
-	if (!per_commit_point(&shaseed, &per_commitment_point, n))
+	keys = get_channel_keys(&c->id, c->dbid);
+	if (!per_commit_point(&keys->shaseed, &per_commitment_point, n))
 		return hsmd_status_bad_request_fmt(
 		    c, msg_in, "bad per_commit_point %" PRIu64, n);
 
 	if (n >= 2) {
 		old_secret = tal(tmpctx, struct secret);
-		if (!per_commit_secret(&shaseed, old_secret, n - 2)) {
+		if (!per_commit_secret(&keys->shaseed, old_secret, n - 2)) {
 			return hsmd_status_bad_request_fmt(
 			    c, msg_in, "Cannot derive secret %" PRIu64, n - 2);
 		}
@@ -1129,11 +1205,10 @@ static u8 *handle_sign_withdrawal_tx(struct hsmd_client *c, const u8 *msg_in)
 /* This is used by closingd to sign off on a mutual close tx. */
 static u8 *handle_sign_mutual_close_tx(struct hsmd_client *c, const u8 *msg_in)
 {
-	struct secret channel_seed;
+	const struct channel_keys *keys;
 	struct bitcoin_tx *tx;
-	struct pubkey remote_funding_pubkey, local_funding_pubkey;
+	struct pubkey remote_funding_pubkey;
 	struct bitcoin_signature sig;
-	struct secrets secrets;
 	const u8 *funding_wscript;
 
 	if (!fromwire_hsmd_sign_mutual_close_tx(tmpctx, msg_in,
@@ -1145,16 +1220,14 @@ static u8 *handle_sign_mutual_close_tx(struct hsmd_client *c, const u8 *msg_in)
 	/* FIXME: We should know dust level, decent fee range and
 	 * balances, and final_keyindex, and thus be able to check tx
 	 * outputs! */
-	get_channel_seed(&c->id, c->dbid, &channel_seed);
-	derive_basepoints(&channel_seed,
-			  &local_funding_pubkey, NULL, &secrets, NULL);
+	keys = get_channel_keys(&c->id, c->dbid);
 
 	funding_wscript = bitcoin_redeem_2of2(tmpctx,
-					      &local_funding_pubkey,
+					      &keys->funding_pubkey,
 					      &remote_funding_pubkey);
 	sign_tx_input(tx, 0, NULL, funding_wscript,
-		      &secrets.funding_privkey,
-		      &local_funding_pubkey,
+		      &keys->secrets.funding_privkey,
+		      &keys->funding_pubkey,
 		      SIGHASH_ALL, &sig);
 
 	return towire_hsmd_sign_tx_reply(NULL, &sig);
@@ -1177,9 +1250,8 @@ static u8 *do_sign_local_htlc_tx(struct hsmd_client *c,
 				 const u8 *wscript,
 				 bool option_anchor_outputs)
 {
-	struct secret channel_seed, htlc_basepoint_secret;
-	struct sha256 shaseed;
-	struct pubkey per_commitment_point, htlc_basepoint;
+	const struct channel_keys *keys;
+	struct pubkey per_commitment_point;
 	struct bitcoin_signature sig;
 	struct privkey htlc_privkey;
 	struct pubkey htlc_pubkey;
@@ -1190,24 +1262,14 @@ static u8 *do_sign_local_htlc_tx(struct hsmd_client *c,
 						   input_num, tx->wtx->num_inputs);
 
 	tx->chainparams = c->chainparams;
-	get_channel_seed(peerid, channel_dbid, &channel_seed);
-
-	if (!derive_shaseed(&channel_seed, &shaseed))
-		return hsmd_status_bad_request_fmt(c, msg_in,
-						   "bad derive_shaseed");
+	keys = get_channel_keys(peerid, channel_dbid);
 
-	if (!per_commit_point(&shaseed, &per_commitment_point, commit_num))
+	if (!per_commit_point(&keys->shaseed, &per_commitment_point, commit_num))
 		return hsmd_status_bad_request_fmt(
 		    c, msg_in, "bad per_commitment_point %" PRIu64, commit_num);
 
-	if (!derive_htlc_basepoint(&channel_seed,
-				   &htlc_basepoint,
-				   &htlc_basepoint_secret))
-		return hsmd_status_bad_request_fmt(
-		    c, msg_in, "Failed deriving htlc basepoint");
-
-	if (!derive_simple_privkey(&htlc_basepoint_secret,
-				   &htlc_basepoint,
+	if (!derive_simple_privkey(&keys->secrets.htlc_basepoint_secret,
+				   &keys->basepoints.htlc,
 				   &per_commitment_point,
 				   &htlc_privkey))
 		return hsmd_status_bad_request_fmt(
@@ -1282,11 +1344,9 @@ static u8 *handle_sign_any_local_htlc_tx(struct hsmd_client *c, const u8 *msg_in
  * HTLC transactions. */
 static u8 *handle_sign_remote_htlc_tx(struct hsmd_client *c, const u8 *msg_in)
 {
-	struct secret channel_seed;
+	const struct channel_keys *keys;
 	struct bitcoin_tx *tx;
 	struct bitcoin_signature sig;
-	struct secrets secrets;
-	struct basepoints basepoints;
 	struct pubkey remote_per_commit_point;
 	u8 *wscript;
 	struct privkey htlc_privkey;
@@ -1300,17 +1360,16 @@ static u8 *handle_sign_remote_htlc_tx(struct hsmd_client *c, const u8 *msg_in)
 		return hsmd_status_malformed_request(c, msg_in);
 
 	tx->chainparams = c->chainparams;
-	get_channel_seed(&c->id, c->dbid, &channel_seed);
-	derive_basepoints(&channel_seed, NULL, &basepoints, &secrets, NULL);
+	keys = get_channel_keys(&c->id, c->dbid);
 
-	if (!derive_simple_privkey(&secrets.htlc_basepoint_secret,
-				   &basepoints.htlc,
+	if (!derive_simple_privkey(&keys->secrets.htlc_basepoint_secret,
+				   &keys->basepoints.htlc,
 				   &remote_per_commit_point,
 				   &htlc_privkey))
 		return hsmd_status_bad_request_fmt(
 		    c, msg_in, "Failed deriving htlc privkey");
 
-	if (!derive_simple_key(&basepoints.htlc,
+	if (!derive_simple_key(&keys->basepoints.htlc,
 			       &remote_per_commit_point,
 			       &htlc_pubkey))
 		return hsmd_status_bad_request_fmt(
@@ -1340,11 +1399,10 @@ static u8 *handle_sign_remote_htlc_tx(struct hsmd_client *c, const u8 *msg_in)
 /* FIXME: make sure it meets some criteria? */
 static u8 *handle_sign_remote_commitment_tx(struct hsmd_client *c, const u8 *msg_in)
 {
-	struct pubkey remote_funding_pubkey, local_funding_pubkey;
-	struct secret channel_seed;
+	struct pubkey remote_funding_pubkey;
+	const struct channel_keys *keys;
 	struct bitcoin_tx *tx;
 	struct bitcoin_signature sig;
-	struct secrets secrets;
 	const u8 *funding_wscript;
 	struct pubkey remote_per_commit;
 	bool option_static_remotekey;
@@ -1371,16 +1429,14 @@ static u8 *handle_sign_remote_commitment_tx(struct hsmd_client *c, const u8 *msg
 		return hsmd_status_bad_request_fmt(c, msg_in,
 						   "tx must have > 0 outputs");
 
-	get_channel_seed(&c->id, c->dbid, &channel_seed);
-	derive_basepoints(&channel_seed,
-			  &local_funding_pubkey, NULL, &secrets, NULL);
+	keys = get_channel_keys(&c->id, c->dbid);
 
 	funding_wscript = bitcoin_redeem_2of2(tmpctx,
-					      &local_funding_pubkey,
+					      &keys->funding_pubkey,
 					      &remote_funding_pubkey);
 	sign_tx_input(tx, 0, NULL, funding_wscript,
-		      &secrets.funding_privkey,
-		      &local_funding_pubkey,
+		      &keys->secrets.funding_privkey,
+		      &keys->funding_pubkey,
 		      SIGHASH_ALL,
 		      &sig);
 
@@ -1399,8 +1455,7 @@ static u8 *do_sign_penalty_to_us(struct hsmd_client *c,
 				 struct bitcoin_tx *tx,
 				 const u8 *wscript)
 {
-	struct secret channel_seed, revocation_basepoint_secret;
-	struct pubkey revocation_basepoint;
+	const struct channel_keys *keys;
 	struct pubkey point;
 	struct privkey privkey;
 
@@ -1410,16 +1465,10 @@ static u8 *do_sign_penalty_to_us(struct hsmd_client *c,
 		return hsmd_status_bad_request_fmt(c, msg_in,
 						   "Failed deriving pubkey");
 
-	get_channel_seed(peerid, channel_dbid, &channel_seed);
-	if (!derive_revocation_basepoint(&channel_seed,
-					 &revocation_basepoint,
-					 &revocation_basepoint_secret))
-		return hsmd_status_bad_request_fmt(
-		    c, msg_in, "Failed deriving revocation basepoint");
-
-	if (!derive_revocation_privkey(&revocation_basepoint_secret,
+	keys = get_channel_keys(peerid, channel_dbid);
+	if (!derive_revocation_privkey(&keys->secrets.revocation_basepoint_secret,
 				       revocation_secret,
-				       &revocation_basepoint,
+				       &keys->basepoints.revocation,
 				       &point,
 				       &privkey))
 		return hsmd_status_bad_request_fmt(
@@ -1472,9 +1521,7 @@ static u8 *handle_sign_anchorspend(struct hsmd_client *c, const u8 *msg_in)
 	u64 dbid;
 	struct utxo **utxos;
 	struct wally_psbt *psbt;
-	struct secret seed;
-	struct pubkey local_funding_pubkey;
-	struct secrets secrets;
+	const struct channel_keys *keys;
 	int ret;
 
 	/* FIXME: Check output goes to us. */
@@ -1485,12 +1532,11 @@ static u8 *handle_sign_anchorspend(struct hsmd_client *c, const u8 *msg_in)
 	/* Sign all the UTXOs */
 	sign_our_inputs(utxos, psbt);
 
-	get_channel_seed(&peer_id, dbid, &seed);
-	derive_basepoints(&seed, &local_funding_pubkey, NULL, &secrets, NULL);
+	keys = get_channel_keys(&peer_id, dbid);
 
 	tal_wally_start();
-	ret = wally_psbt_sign(psbt, secrets.funding_privkey.secret.data,
-			      sizeof(secrets.funding_privkey.secret.data),
+	ret = wally_psbt_sign(psbt, keys->secrets.funding_privkey.secret.data,
+			      sizeof(keys->secrets.funding_privkey.secret.data),
 			      EC_FLAG_GRIND_R);
 	tal_wally_end(psbt);
 	if (ret != WALLY_OK) {
@@ -1498,7 +1544,7 @@ static u8 *handle_sign_anchorspend(struct hsmd_client *c, const u8 *msg_in)
 				   "Received wally_err attempting to "
 				    "sign anchor key %s. PSBT: %s",
 				    type_to_string(tmpctx, struct pubkey,
-						   &local_funding_pubkey),
+						   &keys->funding_pubkey),
 				    type_to_string(tmpctx, struct wally_psbt,
 						   psbt));
 	}
@@ -1535,14 +1581,13 @@ static u8 *handle_sign_htlc_tx_mingle(struct hsmd_client *c, const u8 *msg_in)
 /* FIXME: Ensure HSM never does this twice for same dbid! */
 static u8 *handle_sign_commitment_tx(struct hsmd_client *c, const u8 *msg_in)
 {
-	struct pubkey remote_funding_pubkey, local_funding_pubkey;
+	struct pubkey remote_funding_pubkey;
 	struct node_id peer_id;
 	u64 dbid;
-	struct secret channel_seed;
+	const struct channel_keys *keys;
 	struct bitcoin_tx *tx;
 	struct bitcoin_signature sig;
 	u64 commit_num;
-	struct secrets secrets;
 	const u8 *funding_wscript;
 
 	if (!fromwire_hsmd_sign_commitment_tx(tmpctx, msg_in,
@@ -1563,19 +1608,17 @@ static u8 *handle_sign_commitment_tx(struct hsmd_client *c, const u8 *msg_in)
 		return hsmd_status_bad_request_fmt(c, msg_in,
 						   "tx must have > 0 outputs");
 
-	get_channel_seed(&peer_id, dbid, &channel_seed);
-	derive_basepoints(&channel_seed,
-			  &local_funding_pubkey, NULL, &secrets, NULL);
+	keys = get_channel_keys(&peer_id, dbid);
 
 	/*~ Bitcoin signatures cover the (part of) the script they're
 	 * executing; the rules are a bit complex in general, but for
 	 * Segregated Witness it's simply the current script. */
 	funding_wscript = bitcoin_redeem_2of2(tmpctx,
-					      &local_funding_pubkey,
+					      &keys->funding_pubkey,
 					      &remote_funding_pubkey);
 	sign_tx_input(tx, 0, NULL, funding_wscript,
-		      &secrets.funding_privkey,
-		      &local_funding_pubkey,
+		      &keys->secrets.funding_privkey,
+		      &keys->funding_pubkey,
 		      SIGHASH_ALL,
 		      &sig);
 
@@ -1592,8 +1635,7 @@ static u8 *handle_validate_commitment_tx(struct hsmd_client *c, const u8 *msg_in
 	u32 feerate;
 	struct bitcoin_signature sig;
 	struct bitcoin_signature *htlc_sigs;
-	struct secret channel_seed;
-	struct sha256 shaseed;
+	const struct channel_keys *keys;
 	struct secret *old_secret;
 	struct pubkey next_per_commitment_point;
 
@@ -1610,17 +1652,14 @@ static u8 *handle_validate_commitment_tx(struct hsmd_client *c, const u8 *msg_in
 	 * old_secret and next_per_commitment_point are used.
 	 */
 
-	get_channel_seed(&c->id, c->dbid, &channel_seed);
-	if (!derive_shaseed(&channel_seed, &shaseed))
-		return hsmd_status_bad_request(c, msg_in, "bad derive_shaseed");
-
-	if (!per_commit_point(&shaseed, &next_per_commitment_point, commit_num + 1))
+	keys = get_channel_keys(&c->id, c->dbid);
+	if (!per_commit_point(&keys->shaseed, &next_per_commitment_point, commit_num + 1))
 		return hsmd_status_bad_request_fmt(
 		    c, msg_in, "bad per_commit_point %" PRIu64, commit_num + 1);
 
 	if (commit_num >= 1) {
 		old_secret = tal(tmpctx, struct secret);
-		if (!per_commit_secret(&shaseed, old_secret, commit_num - 1)) {
+		if (!per_commit_secret(&keys->shaseed, old_secret, commit_num - 1)) {
 			return hsmd_status_bad_request_fmt(
 			    c, msg_in, "Cannot derive secret %" PRIu64, commit_num - 1);
 		}
@@ -1662,20 +1701,14 @@ static u8 *do_sign_remote_htlc_to_us(struct hsmd_client *c,
 				     const u8 *wscript,
 				     bool option_anchor_outputs)
 {
-	struct secret channel_seed, htlc_basepoint_secret;
-	struct pubkey htlc_basepoint;
+	const struct channel_keys *keys;
 	struct privkey privkey;
 
 	tx->chainparams = c->chainparams;
-	get_channel_seed(peerid, channel_dbid, &channel_seed);
+	keys = get_channel_keys(peerid, channel_dbid);
 
-	if (!derive_htlc_basepoint(&channel_seed, &htlc_basepoint,
-				   &htlc_basepoint_secret))
-		return hsmd_status_bad_request(c, msg_in,
-					       "Failed derive_htlc_basepoint");
-
-	if (!derive_simple_privkey(&htlc_basepoint_secret,
-				   &htlc_basepoint,
+	if (!derive_simple_privkey(&keys->secrets.htlc_basepoint_secret,
+				   &keys->basepoints.htlc,
 				   remote_per_commitment_point,
 				   &privkey))
 		return hsmd_status_bad_request(c, msg_in,
@@ -1749,38 +1782,28 @@ static u8 *do_sign_delayed_payment_to_us(struct hsmd_client *c,
 					 struct bitcoin_tx *tx,
 					 const u8 *wscript)
 {
-	struct secret channel_seed, basepoint_secret;
-	struct pubkey basepoint;
-	struct sha256 shaseed;
+	const struct channel_keys *keys;
 	struct pubkey per_commitment_point;
 	struct privkey privkey;
 
 	tx->chainparams = c->chainparams;
-	get_channel_seed(peerid, channel_dbid, &channel_seed);
+	keys = get_channel_keys(peerid, channel_dbid);
 
 	/*~ ccan/crypto/shachain how we efficiently derive 2^48 ordered
 	 * preimages from a single seed; the twist is that as the preimages
 	 * are revealed, you can generate the previous ones yourself, needing
-	 * to only keep log(N) of them at any time. */
-	if (!derive_shaseed(&channel_seed, &shaseed))
-		return hsmd_status_bad_request(c, msg_in, "bad derive_shaseed");
-
-	/*~ BOLT #3 describes exactly how this is used to generate the Nth
+	 * to only keep log(N) of them at any time.
+	 *
+	 * BOLT #3 describes exactly how this is used to generate the Nth
 	 * per-commitment point. */
-	if (!per_commit_point(&shaseed, &per_commitment_point, commit_num))
+	if (!per_commit_point(&keys->shaseed, &per_commitment_point, commit_num))
 		return hsmd_status_bad_request_fmt(
 		    c, msg_in, "bad per_commitment_point %" PRIu64, commit_num);
 
 	/*~ ... which is combined with the basepoint to generate then N'th key.
 	 */
-	if (!derive_delayed_payment_basepoint(&channel_seed,
-					      &basepoint,
-					      &basepoint_secret))
-		return hsmd_status_bad_request(c, msg_in,
-					       "failed deriving basepoint");
-
-	if (!derive_simple_privkey(&basepoint_secret,
-				   &basepoint,
+	if (!derive_simple_privkey(&keys->secrets.delayed_payment_basepoint_secret,
+				   &keys->basepoints.delayed_payment,
 				   &per_commitment_point,
 				   &privkey))
 		return hsmd_status_bad_request(c, msg_in,
@@ -1990,6 +2013,10 @@ u8 *hsmd_init(struct secret hsm_secret,
 		     sizeof(secretstuff.hsm_secret.data));
 	memcpy(secretstuff.hsm_secret.data, hsm_secret.data, sizeof(hsm_secret.data));
 
+	/*~ Nor the channel keys derived from it; and any we had are stale. */
+	sodium_mlock(&channel_keys_cache, sizeof(channel_keys_cache));
+	wipe_channel_keys_cache();
+
 	assert(bip32_key_version.bip32_pubkey_version == BIP32_VER_MAIN_PUBLIC
 			|| bip32_key_version.bip32_pubkey_version == BIP32_VER_TEST_PUBLIC);
 
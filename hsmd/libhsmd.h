@@ -58,6 +58,10 @@ struct hsmd_client *hsmd_client_new_peer(const tal_t *ctx, u64 capabilities,
 					 const struct node_id *peer_id,
 					 void *extra);
 
+/* Forget any cached keys for this client's channel: call this when the
+ * client goes away. */
+void hsmd_client_closed(const struct hsmd_client *client);
+
 /* Handle an incoming request with the provided context. Upon
  * successful processing we return a response message that is
  * allocated off of `ctx`. Failures return a `NULL` pointer, and the
@@ -0,0 +1,139 @@
+#include "config.h"
+#include "../libhsmd.c"
+#include "../libhsmd_status.c"
+#include <ccan/err/err.h>
+#include <ccan/mem/mem.h>
+#include <common/setup.h>
+#include <stdio.h>
+
+/* AUTOGENERATED MOCKS START */
+/* AUTOGENERATED MOCKS END */
+
+/* More channels than fit in a single set, fewer than the whole cache. */
+#define NUM_CHANNELS 32
+
+static struct hsmd_client *clients[NUM_CHANNELS];
+
+/* Alternate between the two most common per-channel requests: the
+ * per-commitment point (every commitment) and basepoints. */
+static const u8 *request(const tal_t *ctx, size_t i)
+{
+	struct hsmd_client *c = clients[i % NUM_CHANNELS];
+	u64 n = 2 + i / NUM_CHANNELS;
+	const u8 *msg, *reply;
+
+	if (i % 2)
+		msg = towire_hsmd_get_per_commitment_point(tmpctx, n);
+	else
+		msg = towire_hsmd_get_channel_basepoints(tmpctx, &c->id,
+							 c->dbid);
+	reply = hsmd_handle_client_message(ctx, c, msg);
+	if (!reply)
+		errx(1, "Request %zu failed", i);
+	return reply;
+}
+
+static void run_requests(const u8 **replies, size_t runs, bool cached)
+{
+	for (size_t i = 0; i < runs; i++) {
+		if (!cached)
+			wipe_channel_keys_cache();
+		replies[i] = request(replies, i);
+	}
+}
+
+static void check_cache(void)
+{
+	struct node_id peer_id;
+	const struct channel_keys *keys;
+	struct secret seed;
+	struct pubkey funding_pubkey;
+	struct basepoints basepoints;
+	struct secrets secrets;
+	struct sha256 shaseed;
+	struct hsmd_client *c;
+
+	/* Cached entries match a fresh derivation. */
+	for (size_t i = 0; i < NUM_CHANNELS; i++) {
+		keys = get_channel_keys(&clients[i]->id, clients[i]->dbid);
+		get_channel_seed(&clients[i]->id, clients[i]->dbid, &seed);
+		assert(derive_basepoints(&seed, &funding_pubkey, &basepoints,
+					 &secrets, &shaseed));
+		assert(pubkey_eq(&keys->funding_pubkey, &funding_pubkey));
+		assert(memeq(&keys->basepoints, sizeof(keys->basepoints),
+			     &basepoints, sizeof(basepoints)));
+		assert(memeq(&keys->secrets, sizeof(keys->secrets),
+			     &secrets, sizeof(secrets)));
+		assert(sha256_eq(&keys->shaseed, &shaseed));
+	}
+
+	/* Same dbid, different peer: must not get the other's keys. */
+	memset(&peer_id, 0xFF, sizeof(peer_id));
+	keys = get_channel_keys(&peer_id, clients[0]->dbid);
+	assert(node_id_eq(&keys->peer_id, &peer_id));
+	assert(!pubkey_eq(&keys->funding_pubkey,
+			  &get_channel_keys(&clients[0]->id,
+					    clients[0]->dbid)->funding_pubkey));
+
+	/* Closing a client wipes its entry. */
+	c = clients[1];
+	get_channel_keys(&c->id, c->dbid);
+	hsmd_client_closed(c);
+	for (size_t i = 0; i < CHANNEL_KEYS_CACHE_WAYS; i++) {
+		const struct channel_keys *k = &channel_keys_set(c->dbid)[i];
+		assert(!k->last_used
+		       || k->dbid != c->dbid
+		       || !node_id_eq(&k->peer_id, &c->id));
+	}
+
+	/* Filling a set evicts the least recently used. */
+	wipe_channel_keys_cache();
+	for (size_t i = 0; i < CHANNEL_KEYS_CACHE_WAYS + 1; i++) {
+		/* Touch the first one again, so it survives. */
+		get_channel_keys(&clients[0]->id, clients[0]->dbid);
+		get_channel_keys(&peer_id,
+				 clients[0]->dbid + (i + 1) * CHANNEL_KEYS_CACHE_SETS);
+	}
+	assert(channel_keys_set(clients[0]->dbid)[0].dbid == clients[0]->dbid);
+}
+
+int main(int argc, char *argv[])
+{
+	struct secret hsm_secret;
+	const u8 **replies_cached, **replies_uncached;
+	size_t runs = NUM_CHANNELS * 4;
+
+	common_setup(argv[0]);
+	chainparams = chainparams_for_network("regtest");
+
+	memset(&hsm_secret, 0x42, sizeof(hsm_secret));
+	tal_free(hsmd_init(hsm_secret, chainparams->bip32_key_version));
+
+	for (size_t i = 0; i < NUM_CHANNELS; i++) {
+		struct node_id peer_id;
+
+		memset(&peer_id, i, sizeof(peer_id));
+		clients[i] = hsmd_client_new_peer(tmpctx,
+						  HSM_CAP_MASTER
+						  | HSM_CAP_COMMITMENT_POINT,
+						  i + 1, &peer_id, NULL);
+		clients[i]->chainparams = chainparams;
+	}
+
+	check_cache();
+
+	replies_cached = tal_arr(tmpctx, const u8 *, runs);
+	replies_uncached = tal_arr(tmpctx, const u8 *, runs);
+
+	/* Replies are the same whether the keys were cached or not. */
+	run_requests(replies_uncached, runs, false);
+	wipe_channel_keys_cache();
+	run_requests(replies_cached, runs, true);
+
+	for (size_t i = 0; i < runs; i++)
+		assert(memeq(replies_cached[i], tal_bytelen(replies_cached[i]),
+			     replies_uncached[i], tal_bytelen(replies_uncached[i])));
+
+	common_shutdown();
+	return 0;
+}
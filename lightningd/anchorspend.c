@@ -100,9 +100,7 @@ struct anchor_details *create_anchor_details(const tal_t *ctx,
 {
 	struct lightningd *ld = channel->peer->ld;
 	const struct htlc_in *hin;
-	struct htlc_in_map_iter ini;
 	const struct htlc_out *hout;
-	struct htlc_out_map_iter outi;
 	struct anchor_details *adet = tal(ctx, struct anchor_details);
 
 	/* If we don't have an anchor, we can't do anything. */
@@ -133,29 +131,17 @@ struct anchor_details *create_anchor_details(const tal_t *ctx,
 	/* OK, what's it worth, at each deadline?
 	 * We care about incoming HTLCs where we have the preimage, and
 	 * outgoing HTLCs. */
-	for (hin = htlc_in_map_first(ld->htlcs_in, &ini);
-	     hin;
-	     hin = htlc_in_map_next(ld->htlcs_in, &ini)) {
+	list_for_each(&channel->htlcs_in, hin, list) {
 		struct deadline_value v;
 
-		if (hin->key.channel != channel)
-			continue;
-
 		v.msat = hin->msat;
 		v.block = hin->cltv_expiry;
 		tal_arr_expand(&adet->vals, v);
 	}
 
-	for (hout = htlc_out_map_first(ld->htlcs_out, &outi);
-	     hout;
-	     hout = htlc_out_map_next(ld->htlcs_out, &outi)) {
-		if (hout->key.channel != channel)
-			continue;
+	list_for_each(&channel->htlcs_out, hout, list) {
 		struct deadline_value v;
 
-		if (hout->key.channel != channel)
-			continue;
-
 		v.msat = hout->msat;
 		v.block = hout->cltv_expiry;
 		tal_arr_expand(&adet->vals, v);
@@ -3,6 +3,7 @@
 #include <bitcoin/script.h>
 #include <bitcoin/tx.h>
 #include <ccan/array_size/array_size.h>
+#include <ccan/asort/asort.h>
 #include <ccan/io/io.h>
 #include <ccan/tal/str/str.h>
 #include <common/configdir.h>
@@ -114,7 +115,13 @@ size_t get_tx_depth(const struct chain_topology *topo,
 	return topo->tip->height - blockheight + 1;
 }
 
-struct txs_to_broadcast {
+/* We hand this many packages to the backend at once. */
+#define REBROADCAST_PARALLEL 8
+
+/* A tx and its unconfirmed descendants, which must be sent in order. */
+struct tx_package {
+	struct rebroadcast *rb;
+
 	/* We just sent txs[cursor] */
 	size_t cursor;
 	/* These are hex encoded already, for bitcoind_sendrawtx */
@@ -127,49 +134,180 @@ struct txs_to_broadcast {
 	bool *allowhighfees;
 };
 
-/* We just sent the last entry in txs[].  Shrink and send the next last. */
+struct rebroadcast {
+	struct bitcoind *bitcoind;
+	struct tx_package **packages;
+	/* Next package to send, and how many are being sent now. */
+	size_t next, in_flight;
+};
+
+static void send_next_package(struct rebroadcast *rb);
+
+/* We just sent txs[cursor].  Send the next, or start another package. */
 static void broadcast_remainder(struct bitcoind *bitcoind,
 				bool success, const char *msg,
-				struct txs_to_broadcast *txs)
+				struct tx_package *pkg)
 {
+	struct rebroadcast *rb = pkg->rb;
+
 	if (!success)
 		log_debug(bitcoind->log,
 			  "Expected error broadcasting tx %s: %s",
-			  txs->txs[txs->cursor], msg);
+			  pkg->txs[pkg->cursor], msg);
+
+	pkg->cursor++;
+	if (pkg->cursor < tal_count(pkg->txs)) {
+		/* Broadcast next one. */
+		bitcoind_sendrawtx(bitcoind,
+				   pkg->cmd_id[pkg->cursor],
+				   pkg->txs[pkg->cursor],
+				   pkg->allowhighfees[pkg->cursor],
+				   broadcast_remainder, pkg);
+		return;
+	}
+
+	tal_free(pkg);
+	rb->in_flight--;
+	send_next_package(rb);
+}
 
-	txs->cursor++;
-	if (txs->cursor == tal_count(txs->txs)) {
-		tal_free(txs);
+static void send_next_package(struct rebroadcast *rb)
+{
+	struct tx_package *pkg;
+
+	if (rb->next == tal_count(rb->packages)) {
+		if (rb->in_flight == 0)
+			tal_free(rb);
 		return;
 	}
 
-	/* Broadcast next one. */
-	bitcoind_sendrawtx(bitcoind,
-			   txs->cmd_id[txs->cursor], txs->txs[txs->cursor],
-			   txs->allowhighfees[txs->cursor],
-			   broadcast_remainder, txs);
+	pkg = rb->packages[rb->next++];
+	rb->in_flight++;
+	bitcoind_sendrawtx(rb->bitcoind,
+			   pkg->cmd_id[0], pkg->txs[0], pkg->allowhighfees[0],
+			   broadcast_remainder, pkg);
 }
 
-/* FIXME: This is dumb.  We can group txs and avoid bothering bitcoind
- * if any one tx is in the main chain. */
-static void rebroadcast_txs(struct chain_topology *topo)
+/* Does this tx (or a parent we broadcast) conflict with the chain? */
+static bool outgoing_tx_conflicted(const struct chain_topology *topo,
+				   const struct outgoing_tx *otx)
 {
-	/* Copy txs now (peers may go away, and they own txs). */
-	struct txs_to_broadcast *txs;
+	if (otx->conflict_height)
+		return true;
+
+	for (size_t i = 0; i < otx->tx->wtx->num_inputs; i++) {
+		struct bitcoin_txid txid;
+		const struct outgoing_tx *parent;
+
+		bitcoin_tx_input_get_txid(otx->tx, i, &txid);
+		parent = outgoing_tx_map_get(topo->outgoing_txs, &txid);
+		if (parent && parent != otx
+		    && outgoing_tx_conflicted(topo, parent))
+			return true;
+	}
+	return false;
+}
+
+struct package_member {
 	struct outgoing_tx *otx;
-	struct outgoing_tx_map_iter it;
-	tal_t *cleanup_ctx = tal(NULL, char);
+	/* The tx at the root of this package, and our depth below it. */
+	const struct outgoing_tx *root;
+	size_t depth;
+};
 
-	txs = tal(topo, struct txs_to_broadcast);
-	txs->cmd_id = tal_arr(txs, const char *, 0);
+static int package_member_cmp(const struct package_member *a,
+			      const struct package_member *b,
+			      void *unused)
+{
+	if (a->root != b->root)
+		return (uintptr_t)a->root < (uintptr_t)b->root ? -1 : 1;
+	if (a->depth != b->depth)
+		return a->depth < b->depth ? -1 : 1;
+	return 0;
+}
+
+/* Which of the txs we're sending does this spend from, if any? */
+static struct outgoing_tx *find_parent(const struct outgoing_tx_map *sending,
+				       const struct outgoing_tx *otx)
+{
+	for (size_t i = 0; i < otx->tx->wtx->num_inputs; i++) {
+		struct bitcoin_txid txid;
+		struct outgoing_tx *parent;
+
+		bitcoin_tx_input_get_txid(otx->tx, i, &txid);
+		parent = outgoing_tx_map_get(sending, &txid);
+		if (parent && parent != otx)
+			return parent;
+	}
+	return NULL;
+}
+
+/* Group children with their parents, so they're sent in order (and only
+ * after the parent), while unrelated txs go out in parallel. */
+static struct tx_package **make_packages(struct rebroadcast *rb,
+					 struct outgoing_tx **otxs)
+{
+	struct outgoing_tx_map *sending = tal(tmpctx, struct outgoing_tx_map);
+	struct package_member *members;
+	struct tx_package **packages = tal_arr(rb, struct tx_package *, 0);
+
+	outgoing_tx_map_init(sending);
+	for (size_t i = 0; i < tal_count(otxs); i++)
+		outgoing_tx_map_add(sending, otxs[i]);
+
+	members = tal_arr(tmpctx, struct package_member, tal_count(otxs));
+	for (size_t i = 0; i < tal_count(otxs); i++) {
+		struct outgoing_tx *root = otxs[i], *parent;
+
+		members[i].otx = otxs[i];
+		members[i].depth = 0;
+		while ((parent = find_parent(sending, root)) != NULL) {
+			root = parent;
+			members[i].depth++;
+		}
+		members[i].root = root;
+	}
+	asort(members, tal_count(members), package_member_cmp, NULL);
+
+	for (size_t i = 0; i < tal_count(members); i++) {
+		const struct outgoing_tx *otx = members[i].otx;
+		struct tx_package *pkg;
+
+		if (i == 0 || members[i].root != members[i-1].root) {
+			pkg = tal(rb, struct tx_package);
+			pkg->rb = rb;
+			pkg->cursor = 0;
+			pkg->txs = tal_arr(pkg, const char *, 0);
+			pkg->cmd_id = tal_arr(pkg, const char *, 0);
+			pkg->allowhighfees = tal_arr(pkg, bool, 0);
+			tal_arr_expand(&packages, pkg);
+		} else
+			pkg = packages[tal_count(packages) - 1];
+
+		/* Copy txs now (peers may go away, and they own txs). */
+		tal_arr_expand(&pkg->txs, tal_strdup(pkg->txs, otx->hextx));
+		tal_arr_expand(&pkg->allowhighfees, otx->allowhighfees);
+		tal_arr_expand(&pkg->cmd_id,
+			       otx->cmd_id ? tal_strdup(pkg, otx->cmd_id) : NULL);
+	}
+	return packages;
+}
 
-	/* Put any txs we want to broadcast in ->txs. */
-	txs->txs = tal_arr(txs, const char *, 0);
-	txs->allowhighfees = tal_arr(txs, bool, 0);
+static void rebroadcast_txs(struct chain_topology *topo)
+{
+	struct rebroadcast *rb;
+	struct outgoing_tx *otx, **otxs;
+	struct outgoing_tx_map_iter it;
+	tal_t *cleanup_ctx = tal(NULL, char);
 
+	otxs = tal_arr(tmpctx, struct outgoing_tx *, 0);
 	for (otx = outgoing_tx_map_first(topo->outgoing_txs, &it); otx;
 	     otx = outgoing_tx_map_next(topo->outgoing_txs, &it)) {
-		if (wallet_transaction_height(topo->ld->wallet, &otx->txid))
+		const struct bitcoin_tx *oldtx;
+
+		/* We track these as blocks come in, so no need to ask the
+		 * db or bitcoind. */
+		if (otx->mined_height)
 			continue;
 
 		/* Don't send ones which aren't ready yet.  Note that if the
@@ -178,17 +316,29 @@ static void rebroadcast_txs(struct chain_topology *topo)
 			continue;
 
 		/* Don't free from txmap inside loop! */
+		oldtx = otx->tx;
 		if (otx->refresh
 		    && !otx->refresh(otx->channel, &otx->tx, otx->cbarg)) {
 			tal_steal(cleanup_ctx, otx);
 			continue;
 		}
+		if (otx->tx != oldtx) {
+			tal_free(otx->hextx);
+			otx->hextx = fmt_bitcoin_tx(otx, otx->tx);
+		}
+
+		/* If its inputs are spent by some other tx, it can never
+		 * get in (unless there's a reorg). */
+		if (outgoing_tx_conflicted(topo, otx))
+			continue;
 
-		tal_arr_expand(&txs->txs, fmt_bitcoin_tx(txs->txs, otx->tx));
-		tal_arr_expand(&txs->allowhighfees, otx->allowhighfees);
-		tal_arr_expand(&txs->cmd_id,
-			       otx->cmd_id ? tal_strdup(txs, otx->cmd_id) : NULL);
+		tal_arr_expand(&otxs, otx);
 	}
+
+	rb = tal(topo, struct rebroadcast);
+	rb->bitcoind = topo->bitcoind;
+	rb->next = rb->in_flight = 0;
+	rb->packages = make_packages(rb, otxs);
 	tal_free(cleanup_ctx);
 
 	/* Free explicitly in case we were called because a block came in.
@@ -198,9 +348,20 @@ static void rebroadcast_txs(struct chain_topology *topo)
 					       time_from_sec(30 + pseudorand(30)),
 					       rebroadcast_txs, topo);
 
-	/* Let this do the dirty work. */
-	txs->cursor = (size_t)-1;
-	broadcast_remainder(topo->bitcoind, true, "", txs);
+	if (tal_count(rb->packages) == 0) {
+		tal_free(rb);
+		return;
+	}
+
+	log_debug(topo->log, "Rebroadcasting %zu txs in %zu packages",
+		  tal_count(otxs), tal_count(rb->packages));
+
+	/* Send a few packages at once: as each finishes, it starts the
+	 * next. */
+	for (size_t i = 0;
+	     i < REBROADCAST_PARALLEL && i < tal_count(rb->packages);
+	     i++)
+		send_next_package(rb);
 }
 
 static void destroy_outgoing_tx(struct outgoing_tx *otx, struct chain_topology *topo)
@@ -281,6 +442,11 @@ void broadcast_tx_(struct chain_topology *topo,
 		otx->cmd_id = tal_strdup(otx, cmd_id);
 	else
 		otx->cmd_id = NULL;
+	otx->hextx = fmt_bitcoin_tx(otx, otx->tx);
+	/* From here on, we notice as blocks come in. */
+	otx->mined_height = wallet_transaction_height(topo->ld->wallet,
+						      &otx->txid);
+	otx->conflict_height = 0;
 
 	/* Note that if the minimum block is N, we broadcast it when
 	 * we have block N-1! */
@@ -303,7 +469,7 @@ void broadcast_tx_(struct chain_topology *topo,
 
 	wallet_transaction_add(topo->ld->wallet, tx->wtx, 0, 0);
 	bitcoind_sendrawtx(topo->bitcoind, otx->cmd_id,
-			   fmt_bitcoin_tx(tmpctx, otx->tx),
+			   otx->hextx,
 			   allowhighfees,
 			   broadcast_done, otx);
 }
@@ -976,6 +1142,94 @@ static void topo_add_utxos(struct chain_topology *topo, struct block *b)
 	}
 }
 
+/* An outpoint spent by one of our outgoing txs. */
+struct otx_spend {
+	struct bitcoin_outpoint outpoint;
+	struct outgoing_tx *otx;
+};
+
+static const struct bitcoin_outpoint *
+otx_spend_keyof(const struct otx_spend *spend)
+{
+	return &spend->outpoint;
+}
+
+static bool otx_spend_eq(const struct otx_spend *spend,
+			 const struct bitcoin_outpoint *outpoint)
+{
+	return bitcoin_outpoint_eq(&spend->outpoint, outpoint);
+}
+
+HTABLE_DEFINE_TYPE(struct otx_spend, otx_spend_keyof, txo_hash, otx_spend_eq,
+		   otx_spend_map);
+
+/**
+ * topo_update_outgoing_txs -- Note which outgoing txs this block mined, or
+ * made impossible by spending their inputs.
+ */
+static void topo_update_outgoing_txs(struct chain_topology *topo,
+				     struct block *b)
+{
+	struct otx_spend_map *spends;
+	struct outgoing_tx *otx;
+	struct outgoing_tx_map_iter it;
+
+	if (outgoing_tx_map_count(topo->outgoing_txs) == 0)
+		return;
+
+	/* We only do this once per block, so just build it each time. */
+	spends = tal(tmpctx, struct otx_spend_map);
+	otx_spend_map_init(spends);
+	for (otx = outgoing_tx_map_first(topo->outgoing_txs, &it); otx;
+	     otx = outgoing_tx_map_next(topo->outgoing_txs, &it)) {
+		if (otx->mined_height || otx->conflict_height)
+			continue;
+		for (size_t i = 0; i < otx->tx->wtx->num_inputs; i++) {
+			struct otx_spend *spend = tal(spends, struct otx_spend);
+			bitcoin_tx_input_get_outpoint(otx->tx, i,
+						      &spend->outpoint);
+			spend->otx = otx;
+			otx_spend_map_add(spends, spend);
+		}
+	}
+
+	for (size_t i = 0; i < tal_count(b->full_txs); i++) {
+		const struct bitcoin_tx *tx = b->full_txs[i];
+
+		otx = outgoing_tx_map_get(topo->outgoing_txs, &b->txids[i]);
+		if (otx && !otx->mined_height)
+			otx->mined_height = b->height;
+
+		for (size_t j = 0; j < tx->wtx->num_inputs; j++) {
+			struct bitcoin_outpoint outpoint;
+			struct otx_spend *spend;
+			struct otx_spend_map_iter sit;
+
+			bitcoin_tx_input_get_outpoint(tx, j, &outpoint);
+			for (spend = otx_spend_map_getfirst(spends, &outpoint,
+							    &sit);
+			     spend;
+			     spend = otx_spend_map_getnext(spends, &outpoint,
+							   &sit)) {
+				if (spend->otx == otx
+				    || spend->otx->conflict_height)
+					continue;
+				log_debug(topo->log,
+					  "Outgoing tx %s conflicts with %s"
+					  " in block %u",
+					  type_to_string(tmpctx,
+							 struct bitcoin_txid,
+							 &spend->otx->txid),
+					  type_to_string(tmpctx,
+							 struct bitcoin_txid,
+							 &b->txids[i]),
+					  b->height);
+				spend->otx->conflict_height = b->height;
+			}
+		}
+	}
+}
+
 static void add_tip(struct chain_topology *topo, struct block *b)
 {
 	/* Attach to tip; b is now the tip. */
@@ -987,6 +1241,7 @@ static void add_tip(struct chain_topology *topo, struct block *b)
 
 	topo_add_utxos(topo, b);
 	topo_update_spends(topo, b);
+	topo_update_outgoing_txs(topo, b);
 
 	/* Only keep the transactions we care about. */
 	filter_block_txs(topo, b);
@@ -1025,6 +1280,8 @@ static void remove_tip(struct chain_topology *topo)
 	struct bitcoin_txid *txs;
 	size_t n;
 	const struct short_channel_id *removed_scids;
+	struct outgoing_tx *otx;
+	struct outgoing_tx_map_iter it;
 
 	log_debug(topo->log, "Removing stale block %u: %s",
 			  topo->tip->height,
@@ -1045,6 +1302,15 @@ static void remove_tip(struct chain_topology *topo)
 	for (size_t i = 0; i < n; i++)
 		txwatch_fire(topo, &txs[i], 0);
 
+	/* Outgoing txs mined (or conflicted) here need rebroadcasting again */
+	for (otx = outgoing_tx_map_first(topo->outgoing_txs, &it); otx;
+	     otx = outgoing_tx_map_next(topo->outgoing_txs, &it)) {
+		if (otx->mined_height >= b->height)
+			otx->mined_height = 0;
+		if (otx->conflict_height >= b->height)
+			otx->conflict_height = 0;
+	}
+
 	/* Grab these before we delete block from db */
 	removed_scids = wallet_utxoset_get_created(tmpctx, topo->ld->wallet,
 						   b->height);
@@ -28,6 +28,11 @@ struct outgoing_tx {
 			 bool success, const char *err, void *arg);
 	bool (*refresh)(struct channel *, const struct bitcoin_tx **, void *arg);
 	void *cbarg;
+	/* Hex encoding of tx, so we don't redo it for every rebroadcast. */
+	const char *hextx;
+	/* Height of the block which contained this tx, or one which spent
+	 * one of its inputs (0 if none): either way, don't rebroadcast. */
+	u32 mined_height, conflict_height;
 };
 
 struct block {
@@ -29,36 +29,93 @@ void channel_set_owner(struct channel *channel, struct subd *owner)
 		subd_release_channel(old_owner, channel);
 }
 
+void channel_balance_changed(struct channel *channel)
+{
+	channel->balance_gen = ++channel->peer->ld->channel_balance_gen;
+}
+
 struct htlc_out *channel_has_htlc_out(struct channel *channel)
 {
-	struct htlc_out_map_iter outi;
-	struct htlc_out *hout;
+	return list_top(&channel->htlcs_out, struct htlc_out, list);
+}
+
+struct htlc_in *channel_has_htlc_in(struct channel *channel)
+{
+	return list_top(&channel->htlcs_in, struct htlc_in, list);
+}
+
+static void channel_index(struct channel *channel)
+{
 	struct lightningd *ld = channel->peer->ld;
 
-	for (hout = htlc_out_map_first(ld->htlcs_out, &outi);
-	     hout;
-	     hout = htlc_out_map_next(ld->htlcs_out, &outi)) {
-		if (hout->key.channel == channel)
-			return hout;
-	}
+	if (channel->scid)
+		channel_scid_map_add(ld->channels_by_scid, channel);
+	if (channel->alias[LOCAL])
+		channel_alias_map_add(ld->channels_by_alias, channel);
+	channel_cid_map_add(ld->channels_by_cid, channel);
+	if (channel->dbid)
+		channel_dbid_map_add(ld->channels_by_dbid, channel);
+}
 
-	return NULL;
+static void channel_unindex(struct channel *channel)
+{
+	struct lightningd *ld = channel->peer->ld;
+
+	if (channel->scid)
+		channel_scid_map_del(ld->channels_by_scid, channel);
+	if (channel->alias[LOCAL])
+		channel_alias_map_del(ld->channels_by_alias, channel);
+	channel_cid_map_del(ld->channels_by_cid, channel);
+	if (channel->dbid)
+		channel_dbid_map_del(ld->channels_by_dbid, channel);
 }
 
-struct htlc_in *channel_has_htlc_in(struct channel *channel)
+void channel_set_scid(struct channel *channel,
+		      const struct short_channel_id *scid)
 {
-	struct htlc_in_map_iter ini;
-	struct htlc_in *hin;
 	struct lightningd *ld = channel->peer->ld;
 
-	for (hin = htlc_in_map_first(ld->htlcs_in, &ini);
-	     hin;
-	     hin = htlc_in_map_next(ld->htlcs_in, &ini)) {
-		if (hin->key.channel == channel)
-			return hin;
+	if (channel->scid) {
+		channel_scid_map_del(ld->channels_by_scid, channel);
+		channel->scid = tal_free(channel->scid);
 	}
+	if (scid) {
+		channel->scid = tal_dup(channel, struct short_channel_id, scid);
+		channel_scid_map_add(ld->channels_by_scid, channel);
+	}
+}
 
-	return NULL;
+void channel_set_local_alias(struct channel *channel,
+			     const struct short_channel_id *alias)
+{
+	struct lightningd *ld = channel->peer->ld;
+
+	if (channel->alias[LOCAL]) {
+		channel_alias_map_del(ld->channels_by_alias, channel);
+		channel->alias[LOCAL] = tal_free(channel->alias[LOCAL]);
+	}
+	if (alias) {
+		channel->alias[LOCAL] = tal_dup(channel, struct short_channel_id,
+						alias);
+		channel_alias_map_add(ld->channels_by_alias, channel);
+	}
+}
+
+void channel_set_cid(struct channel *channel, const struct channel_id *cid)
+{
+	struct lightningd *ld = channel->peer->ld;
+
+	channel_cid_map_del(ld->channels_by_cid, channel);
+	channel->cid = *cid;
+	channel_cid_map_add(ld->channels_by_cid, channel);
+}
+
+void channel_set_dbid(struct channel *channel, u64 dbid)
+{
+	assert(!channel->dbid);
+	assert(dbid);
+	channel->dbid = dbid;
+	channel_dbid_map_add(channel->peer->ld->channels_by_dbid, channel);
 }
 
 static void destroy_channel(struct channel *channel)
@@ -84,6 +141,7 @@ static void destroy_channel(struct channel *channel)
 	/* Free any old owner still hanging around. */
 	channel_set_owner(channel, NULL);
 
+	channel_unindex(channel);
 	list_del_from(&channel->peer->channels, &channel->list);
 }
 
@@ -234,6 +292,8 @@ struct channel *new_unsaved_channel(struct peer *peer,
 	channel->closing_feerate_range = NULL;
 	channel->channel_update = NULL;
 	channel->alias[LOCAL] = channel->alias[REMOTE] = NULL;
+	/* Caller sets this with channel_set_cid() */
+	memset(&channel->cid, 0, sizeof(channel->cid));
 
 	channel->shutdown_scriptpubkey[REMOTE] = NULL;
 	channel->last_was_revoke = false;
@@ -280,9 +340,16 @@ struct channel *new_unsaved_channel(struct peer *peer,
 	channel->forgets = tal_arr(channel, struct command *, 0);
 	list_add_tail(&peer->channels, &channel->list);
 	channel->rr_number = peer->ld->rr_counter++;
+	channel->balance.gen = 0;
+	channel_balance_changed(channel);
+	channel_index(channel);
 	tal_add_destructor(channel, destroy_channel);
 
 	list_head_init(&channel->inflights);
+	list_head_init(&channel->htlcs_in);
+	list_head_init(&channel->htlcs_out);
+	channel->num_htlcs_in = channel->num_htlcs_out = 0;
+	channel->htlcs_in_msat = channel->htlcs_out_msat = AMOUNT_MSAT(0);
 	return channel;
 }
 
@@ -525,9 +592,16 @@ struct channel *new_channel(struct peer *peer, u64 dbid,
 
 	list_add_tail(&peer->channels, &channel->list);
 	channel->rr_number = peer->ld->rr_counter++;
+	channel->balance.gen = 0;
+	channel_balance_changed(channel);
+	channel_index(channel);
 	tal_add_destructor(channel, destroy_channel);
 
 	list_head_init(&channel->inflights);
+	list_head_init(&channel->htlcs_in);
+	list_head_init(&channel->htlcs_out);
+	channel->num_htlcs_in = channel->num_htlcs_out = 0;
+	channel->htlcs_in_msat = channel->htlcs_out_msat = AMOUNT_MSAT(0);
 
 	channel->closer = closer;
 	channel->close_blockheight = NULL;
@@ -616,81 +690,46 @@ struct channel *any_channel_by_scid(struct lightningd *ld,
 				    const struct short_channel_id *scid,
 				    bool privacy_leak_ok)
 {
-	struct peer *p;
 	struct channel *chan;
-	struct peer_node_id_map_iter it;
-
-	/* FIXME: Support lookup by scid directly! */
-	for (p = peer_node_id_map_first(ld->peers, &it);
-	     p;
-	     p = peer_node_id_map_next(ld->peers, &it)) {
-		list_for_each(&p->channels, chan, list) {
-			/* BOLT #2:
-			 * - MUST always recognize the `alias` as a
-			 *   `short_channel_id` for incoming HTLCs to this
-			 *   channel.
-			 */
-			if (chan->alias[LOCAL] &&
-			    short_channel_id_eq(scid, chan->alias[LOCAL]))
-				return chan;
-			/* BOLT #2:
-			 * - if `channel_type` has `option_scid_alias` set:
-			 *   - MUST NOT allow incoming HTLCs to this channel
-			 *     using the real `short_channel_id`
-			 */
-			if (!privacy_leak_ok
-			    && channel_type_has(chan->type, OPT_SCID_ALIAS))
-				continue;
-			if (chan->scid
-			    && short_channel_id_eq(scid, chan->scid))
-				return chan;
-		}
+	struct channel_scid_map_iter it;
+
+	/* BOLT #2:
+	 * - MUST always recognize the `alias` as a
+	 *   `short_channel_id` for incoming HTLCs to this
+	 *   channel.
+	 */
+	chan = channel_alias_map_get(ld->channels_by_alias, scid);
+	if (chan)
+		return chan;
+
+	/* Stub scids (1x1x1) aren't unique, hence the iteration */
+	for (chan = channel_scid_map_getfirst(ld->channels_by_scid, scid, &it);
+	     chan;
+	     chan = channel_scid_map_getnext(ld->channels_by_scid, scid, &it)) {
+		/* BOLT #2:
+		 * - if `channel_type` has `option_scid_alias` set:
+		 *   - MUST NOT allow incoming HTLCs to this channel
+		 *     using the real `short_channel_id`
+		 */
+		if (!privacy_leak_ok
+		    && channel_type_has(chan->type, OPT_SCID_ALIAS))
+			continue;
+		return chan;
 	}
 	return NULL;
 }
 
 struct channel *channel_by_dbid(struct lightningd *ld, const u64 dbid)
 {
-	struct peer *p;
-	struct channel *chan;
-	struct peer_node_id_map_iter it;
-
-	/* FIXME: Support lookup by id directly! */
-	for (p = peer_node_id_map_first(ld->peers, &it);
-	     p;
-	     p = peer_node_id_map_next(ld->peers, &it)) {
-		list_for_each(&p->channels, chan, list) {
-			if (chan->dbid == dbid)
-				return chan;
-		}
-	}
-	return NULL;
+	return channel_dbid_map_get(ld->channels_by_dbid, dbid);
 }
 
 struct channel *channel_by_cid(struct lightningd *ld,
 			       const struct channel_id *cid)
 {
-	struct peer *p;
-	struct channel *channel;
-	struct peer_node_id_map_iter it;
-
-	/* FIXME: Support lookup by cid directly! */
-	for (p = peer_node_id_map_first(ld->peers, &it);
-	     p;
-	     p = peer_node_id_map_next(ld->peers, &it)) {
-		if (p->uncommitted_channel) {
-			/* We can't use this method for old, uncommitted
-			 * channels; there's no "channel" struct here! */
-			if (channel_id_eq(&p->uncommitted_channel->cid, cid))
-				return NULL;
-		}
-		list_for_each(&p->channels, channel, list) {
-			if (channel_id_eq(&channel->cid, cid)) {
-				return channel;
-			}
-		}
-	}
-	return NULL;
+	/* We can't use this method for old, uncommitted channels; there's
+	 * no "channel" struct there, so they're simply not found. */
+	return channel_cid_map_get(ld->channels_by_cid, cid);
 }
 
 struct channel *find_channel_by_id(const struct peer *peer,
@@ -793,6 +832,7 @@ void channel_set_state(struct channel *channel,
 		      channel_state_name(channel), channel_state_str(old_state));
 
 	channel->state = state;
+	channel_balance_changed(channel);
 
 	/* TODO(cdecker) Selectively save updated fields to DB */
 	wallet_channel_save(channel->peer->ld->wallet, channel);
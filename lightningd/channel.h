@@ -1,8 +1,11 @@
 #ifndef LIGHTNING_LIGHTNINGD_CHANNEL_H
 #define LIGHTNING_LIGHTNINGD_CHANNEL_H
 #include "config.h"
+#include <ccan/crypto/siphash24/siphash24.h>
+#include <ccan/htable/htable_type.h>
 #include <common/channel_id.h>
 #include <common/channel_type.h>
+#include <common/pseudorand.h>
 #include <common/scb_wiregen.h>
 #include <common/tx_roles.h>
 #include <common/utils.h>
@@ -75,6 +78,20 @@ struct open_attempt {
 	const u8 *open_msg;
 };
 
+/* The routing-relevant numbers listchannelbalances returns. */
+struct channel_balance {
+	/* The channel->balance_gen these were calculated at (0 == never). */
+	u64 gen;
+	struct amount_msat spendable, receivable;
+	/* Offered and received HTLCs currently in the channel. */
+	u32 num_htlcs;
+	/* What spendable and receivable were derived from: totals of the
+	 * HTLCs we offered and received, and how many are untrimmed in
+	 * each side's commitment tx. */
+	struct amount_msat offered, received;
+	u32 num_untrimmed[NUM_SIDES];
+};
+
 struct channel {
 	/* Inside peer->channels. */
 	struct list_node list;
@@ -269,6 +286,20 @@ struct channel {
 	/* `Channel-shell` of this channel
 	 * (Minimum information required to backup this channel). */
 	struct scb_chan *scb;
+
+	/* ld->channel_balance_gen when our balance, HTLCs, state or
+	 * connectivity last changed. */
+	u64 balance_gen;
+
+	/* Cached for listchannelbalances, valid if balance.gen == balance_gen */
+	struct channel_balance balance;
+
+	/* Our entries in ld->htlcs_in and ld->htlcs_out, so we don't have to
+	 * walk every HTLC to find this channel's (see connect_htlc_in). */
+	struct list_head htlcs_in, htlcs_out;
+	/* How many are on those lists, and their total amounts. */
+	size_t num_htlcs_in, num_htlcs_out;
+	struct amount_msat htlcs_in_msat, htlcs_out_msat;
 };
 
 bool channel_is_connected(const struct channel *channel);
@@ -383,6 +414,9 @@ const char *channel_state_str(enum channel_state state);
 
 void channel_set_owner(struct channel *channel, struct subd *owner);
 
+/* Something listchannelbalances reports has changed for this channel. */
+void channel_balance_changed(struct channel *channel);
+
 /* Channel has failed, but can try again. */
 void channel_fail_transient(struct channel *channel,
 			    const char *fmt, ...) PRINTF_FMT(2,3);
@@ -416,6 +450,20 @@ struct channel *peer_any_active_channel(struct peer *peer, bool *others);
 /* Find a channel which is not yet saved to disk */
 struct channel *peer_any_unsaved_channel(struct peer *peer, bool *others);
 
+/* Set (or clear, if NULL) channel->scid, keeping ld's index up to date */
+void channel_set_scid(struct channel *channel,
+		      const struct short_channel_id *scid);
+
+/* Set channel->alias[LOCAL], keeping ld's index up to date */
+void channel_set_local_alias(struct channel *channel,
+			     const struct short_channel_id *alias);
+
+/* Set channel->cid, keeping ld's index up to date */
+void channel_set_cid(struct channel *channel, const struct channel_id *cid);
+
+/* Promote an unsaved channel's unsaved_dbid to its dbid */
+void channel_set_dbid(struct channel *channel, u64 dbid);
+
 struct channel *channel_by_dbid(struct lightningd *ld, const u64 dbid);
 
 /* Includes both real scids and aliases.  If !privacy_leak_ok, then private
@@ -531,4 +579,85 @@ struct htlc_out *channel_has_htlc_out(struct channel *channel);
 const u8 *get_channel_update(struct channel *channel);
 
 struct amount_msat htlc_max_possible_send(const struct channel *channel);
+
+/* ld indexes channels by each of these, for any_channel_by_scid(),
+ * channel_by_cid() and channel_by_dbid().  Only set ones are indexed. */
+static inline size_t scid_hash(const struct short_channel_id *scid)
+{
+	return siphash24(siphash_seed(), scid, sizeof(*scid));
+}
+
+static const struct short_channel_id *channel_scid(const struct channel *channel)
+{
+	return channel->scid;
+}
+
+static bool channel_scid_eq(const struct channel *channel,
+			    const struct short_channel_id *scid)
+{
+	return short_channel_id_eq(channel->scid, scid);
+}
+
+/* Defines struct channel_scid_map */
+HTABLE_DEFINE_TYPE(struct channel,
+		   channel_scid, scid_hash, channel_scid_eq,
+		   channel_scid_map);
+
+static const struct short_channel_id *channel_local_alias(const struct channel *channel)
+{
+	return channel->alias[LOCAL];
+}
+
+static bool channel_local_alias_eq(const struct channel *channel,
+				   const struct short_channel_id *alias)
+{
+	return short_channel_id_eq(channel->alias[LOCAL], alias);
+}
+
+/* Defines struct channel_alias_map */
+HTABLE_DEFINE_TYPE(struct channel,
+		   channel_local_alias, scid_hash, channel_local_alias_eq,
+		   channel_alias_map);
+
+static inline size_t channel_id_hash(const struct channel_id *cid)
+{
+	return siphash24(siphash_seed(), cid->id, sizeof(cid->id));
+}
+
+static const struct channel_id *channel_cid(const struct channel *channel)
+{
+	return &channel->cid;
+}
+
+static bool channel_cid_eq(const struct channel *channel,
+			   const struct channel_id *cid)
+{
+	return channel_id_eq(&channel->cid, cid);
+}
+
+/* Defines struct channel_cid_map */
+HTABLE_DEFINE_TYPE(struct channel,
+		   channel_cid, channel_id_hash, channel_cid_eq,
+		   channel_cid_map);
+
+static inline size_t channel_dbid_hash(u64 dbid)
+{
+	return siphash24(siphash_seed(), &dbid, sizeof(dbid));
+}
+
+static u64 channel_dbid(const struct channel *channel)
+{
+	assert(channel->dbid);
+	return channel->dbid;
+}
+
+static bool channel_dbid_eq(const struct channel *channel, u64 dbid)
+{
+	return channel->dbid == dbid;
+}
+
+/* Defines struct channel_dbid_map */
+HTABLE_DEFINE_TYPE(struct channel,
+		   channel_dbid, channel_dbid_hash, channel_dbid_eq,
+		   channel_dbid_map);
 #endif /* LIGHTNING_LIGHTNINGD_CHANNEL_H */
@@ -267,8 +267,10 @@ static void peer_got_channel_ready(struct channel *channel, const u8 *msg)
 	if (!channel_on_channel_ready(channel, &next_per_commitment_point))
 		return;
 
-	if (channel->alias[REMOTE] == NULL)
+	if (channel->alias[REMOTE] == NULL) {
 		channel->alias[REMOTE] = tal_steal(channel, alias_remote);
+		channel_balance_changed(channel);
+	}
 
 	/* Remember that we got the lockin */
 	wallet_channel_save(channel->peer->ld->wallet, channel);
@@ -541,6 +543,9 @@ static unsigned channel_msg(struct subd *sd, const u8 *msg, const int *fds)
 	case WIRE_CHANNELD_GOT_REVOKE:
 		peer_got_revoke(sd->channel, msg);
 		break;
+	case WIRE_CHANNELD_GOT_PREIMAGE:
+		peer_got_preimage(sd->channel, msg);
+		break;
 	case WIRE_CHANNELD_GOT_CHANNEL_READY:
 		peer_got_channel_ready(sd->channel, msg);
 		break;
@@ -515,11 +515,21 @@ static void custommsg_payload_serialize(struct custommsg_payload *payload,
 	json_add_node_id(stream, "peer_id", &payload->peer_id);
 }
 
-REGISTER_PLUGIN_HOOK(custommsg,
-		     custommsg_cb,
-		     custommsg_final,
-		     custommsg_payload_serialize,
-		     struct custommsg_payload *);
+/* Filters are message types. */
+static bool custommsg_filter(struct custommsg_payload *payload,
+			     const struct hook_filter *filter)
+{
+	u16 type = fromwire_peektype(payload->msg);
+
+	return type >= filter->min && type <= filter->max;
+}
+
+REGISTER_FILTERED_PLUGIN_HOOK(custommsg,
+			      custommsg_cb,
+			      custommsg_final,
+			      custommsg_payload_serialize,
+			      custommsg_filter,
+			      struct custommsg_payload *);
 
 static void handle_custommsg_in(struct lightningd *ld, const u8 *msg)
 {
@@ -646,7 +656,7 @@ int connectd_init(struct lightningd *ld)
 {
 	int fds[2];
 	u8 *msg;
-	int hsmfd;
+	int hsmfd, hsmfd_handshake;
 	struct wireaddr_internal *wireaddrs = ld->proposed_wireaddr;
 	enum addr_listen_announce *listen_announce = ld->proposed_listen_announce;
 	const char *websocket_helper_path;
@@ -662,10 +672,13 @@ int connectd_init(struct lightningd *ld)
 		fatal("Could not socketpair for connectd<->gossipd");
 
 	hsmfd = hsm_get_global_fd(ld, HSM_CAP_ECDH);
+	/* A second one, so handshakes don't wait behind other requests */
+	hsmfd_handshake = hsm_get_global_fd(ld, HSM_CAP_ECDH);
 
 	ld->connectd = new_global_subd(ld, "lightning_connectd",
 				       connectd_wire_name, connectd_msg,
 				       take(&hsmfd), take(&fds[1]),
+				       take(&hsmfd_handshake),
 #if DEVELOPER
 				       /* Not take(): we share it */
 				       ld->dev_disconnect_fd >= 0 ?
@@ -698,7 +698,7 @@ openchannel2_hook_cb(struct openchannel2_payload *payload STEALS)
 	} else
 		our_shutdown_script_wallet_index = NULL;
 
-	channel->cid = payload->channel_id;
+	channel_set_cid(channel, &payload->channel_id);
 	channel->opener = REMOTE;
 	channel->open_attempt = new_channel_open_attempt(channel);
 	channel->req_confirmed_ins[REMOTE] =
@@ -1147,6 +1147,7 @@ wallet_update_channel(struct lightningd *ld,
 	channel->funding_sats = total_funding;
 	channel->our_funds = our_funding;
 	channel->our_msat = our_msat;
+	channel_balance_changed(channel);
 	channel->push = lease_fee_msat;
 	channel->msat_to_us_min = our_msat;
 	channel->msat_to_us_max = our_msat;
@@ -1218,6 +1219,7 @@ wallet_commit_channel(struct lightningd *ld,
 {
 	struct amount_msat our_msat, lease_fee_msat;
 	struct channel_inflight *inflight;
+	struct short_channel_id local_alias;
 	bool any_active = peer_any_active_channel(channel->peer, NULL);
 
 	if (!amount_sat_to_msat(&our_msat, our_funding)) {
@@ -1244,13 +1246,14 @@ wallet_commit_channel(struct lightningd *ld,
 
 	/* Promote the unsaved_dbid to the dbid */
 	assert(channel->unsaved_dbid != 0);
-	channel->dbid = channel->unsaved_dbid;
+	channel_set_dbid(channel, channel->unsaved_dbid);
 	channel->unsaved_dbid = 0;
 
 	channel->funding = *funding;
 	channel->funding_sats = total_funding;
 	channel->our_funds = our_funding;
 	channel->our_msat = our_msat;
+	channel_balance_changed(channel);
 	channel->push = lease_fee_msat;
 	channel->msat_to_us_min = our_msat;
 	channel->msat_to_us_max = our_msat;
@@ -1293,8 +1296,8 @@ wallet_commit_channel(struct lightningd *ld,
 	 /* Can't have gotten their alias for this channel yet. */
 	channel->alias[REMOTE] = NULL;
 	/* We do generate one ourselves however. */
-	channel->alias[LOCAL] = tal(channel, struct short_channel_id);
-	randombytes_buf(channel->alias[LOCAL], sizeof(struct short_channel_id));
+	randombytes_buf(&local_alias, sizeof(local_alias));
+	channel_set_local_alias(channel, &local_alias);
 
 	channel->remote_upfront_shutdown_script
 		= tal_steal(channel, remote_upfront_shutdown_script);
@@ -2788,6 +2791,7 @@ static struct command_result *json_openchannel_init(struct command *cmd,
 	struct open_attempt *oa;
 	struct lease_rates *rates;
 	struct command_result *res;
+	struct channel_id tmp_cid;
 	int fds[2];
 
 	if (!param(cmd, buffer, params,
@@ -2901,8 +2905,9 @@ static struct command_result *json_openchannel_init(struct command *cmd,
 				      peer->ld->config.fee_base,
 				      peer->ld->config.fee_per_satoshi);
 	/* We derive initial channel_id *now*, so we can tell it to connectd. */
-	derive_tmp_channel_id(&channel->cid,
+	derive_tmp_channel_id(&tmp_cid,
 			      &channel->local_basepoints.revocation);
+	channel_set_cid(channel, &tmp_cid);
 
 	/* Get a new open_attempt going */
 	channel->opener = LOCAL;
@@ -3080,7 +3085,7 @@ static void handle_psbt_changed(struct subd *dualopend,
 			return;
 		}
 		/* This might be the first time we learn the channel_id */
-		channel->cid = cid;
+		channel_set_cid(channel, &cid);
 		response = json_stream_success(cmd);
 		json_add_string(response, "channel_id",
 				type_to_string(tmpctx, struct channel_id,
@@ -3395,6 +3400,7 @@ static struct command_result *json_queryrates(struct command *cmd,
 	u32 *feerate_per_kw_funding;
 	u32 *feerate_per_kw;
 	struct amount_sat *amount, *request_amt;
+	struct channel_id tmp_cid;
 	struct wally_psbt *psbt;
 	struct open_attempt *oa;
 	u32 *our_upfront_shutdown_script_wallet_index;
@@ -3431,8 +3437,9 @@ static struct command_result *json_queryrates(struct command *cmd,
 
 	/* We derive initial channel_id *now*, so we can tell it to
 	 * connectd. */
-	derive_tmp_channel_id(&channel->cid,
+	derive_tmp_channel_id(&tmp_cid,
 			      &channel->local_basepoints.revocation);
+	channel_set_cid(channel, &tmp_cid);
 
 	if (!feature_negotiated(cmd->ld->our_features,
 			        peer->their_features,
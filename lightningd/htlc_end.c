@@ -5,6 +5,8 @@
 #include <common/htlc.h>
 #include <common/pseudorand.h>
 #include <common/type_to_string.h>
+#include <inttypes.h>
+#include <lightningd/channel.h>
 #include <lightningd/htlc_end.h>
 #include <lightningd/log.h>
 
@@ -45,13 +47,29 @@ struct htlc_in *remove_htlc_in_by_dbid(struct htlc_in_map *remaining_htlcs_in,
 
 static void destroy_htlc_in(struct htlc_in *hend, struct htlc_in_map *map)
 {
+	struct channel *channel = hend->key.channel;
+
 	htlc_in_map_del(map, hend);
+	list_del_from(&channel->htlcs_in, &hend->list);
+	channel->num_htlcs_in--;
+	if (!amount_msat_sub(&channel->htlcs_in_msat,
+			     channel->htlcs_in_msat, hend->msat))
+		fatal("htlcs_in_msat underflow removing htlc %"PRIu64,
+		      hend->key.id);
 }
 
 void connect_htlc_in(struct htlc_in_map *map, struct htlc_in *hend)
 {
+	struct channel *channel = hend->key.channel;
+
 	tal_add_destructor2(hend, destroy_htlc_in, map);
 	htlc_in_map_add(map, hend);
+	list_add_tail(&channel->htlcs_in, &hend->list);
+	channel->num_htlcs_in++;
+	if (!amount_msat_add(&channel->htlcs_in_msat,
+			     channel->htlcs_in_msat, hend->msat))
+		fatal("htlcs_in_msat overflow adding htlc %"PRIu64,
+		      hend->key.id);
 }
 
 struct htlc_out *find_htlc_out(const struct htlc_out_map *map,
@@ -64,13 +82,29 @@ struct htlc_out *find_htlc_out(const struct htlc_out_map *map,
 
 static void destroy_htlc_out(struct htlc_out *hend, struct htlc_out_map *map)
 {
+	struct channel *channel = hend->key.channel;
+
 	htlc_out_map_del(map, hend);
+	list_del_from(&channel->htlcs_out, &hend->list);
+	channel->num_htlcs_out--;
+	if (!amount_msat_sub(&channel->htlcs_out_msat,
+			     channel->htlcs_out_msat, hend->msat))
+		fatal("htlcs_out_msat underflow removing htlc %"PRIu64,
+		      hend->key.id);
 }
 
 void connect_htlc_out(struct htlc_out_map *map, struct htlc_out *hend)
 {
+	struct channel *channel = hend->key.channel;
+
 	tal_add_destructor2(hend, destroy_htlc_out, map);
 	htlc_out_map_add(map, hend);
+	list_add_tail(&channel->htlcs_out, &hend->list);
+	channel->num_htlcs_out++;
+	if (!amount_msat_add(&channel->htlcs_out_msat,
+			     channel->htlcs_out_msat, hend->msat))
+		fatal("htlcs_out_msat overflow adding htlc %"PRIu64,
+		      hend->key.id);
 }
 
 static void *corrupt(const char *abortstr, const char *fmt, ...)
@@ -2,6 +2,7 @@
 #define LIGHTNING_LIGHTNINGD_HTLC_END_H
 #include "config.h"
 #include <ccan/htable/htable_type.h>
+#include <ccan/list/list.h>
 #include <ccan/time/time.h>
 #include <common/htlc_state.h>
 #include <common/sphinx.h>
@@ -21,6 +22,8 @@ struct htlc_in {
 	 * database. */
 	u64 dbid;
 	struct htlc_key key;
+	/* In key.channel->htlcs_in, once connected. */
+	struct list_node list;
 	struct amount_msat msat;
 	u32 cltv_expiry;
 	struct sha256 payment_hash;
@@ -66,6 +69,8 @@ struct htlc_out {
 	 * database. */
 	u64 dbid;
 	struct htlc_key key;
+	/* In key.channel->htlcs_out, once connected. */
+	struct list_node list;
 	struct amount_msat msat;
 	u32 cltv_expiry;
 	struct sha256 payment_hash;
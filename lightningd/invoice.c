@@ -65,7 +65,11 @@ static void json_add_invoice_fields(struct json_stream *response,
 		json_add_sha256(response, "local_offer_id", inv->local_offer_id);
 
 		/* Everyone loves seeing their own payer notes!
-		 * Well: they will.  Trust me. */
+		 * Well: they will.  Trust me.  (Unless filtered out,
+		 * in which case we don't decode at all). */
+		if (!inv->invstring
+		    || !json_stream_wants(response, "invreq_payer_note"))
+			return;
 		tinv = invoice_decode(tmpctx,
 				      inv->invstring, strlen(inv->invstring),
 				      NULL, NULL, &fail);
@@ -1222,6 +1226,7 @@ static void json_add_invoices(struct json_stream *response,
 	struct invoice_iterator it;
 	const struct invoice_details *details;
 	struct invoice invoice;
+	bool want_invstring;
 
 	/* Don't iterate entire db if we're just after one. */
 	if (label) {
@@ -1238,18 +1243,18 @@ static void json_add_invoices(struct json_stream *response,
 			json_add_invoice(response, NULL, details);
 		}
 	} else {
+		/* The invstring is most of the invoice: only load it
+		 * if it's going to be printed (or decoded). */
+		want_invstring = json_stream_wants_in_array(response, "bolt11")
+			|| json_stream_wants_in_array(response, "bolt12")
+			|| json_stream_wants_in_array(response, "invreq_payer_note");
 		memset(&it, 0, sizeof(it));
-		while (wallet_invoice_iterate(wallet, &it)) {
-			details = wallet_invoice_iterator_deref(response,
+		while (wallet_invoice_iterate(wallet, &it, want_invstring,
+					      local_offer_id)) {
+			details = wallet_invoice_iterator_deref(tmpctx,
 								wallet, &it);
-			/* FIXME: db can filter this better! */
-			if (local_offer_id) {
-				if (!details->local_offer_id
-				    || !sha256_eq(local_offer_id,
-						  details->local_offer_id))
-					continue;
-			}
 			json_add_invoice(response, NULL, details);
+			tal_free(details);
 		}
 	}
 }
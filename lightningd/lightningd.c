@@ -185,11 +185,32 @@ static struct lightningd *new_lightningd(const tal_t *ctx)
 	ld->peers_by_dbid = tal(ld, struct peer_dbid_map);
 	peer_dbid_map_init(ld->peers_by_dbid);
 
+	/*~ Forwarding an HTLC looks up the outgoing channel by scid, then by
+	 * channel_id, so with thousands of channels we don't want to walk
+	 * them all each time. */
+	ld->channels_by_scid = tal(ld, struct channel_scid_map);
+	channel_scid_map_init(ld->channels_by_scid);
+	ld->channels_by_alias = tal(ld, struct channel_alias_map);
+	channel_alias_map_init(ld->channels_by_alias);
+	ld->channels_by_cid = tal(ld, struct channel_cid_map);
+	channel_cid_map_init(ld->channels_by_cid);
+	ld->channels_by_dbid = tal(ld, struct channel_dbid_map);
+	channel_dbid_map_init(ld->channels_by_dbid);
+
 	/*~ For multi-part payments, we need to keep some incoming payments
 	 * in limbo until we get all the parts, or we time them out. */
 	ld->htlc_sets = tal(ld, struct htlc_set_map);
 	htlc_set_map_init(ld->htlc_sets);
 
+	/*~ Outgoing payments are similar: we index the commands waiting on
+	 * each part, and keep a summary of payments with parts in flight. */
+	ld->waitsendpay_commands = tal(ld, struct sendpay_command_map);
+	sendpay_command_map_init(ld->waitsendpay_commands);
+	ld->sendpay_commands = tal(ld, struct sendpay_command_map);
+	sendpay_command_map_init(ld->sendpay_commands);
+	ld->payment_parts = tal(ld, struct payment_parts_map);
+	payment_parts_map_init(ld->payment_parts);
+
 	/*~ We have a multi-entry log-book infrastructure: we define a 10MB log
 	 * book to hold all the entries (and trims as necessary), and multiple
 	 * log objects which each can write into it, each with a unique
@@ -206,8 +227,6 @@ static struct lightningd *new_lightningd(const tal_t *ctx)
 	ld->alias = NULL;
 	ld->rgb = NULL;
 	list_head_init(&ld->connects);
-	list_head_init(&ld->waitsendpay_commands);
-	list_head_init(&ld->sendpay_commands);
 	list_head_init(&ld->close_commands);
 	list_head_init(&ld->ping_commands);
 	list_head_init(&ld->disconnect_commands);
@@ -318,6 +337,11 @@ static struct lightningd *new_lightningd(const tal_t *ctx)
 	 * each invoice we generate has a different set of channels.  */
 	ld->rr_counter = 0;
 
+	/*~ Every change to a channel's balance takes the next value of
+	 * this, which lets listchannelbalances callers ask for "what changed
+	 * since generation N" instead of fetching everything again. */
+	ld->channel_balance_gen = 0;
+
 	/*~ Because fee estimates on testnet and regtest are unreliable,
 	 * we allow overriding them with --force-feerates, in which
 	 * case this is a pointer to an enum feerate-indexed array of values */
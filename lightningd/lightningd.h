@@ -5,6 +5,7 @@
 #include <lightningd/htlc_end.h>
 #include <lightningd/htlc_set.h>
 #include <lightningd/options.h>
+#include <lightningd/pay.h>
 #include <lightningd/peer_control.h>
 #include <signal.h>
 #include <sys/stat.h>
@@ -207,6 +208,12 @@ struct lightningd {
 	/* And those in database by dbid */
 	struct peer_dbid_map *peers_by_dbid;
 
+	/* All channels, by real scid, local alias, channel_id and dbid */
+	struct channel_scid_map *channels_by_scid;
+	struct channel_alias_map *channels_by_alias;
+	struct channel_cid_map *channels_by_cid;
+	struct channel_dbid_map *channels_by_dbid;
+
 	/* Outstanding connect commands. */
 	struct list_head connects;
 
@@ -228,9 +235,11 @@ struct lightningd {
 	struct wallet *wallet;
 
 	/* Outstanding waitsendpay commands. */
-	struct list_head waitsendpay_commands;
+	struct sendpay_command_map *waitsendpay_commands;
 	/* Outstanding sendpay commands. */
-	struct list_head sendpay_commands;
+	struct sendpay_command_map *sendpay_commands;
+	/* Parts of payments which still have some pending. */
+	struct payment_parts_map *payment_parts;
 	/* Outstanding close commands. */
 	struct list_head close_commands;
 	/* Outstanding ping commands. */
@@ -356,6 +365,10 @@ struct lightningd {
 	/* The round-robin list of channels, for use when doing MPP.  */
 	u64 rr_counter;
 
+	/* Bumped whenever a channel's balance, HTLCs or usability change,
+	 * so listchannelbalances can report only what moved. */
+	u64 channel_balance_gen;
+
 	/* Should we re-exec ourselves instead of just exiting? */
 	bool try_reexec;
 
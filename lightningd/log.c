@@ -42,6 +42,8 @@ struct log_book {
 	/* Array of log files: one per ld->logfiles[] */
 	FILE **outfiles;
 	bool print_timestamps;
+	/* Tell subdaemons not to send what we won't print */
+	bool filter_subdaemons;
 
 	struct log_entry *log;
 	/* Prefix this to every entry as you output */
@@ -275,6 +277,7 @@ struct log_book *new_log_book(struct lightningd *ld, size_t max_mem)
 	lr->max_mem = max_mem;
 	lr->outfiles = NULL;
 	lr->default_print_level = NULL;
+	lr->filter_subdaemons = false;
 	/* We have to allocate this, since we tal_free it on resetting */
 	lr->prefix = tal_strdup(lr, "");
 	list_head_init(&lr->print_filters);
@@ -344,6 +347,42 @@ enum log_level log_print_level(struct log *log, const struct node_id *node_id)
 	return *log->print_level;
 }
 
+/* Could this filter match some node_id (in hex)? */
+static bool filter_could_match_node_id(const struct print_filter *f)
+{
+	return strlen(f->prefix) <= PUBKEY_CMPR_LEN * 2
+		&& strspn(f->prefix, "0123456789abcdef") == strlen(f->prefix);
+}
+
+bool log_filter_subdaemons(const struct log *log)
+{
+	return log->lr->filter_subdaemons;
+}
+
+enum log_level log_print_level_any(struct log *log)
+{
+	struct print_filter *i;
+	enum log_level level = LOG_LEVEL_MAX;
+
+	if (!log->lr->default_print_level)
+		return LOG_UNUSUAL;
+
+	/* First filter matching our prefix wins, but before that any
+	 * node_id filter could apply to individual messages. */
+	list_for_each(&log->lr->print_filters, i, list) {
+		if (strstr(log->prefix->prefix, i->prefix)) {
+			if (i->level < level)
+				level = i->level;
+			return level;
+		}
+		if (filter_could_match_node_id(i) && i->level < level)
+			level = i->level;
+	}
+	if (*log->lr->default_print_level < level)
+		level = *log->lr->default_print_level;
+	return level;
+}
+
 
 /* This may move entry! */
 static void add_entry(struct log *log, struct log_entry **l)
@@ -741,6 +780,11 @@ void opt_register_logging(struct lightningd *ld)
 		       opt_set_bool_arg, opt_show_bool,
 		       &ld->log->lr->print_timestamps,
 		       "prefix log messages with timestamp");
+	clnopt_witharg("--log-subdaemon-filter", OPT_EARLY|OPT_SHOWBOOL,
+		       opt_set_bool_arg, opt_show_bool,
+		       &ld->log->lr->filter_subdaemons,
+		       "subdaemons don't send log messages below log-level"
+		       " (they won't be in getlog or crash logs)");
 	opt_register_early_arg("--log-prefix", arg_log_prefix, show_log_prefix,
 			       ld->log_book,
 			       "log prefix");
@@ -45,6 +45,10 @@ void logv(struct log *log, enum log_level level, const struct node_id *node_id,
 
 const char *log_prefix(const struct log *log);
 enum log_level log_print_level(struct log *log, const struct node_id *node_id);
+/* Lowest level log_print_level could return for any node_id. */
+enum log_level log_print_level_any(struct log *log);
+/* Should subdaemons drop messages below the print level? */
+bool log_filter_subdaemons(const struct log *log);
 
 void opt_register_logging(struct lightningd *ld);
 
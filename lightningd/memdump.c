@@ -12,6 +12,7 @@
 #include <gossipd/gossipd_wiregen.h>
 #include <hsmd/hsmd_wiregen.h>
 #include <lightningd/chaintopology.h>
+#include <lightningd/channel.h>
 #include <lightningd/hsm_control.h>
 #include <lightningd/jsonrpc.h>
 #include <lightningd/lightningd.h>
@@ -156,8 +157,15 @@ static void finish_report(const struct leak_detect *leaks)
 	memleak_scan_htable(memtable, &ld->htlcs_in->raw);
 	memleak_scan_htable(memtable, &ld->htlcs_out->raw);
 	memleak_scan_htable(memtable, &ld->htlc_sets->raw);
+	memleak_scan_htable(memtable, &ld->payment_parts->raw);
+	memleak_scan_htable(memtable, &ld->sendpay_commands->raw);
+	memleak_scan_htable(memtable, &ld->waitsendpay_commands->raw);
 	memleak_scan_htable(memtable, &ld->peers->raw);
 	memleak_scan_htable(memtable, &ld->peers_by_dbid->raw);
+	memleak_scan_htable(memtable, &ld->channels_by_scid->raw);
+	memleak_scan_htable(memtable, &ld->channels_by_alias->raw);
+	memleak_scan_htable(memtable, &ld->channels_by_cid->raw);
+	memleak_scan_htable(memtable, &ld->channels_by_dbid->raw);
 
 	/* Now delete ld and those which it has pointers to. */
 	memleak_scan_obj(memtable, ld);
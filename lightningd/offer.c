@@ -243,18 +243,13 @@ static struct command_result *prev_payment(struct command *cmd,
 
 	invreq_offer_id(invreq, &invreq_oid);
 	assert(!invreq->invreq_metadata);
-	payments = wallet_payment_list(cmd, cmd->ld->wallet, NULL);
+	payments = wallet_payments_by_label(cmd, cmd->ld->wallet, label->s);
 
 	for (size_t i = 0; i < tal_count(payments); i++) {
 		const struct tlv_invoice *inv;
 		char *fail;
 		struct sha256 inv_oid;
 
-		/* FIXME: Restrict db queries instead */
-		if (!payments[i]->label
-		    || !streq(label->s, payments[i]->label))
-			continue;
-
 		if (!payments[i]->invstring)
 			continue;
 
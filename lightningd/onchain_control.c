@@ -29,17 +29,10 @@
 /* We dump all the known preimages when onchaind starts up. */
 static void onchaind_tell_fulfill(struct channel *channel)
 {
-	struct htlc_in_map_iter ini;
 	struct htlc_in *hin;
 	u8 *msg;
-	struct lightningd *ld = channel->peer->ld;
-
-	for (hin = htlc_in_map_first(ld->htlcs_in, &ini);
-	     hin;
-	     hin = htlc_in_map_next(ld->htlcs_in, &ini)) {
-		if (hin->key.channel != channel)
-			continue;
 
+	list_for_each(&channel->htlcs_in, hin, list) {
 		/* BOLT #5:
 		 *
 		 * A local node:
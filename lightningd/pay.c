@@ -5,6 +5,7 @@
 #include <common/configdir.h>
 #include <common/json_command.h>
 #include <common/json_param.h>
+#include <common/memleak.h>
 #include <common/onionreply.h>
 #include <common/route.h>
 #include <common/timeout.h>
@@ -26,16 +27,39 @@ struct routing_failure {
 	const u8 *msg;
 };
 
-/* sendpay command */
-struct sendpay_command {
-	struct list_node list;
-
-	struct sha256 payment_hash;
+/* What we need to know about a part to decide on sending another. */
+struct payment_part {
 	u64 partid;
 	u64 groupid;
-	struct command *cmd;
+	enum wallet_payment_status status;
+	struct amount_msat msatoshi;
+	struct amount_msat total_msat;
+	/* NULL if sent with sendonion */
+	const struct node_id *destination;
 };
 
+static const u64 *keyof_payment_part(const struct payment_part *part)
+{
+	return &part->partid;
+}
+
+static size_t hash_partid(const u64 *partid)
+{
+	return siphash24(siphash_seed(), partid, sizeof(*partid));
+}
+
+static bool payment_part_eq(const struct payment_part *part, const u64 *partid)
+{
+	return part->partid == *partid;
+}
+
+/* Multiple groups may use the same partid, so there can be duplicates. */
+HTABLE_DEFINE_TYPE(struct payment_part,
+		   keyof_payment_part,
+		   hash_partid,
+		   payment_part_eq,
+		   payment_part_map);
+
 static bool string_to_payment_status(const char *status_str, size_t len,
 				     enum wallet_payment_status *status)
 {
@@ -69,43 +93,231 @@ static const char *payment_status_to_string(const enum wallet_payment_status sta
 
 static void destroy_sendpay_command(struct sendpay_command *pc)
 {
-	list_del(&pc->list);
+	sendpay_command_map_del(pc->map, pc);
+}
+
+static void payment_part_id_init(struct payment_part_id *id,
+				 const struct sha256 *payment_hash,
+				 u64 partid, u64 groupid)
+{
+	id->payment_hash = *payment_hash;
+	id->partid = partid;
+	id->groupid = groupid;
 }
 
 /* Owned by cmd, if cmd is deleted, then sendpay_success/sendpay_fail will
  * no longer be called. */
+static void add_waiter(struct sendpay_command_map *map,
+		       struct command *cmd,
+		       const struct sha256 *payment_hash,
+		       u64 partid, u64 groupid)
+{
+	struct sendpay_command *pc = tal(cmd, struct sendpay_command);
+
+	payment_part_id_init(&pc->id, payment_hash, partid, groupid);
+	pc->cmd = cmd;
+	pc->map = map;
+	sendpay_command_map_add(map, pc);
+	tal_add_destructor(pc, destroy_sendpay_command);
+}
+
 static void
 add_sendpay_waiter(struct lightningd *ld,
 		   struct command *cmd,
 		   const struct sha256 *payment_hash,
 		   u64 partid, u64 groupid)
 {
-	struct sendpay_command *pc = tal(cmd, struct sendpay_command);
-
-	pc->payment_hash = *payment_hash;
-	pc->partid = partid;
-	pc->groupid = groupid;
-	pc->cmd = cmd;
-	list_add(&ld->sendpay_commands, &pc->list);
-	tal_add_destructor(pc, destroy_sendpay_command);
+	add_waiter(ld->sendpay_commands, cmd, payment_hash, partid, groupid);
 }
 
-/* Owned by cmd, if cmd is deleted, then sendpay_success/sendpay_fail will
- * no longer be called. */
 static void
 add_waitsendpay_waiter(struct lightningd *ld,
 		       struct command *cmd,
 		       const struct sha256 *payment_hash,
 		       u64 partid, u64 groupid)
 {
-	struct sendpay_command *pc = tal(cmd, struct sendpay_command);
+	add_waiter(ld->waitsendpay_commands, cmd, payment_hash, partid, groupid);
+}
 
-	pc->payment_hash = *payment_hash;
-	pc->partid = partid;
-	pc->groupid = groupid;
-	pc->cmd = cmd;
-	list_add(&ld->waitsendpay_commands, &pc->list);
-	tal_add_destructor(pc, destroy_sendpay_command);
+static void destroy_payment_parts(struct payment_parts *parts,
+				  struct lightningd *ld)
+{
+	payment_parts_map_del(ld->payment_parts, parts);
+}
+
+static void memleak_help_payment_parts(struct htable *memtable,
+				       struct payment_part_map *map)
+{
+	memleak_scan_htable(memtable, &map->raw);
+}
+
+static struct payment_parts *new_payment_parts(const tal_t *ctx,
+					       const struct sha256 *payment_hash)
+{
+	struct payment_parts *parts = tal(ctx, struct payment_parts);
+
+	parts->payment_hash = *payment_hash;
+	parts->parts = tal(parts, struct payment_part_map);
+	payment_part_map_init(parts->parts);
+	memleak_add_helper(parts->parts, memleak_help_payment_parts);
+	parts->pending_msat = AMOUNT_MSAT(0);
+	parts->num_pending = 0;
+	parts->num_pending_nonparallel = 0;
+	parts->num_complete = 0;
+	return parts;
+}
+
+/* Start tracking these parts, until none are pending. */
+static void payment_parts_index(struct lightningd *ld,
+				struct payment_parts *parts)
+{
+	tal_steal(ld->payment_parts, parts);
+	payment_parts_map_add(ld->payment_parts, parts);
+	tal_add_destructor2(parts, destroy_payment_parts, ld);
+}
+
+static struct payment_part *find_part(const struct payment_parts *parts,
+				      u64 partid, u64 groupid)
+{
+	struct payment_part *part;
+	struct payment_part_map_iter it;
+
+	for (part = payment_part_map_getfirst(parts->parts, &partid, &it);
+	     part;
+	     part = payment_part_map_getnext(parts->parts, &partid, &it)) {
+		if (part->groupid == groupid)
+			return part;
+	}
+	return NULL;
+}
+
+static void part_pending(struct payment_parts *parts,
+			 const struct payment_part *part)
+{
+	if (!amount_msat_add(&parts->pending_msat, parts->pending_msat,
+			     part->msatoshi))
+		abort();
+	parts->num_pending++;
+	if (part->partid == 0)
+		parts->num_pending_nonparallel++;
+	parts->pending_groupid = part->groupid;
+	parts->pending_total_msat = part->total_msat;
+}
+
+static void part_not_pending(struct payment_parts *parts,
+			     const struct payment_part *part)
+{
+	assert(parts->num_pending > 0);
+	if (!amount_msat_sub(&parts->pending_msat, parts->pending_msat,
+			     part->msatoshi))
+		abort();
+	parts->num_pending--;
+	if (part->partid == 0)
+		parts->num_pending_nonparallel--;
+}
+
+static struct payment_part *add_part(struct payment_parts *parts,
+				     const struct wallet_payment *payment)
+{
+	struct payment_part *part = tal(parts->parts, struct payment_part);
+
+	part->partid = payment->partid;
+	part->groupid = payment->groupid;
+	part->status = payment->status;
+	part->msatoshi = payment->msatoshi;
+	part->total_msat = payment->total_msat;
+	part->destination = tal_dup_or_null(part, struct node_id,
+					    payment->destination);
+	payment_part_map_add(parts->parts, part);
+
+	switch (part->status) {
+	case PAYMENT_PENDING:
+		part_pending(parts, part);
+		break;
+	case PAYMENT_COMPLETE:
+		parts->num_complete++;
+		break;
+	case PAYMENT_FAILED:
+		break;
+	}
+	return part;
+}
+
+/* Summarize all the parts we've ever sent for this payment_hash.  While some
+ * are pending, we keep this up-to-date in memory, so a multi-part payment
+ * only hits the db for its first part. */
+static struct payment_parts *get_payment_parts(const tal_t *ctx,
+					       struct lightningd *ld,
+					       const struct sha256 *payment_hash)
+{
+	struct payment_parts *parts;
+	const struct wallet_payment **payments;
+
+	parts = payment_parts_map_get(ld->payment_parts, payment_hash);
+	if (parts)
+		return parts;
+
+	parts = new_payment_parts(ctx, payment_hash);
+	payments = wallet_payment_list(tmpctx, ld->wallet, payment_hash);
+	for (size_t i = 0; i < tal_count(payments); i++)
+		add_part(parts, payments[i]);
+
+	/* eg. we restarted with parts in flight. */
+	if (parts->num_pending)
+		payment_parts_index(ld, parts);
+	return parts;
+}
+
+/* A pending part has succeeded or failed. */
+static void payment_part_resolved(struct lightningd *ld,
+				  const struct sha256 *payment_hash,
+				  u64 partid, u64 groupid,
+				  enum wallet_payment_status status)
+{
+	struct payment_parts *parts;
+	struct payment_part *part;
+
+	/* Not loaded yet (since restart), that's OK. */
+	parts = payment_parts_map_get(ld->payment_parts, payment_hash);
+	if (!parts)
+		return;
+
+	part = find_part(parts, partid, groupid);
+	if (!part || part->status != PAYMENT_PENDING)
+		return;
+
+	part_not_pending(parts, part);
+	part->status = status;
+	if (status == PAYMENT_COMPLETE)
+		parts->num_complete++;
+
+	/* We only need to remember while they're in flight. */
+	if (parts->num_pending == 0)
+		tal_free(parts);
+}
+
+/* The payment was never stored (eg. HTLC never committed), so it's gone. */
+static void destroy_unstored_part(struct wallet_payment *payment,
+				  struct lightningd *ld)
+{
+	struct payment_parts *parts;
+	struct payment_part *part;
+
+	parts = payment_parts_map_get(ld->payment_parts, &payment->payment_hash);
+	if (!parts)
+		return;
+
+	part = find_part(parts, payment->partid, payment->groupid);
+	if (!part)
+		return;
+
+	if (part->status == PAYMENT_PENDING)
+		part_not_pending(parts, part);
+	payment_part_map_del(parts->parts, part);
+	tal_free(part);
+
+	if (parts->num_pending == 0)
+		tal_free(parts);
 }
 
 /* Outputs fields, not a separate object*/
@@ -280,19 +492,16 @@ static void tell_waiters_failed(struct lightningd *ld,
 				const char *details)
 {
 	struct sendpay_command *pc;
-	struct sendpay_command *next;
+	struct payment_part_id id;
 	const char *errmsg =
 	    sendpay_errmsg_fmt(tmpctx, pay_errcode, fail, details);
 
-	/* Careful: sendpay_fail deletes cmd */
-	list_for_each_safe(&ld->waitsendpay_commands, pc, next, list) {
-		if (!sha256_eq(payment_hash, &pc->payment_hash))
-			continue;
-		if (payment->partid != pc->partid)
-			continue;
-		if (payment->groupid != pc->groupid)
-			continue;
+	payment_part_id_init(&id, payment_hash,
+			     payment->partid, payment->groupid);
 
+	/* Careful: sendpay_fail deletes cmd, which removes pc from map */
+	while ((pc = sendpay_command_map_get(ld->waitsendpay_commands, &id))
+	       != NULL) {
 		sendpay_fail(pc->cmd, payment, pay_errcode, onionreply, fail,
 			     errmsg);
 	}
@@ -310,17 +519,14 @@ static void tell_waiters_success(struct lightningd *ld,
 				 struct wallet_payment *payment)
 {
 	struct sendpay_command *pc;
-	struct sendpay_command *next;
+	struct payment_part_id id;
 
-	/* Careful: sendpay_success deletes cmd */
-	list_for_each_safe(&ld->waitsendpay_commands, pc, next, list) {
-		if (!sha256_eq(payment_hash, &pc->payment_hash))
-			continue;
-		if (payment->partid != pc->partid)
-			continue;
-		if (payment->groupid != pc->groupid)
-			continue;
+	payment_part_id_init(&id, payment_hash,
+			     payment->partid, payment->groupid);
 
+	/* Careful: sendpay_success deletes cmd, which removes pc from map */
+	while ((pc = sendpay_command_map_get(ld->waitsendpay_commands, &id))
+	       != NULL) {
 		sendpay_success(pc->cmd, payment);
 	}
 	notify_sendpay_success(ld, payment);
@@ -334,6 +540,8 @@ void payment_succeeded(struct lightningd *ld, struct htlc_out *hout,
 	wallet_payment_set_status(ld->wallet, &hout->payment_hash,
 				  hout->partid, hout->groupid,
 				  PAYMENT_COMPLETE, rval);
+	payment_part_resolved(ld, &hout->payment_hash,
+			      hout->partid, hout->groupid, PAYMENT_COMPLETE);
 	payment = wallet_payment_by_hash(tmpctx, ld->wallet,
 					 &hout->payment_hash,
 					 hout->partid, hout->groupid);
@@ -515,18 +723,20 @@ remote_routing_failure(const tal_t *ctx,
 void payment_store(struct lightningd *ld, struct wallet_payment *payment TAKES)
 {
 	struct sendpay_command *pc;
-	struct sendpay_command *next;
+	struct payment_part_id id;
 	/* Need to remember here otherwise wallet_payment_store will free us. */
 	bool ptaken = taken(payment);
 
+	/* It's in the db now, so don't forget the part if it's freed. */
+	tal_del_destructor2(payment, destroy_unstored_part, ld);
 	wallet_payment_store(ld->wallet, payment);
 
 	/* Trigger any sendpay commands waiting for the store to occur. */
-	list_for_each_safe(&ld->sendpay_commands, pc, next, list) {
-		if (!sha256_eq(&payment->payment_hash, &pc->payment_hash))
-			continue;
-
-		/* Deletes from list, frees pc */
+	payment_part_id_init(&id, &payment->payment_hash,
+			     payment->partid, payment->groupid);
+	while ((pc = sendpay_command_map_get(ld->sendpay_commands, &id))
+	       != NULL) {
+		/* Deletes from map, frees pc */
 		json_sendpay_in_progress(pc->cmd, payment);
 	}
 
@@ -633,6 +843,8 @@ void payment_failed(struct lightningd *ld, const struct htlc_out *hout,
 	wallet_payment_set_status(ld->wallet, &hout->payment_hash,
 				  hout->partid, hout->groupid,
 				  PAYMENT_FAILED, NULL);
+	payment_part_resolved(ld, &hout->payment_hash,
+			      hout->partid, hout->groupid, PAYMENT_FAILED);
 	wallet_payment_set_failinfo(ld->wallet,
 				    &hout->payment_hash,
 				    hout->partid,
@@ -879,150 +1091,143 @@ send_payment_core(struct lightningd *ld,
 		  struct secret *path_secrets,
 		  const struct sha256 *local_invreq_id)
 {
-	const struct wallet_payment **payments, *old_payment = NULL;
+	struct payment_parts *parts;
+	struct payment_part *part, *failed_part = NULL;
+	struct payment_part_map_iter it;
 	struct channel *channel;
 	const u8 *failmsg;
 	struct htlc_out *hout;
 	struct routing_failure *fail;
-	struct amount_msat msat_already_pending = AMOUNT_MSAT(0);
-	bool have_complete = false;
 	struct command_result *invreq_err;
 
 	/* Now, do we already have one or more payments? */
-	payments = wallet_payment_list(tmpctx, ld->wallet, rhash);
-	for (size_t i = 0; i < tal_count(payments); i++) {
-		log_debug(ld->log, "Payment %zu/%zu: %s %s",
-			  i, tal_count(payments),
-			  type_to_string(tmpctx, struct amount_msat,
-					 &payments[i]->msatoshi),
-			  payments[i]->status == PAYMENT_COMPLETE ? "COMPLETE"
-			  : payments[i]->status == PAYMENT_PENDING ? "PENDING"
-			  : "FAILED");
-
-		switch (payments[i]->status) {
+	parts = get_payment_parts(tmpctx, ld, rhash);
+	log_debug(ld->log, "Payment parts: %zu pending (%s), %zu complete",
+		  parts->num_pending,
+		  type_to_string(tmpctx, struct amount_msat,
+				 &parts->pending_msat),
+		  parts->num_complete);
+
+	/* There is no way for us to add a payment with the same
+	 * (payment_hash, partid, groupid) tuple since it'd collide
+	 * with the database primary key, so we check that below. */
+	for (part = payment_part_map_getfirst(parts->parts, &partid, &it);
+	     part;
+	     part = payment_part_map_getnext(parts->parts, &partid, &it)) {
+		switch (part->status) {
 		case PAYMENT_COMPLETE:
-			have_complete = true;
-			if (payments[i]->partid != partid)
-				continue;
-
 			/* Must match successful payment parameters. */
-			if (!amount_msat_eq(payments[i]->msatoshi, msat)) {
+			if (!amount_msat_eq(part->msatoshi, msat)) {
 				return command_fail(cmd, PAY_RHASH_ALREADY_USED,
 						    "Already succeeded "
 						    "with amount %s (not %s)",
 						    type_to_string(tmpctx,
 								   struct amount_msat,
-								   &payments[i]->msatoshi),
+								   &part->msatoshi),
 						    type_to_string(tmpctx,
 								   struct amount_msat, &msat));
 			}
-			if (payments[i]->destination && destination
-			    && !node_id_eq(payments[i]->destination,
-					   destination)) {
+			if (part->destination && destination
+			    && !node_id_eq(part->destination, destination)) {
 				return command_fail(cmd, PAY_RHASH_ALREADY_USED,
 						    "Already succeeded to %s",
 						    type_to_string(tmpctx,
 								   struct node_id,
-								   payments[i]->destination));
+								   part->destination));
 			}
-			return sendpay_success(cmd, payments[i]);
-
+			return sendpay_success(cmd,
+					       wallet_payment_by_hash(tmpctx,
+								      ld->wallet,
+								      rhash,
+								      part->partid,
+								      part->groupid));
+		case PAYMENT_FAILED:
+			failed_part = part;
+			break;
 		case PAYMENT_PENDING:
-			/* At most one payment group can be in-flight at any
-			 * time. */
-			if (payments[i]->groupid != group) {
-				return command_fail(
-				    cmd, PAY_IN_PROGRESS,
-				    "Payment with groupid=%" PRIu64
-				    " still in progress, cannot retry before "
-				    "that completes.",
-				    payments[i]->groupid);
-			}
-
-			/* Can't mix non-parallel and parallel payments! */
-			if (!payments[i]->partid != !partid) {
-				return command_fail(cmd, PAY_IN_PROGRESS,
-						    "Already have %s payment in progress",
-						    payments[i]->partid ? "parallel" : "non-parallel");
-			}
+			break;
+		}
+	}
 
-			if (payments[i]->partid == partid) {
-				/* You can't change details while it's pending */
-				if (!amount_msat_eq(payments[i]->msatoshi, msat)) {
-					return command_fail(cmd, PAY_RHASH_ALREADY_USED,
-						    "Already pending "
-						    "with amount %s (not %s)",
-						    type_to_string(tmpctx,
-								   struct amount_msat,
-								   &payments[i]->msatoshi),
-						    type_to_string(tmpctx,
-								   struct amount_msat, &msat));
-				}
-				if (payments[i]->destination && destination
-				    && !node_id_eq(payments[i]->destination,
-						   destination)) {
-					return command_fail(cmd, PAY_RHASH_ALREADY_USED,
-							    "Already pending to %s",
-							    type_to_string(tmpctx,
-									   struct node_id,
-									   payments[i]->destination));
-				}
-				return json_sendpay_in_progress(cmd, payments[i]);
-			}
-			/* You shouldn't change your mind about amount being
-			 * sent, since we'll use it in onion! */
-			else if (!amount_msat_eq(payments[i]->total_msat,
-						 total_msat))
-				return command_fail(cmd, JSONRPC2_INVALID_PARAMS,
-						    "msatoshi was previously %s, now %s",
-						    type_to_string(tmpctx,
-								   struct amount_msat,
-								   &payments[i]->total_msat),
-						    type_to_string(tmpctx,
-								   struct amount_msat,
-								   &total_msat));
+	if (parts->num_pending) {
+		/* At most one payment group can be in-flight at any
+		 * time. */
+		if (parts->pending_groupid != group) {
+			return command_fail(
+			    cmd, PAY_IN_PROGRESS,
+			    "Payment with groupid=%" PRIu64
+			    " still in progress, cannot retry before "
+			    "that completes.",
+			    parts->pending_groupid);
+		}
 
+		/* Can't mix non-parallel and parallel payments! */
+		if (partid == 0
+		    && parts->num_pending != parts->num_pending_nonparallel) {
+			return command_fail(cmd, PAY_IN_PROGRESS,
+					    "Already have parallel payment in progress");
+		}
+		if (partid != 0 && parts->num_pending_nonparallel) {
+			return command_fail(cmd, PAY_IN_PROGRESS,
+					    "Already have non-parallel payment in progress");
+		}
 
-			if (!amount_msat_add(&msat_already_pending,
-					     msat_already_pending,
-					     payments[i]->msatoshi)) {
-				return command_fail(cmd, LIGHTNINGD,
-						    "Internal amount overflow!"
-						    " %s + %s in %zu/%zu",
-						    type_to_string(tmpctx,
-								   struct amount_msat,
-								   &msat_already_pending),
+		part = find_part(parts, partid, group);
+		if (part && part->status == PAYMENT_PENDING) {
+			/* You can't change details while it's pending */
+			if (!amount_msat_eq(part->msatoshi, msat)) {
+				return command_fail(cmd, PAY_RHASH_ALREADY_USED,
+					    "Already pending "
+					    "with amount %s (not %s)",
+					    type_to_string(tmpctx,
+							   struct amount_msat,
+							   &part->msatoshi),
+					    type_to_string(tmpctx,
+							   struct amount_msat, &msat));
+			}
+			if (part->destination && destination
+			    && !node_id_eq(part->destination, destination)) {
+				return command_fail(cmd, PAY_RHASH_ALREADY_USED,
+						    "Already pending to %s",
 						    type_to_string(tmpctx,
-								   struct amount_msat,
-								   &payments[i]->msatoshi),
-						    i, tal_count(payments));
+								   struct node_id,
+								   part->destination));
 			}
-			break;
-
-		case PAYMENT_FAILED:
-			if (payments[i]->partid == partid)
-				old_payment = payments[i];
- 		}
-		/* There is no way for us to add a payment with the
-		 * same (payment_hash, partid, groupid) tuple since
-		 * it'd collide with the database primary key. So
-		 * report this as soon as possible. */
-
-		if (payments[i]->partid == partid && payments[i]->groupid == group) {
-			return command_fail(
-			    cmd, PAY_RHASH_ALREADY_USED,
-			    "There already is a payment with payment_hash=%s, "
-			    "groupid=%" PRIu64 ", partid=%" PRIu64
-			    ". Either change the partid, or wait for the "
-			    "payment to complete and start a new group.",
-			    type_to_string(tmpctx, struct sha256, rhash), group,
-			    partid);
+			return json_sendpay_in_progress(cmd,
+							wallet_payment_by_hash(tmpctx,
+									       ld->wallet,
+									       rhash,
+									       partid,
+									       group));
 		}
 
+		/* You shouldn't change your mind about amount being
+		 * sent, since we'll use it in onion! */
+		if (!amount_msat_eq(parts->pending_total_msat, total_msat))
+			return command_fail(cmd, JSONRPC2_INVALID_PARAMS,
+					    "msatoshi was previously %s, now %s",
+					    type_to_string(tmpctx,
+							   struct amount_msat,
+							   &parts->pending_total_msat),
+					    type_to_string(tmpctx,
+							   struct amount_msat,
+							   &total_msat));
+	}
+
+	/* Report this as soon as possible. */
+	if (find_part(parts, partid, group)) {
+		return command_fail(
+		    cmd, PAY_RHASH_ALREADY_USED,
+		    "There already is a payment with payment_hash=%s, "
+		    "groupid=%" PRIu64 ", partid=%" PRIu64
+		    ". Either change the partid, or wait for the "
+		    "payment to complete and start a new group.",
+		    type_to_string(tmpctx, struct sha256, rhash), group,
+		    partid);
 	}
 
 	/* If any part has succeeded, you can't start a new one! */
-	if (have_complete) {
+	if (parts->num_complete) {
 		return command_fail(cmd, PAY_RHASH_ALREADY_USED,
 				    "Already succeeded other parts");
 	}
@@ -1034,11 +1239,11 @@ send_payment_core(struct lightningd *ld,
 	 */
 	/* We don't do this for single 0-value payments (sendonion does this) */
 	if (!amount_msat_eq(total_msat, AMOUNT_MSAT(0))
-	    && amount_msat_greater_eq(msat_already_pending, total_msat)) {
+	    && amount_msat_greater_eq(parts->pending_msat, total_msat)) {
 		return command_fail(cmd, PAY_IN_PROGRESS,
 				    "Already have %s of %s payments in progress",
 				    type_to_string(tmpctx, struct amount_msat,
-						   &msat_already_pending),
+						   &parts->pending_msat),
 				    type_to_string(tmpctx, struct amount_msat,
 						   &total_msat));
 	}
@@ -1069,11 +1274,18 @@ send_payment_core(struct lightningd *ld,
 			     group, channel, &hout);
 
 	if (failmsg) {
+		const struct wallet_payment *old_payment = NULL;
+
 		fail = immediate_routing_failure(
 		    cmd, ld, fromwire_peektype(failmsg),
 		    channel_scid_or_local_alias(channel),
 		    &channel->peer->id);
 
+		if (failed_part)
+			old_payment = wallet_payment_by_hash(tmpctx, ld->wallet,
+							     rhash,
+							     failed_part->partid,
+							     failed_part->groupid);
 		return sendpay_fail(
 		    cmd, old_payment, PAY_TRY_OTHER_ROUTE, NULL, fail,
 		    sendpay_errmsg_fmt(tmpctx, PAY_TRY_OTHER_ROUTE, fail,
@@ -1085,7 +1297,7 @@ send_payment_core(struct lightningd *ld,
 	 * handle_missing_htlc_output -> onchain_failed_our_htlc ->
 	 * payment_failed with no payment.
 	 */
-	if (old_payment) {
+	if (failed_part) {
 		wallet_local_htlc_out_delete(ld->wallet, channel, rhash,
 					     partid);
 	}
@@ -1128,6 +1340,12 @@ send_payment_core(struct lightningd *ld,
 	/* We write this into db when HTLC is actually sent. */
 	wallet_payment_setup(ld->wallet, payment);
 
+	/* Keep track of it in memory while it's pending. */
+	add_part(parts, payment);
+	if (payment_parts_map_get(ld->payment_parts, rhash) != parts)
+		payment_parts_index(ld, parts);
+	tal_add_destructor2(payment, destroy_unstored_part, ld);
+
 	add_sendpay_waiter(ld, cmd, rhash, partid, group);
 	return command_still_pending(cmd);
 }
@@ -1699,6 +1917,8 @@ static struct command_result *json_delpay(struct command *cmd,
 	}
 
 	wallet_payment_delete(cmd->ld->wallet, payment_hash, groupid, partid, status);
+	/* Simplest to reload from db next time, if we're tracking it. */
+	tal_free(payment_parts_map_get(cmd->ld->payment_parts, payment_hash));
 
 	response = json_stream_success(cmd);
 	json_array_start(response, "payments");
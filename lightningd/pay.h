@@ -1,8 +1,11 @@
 #ifndef LIGHTNING_LIGHTNINGD_PAY_H
 #define LIGHTNING_LIGHTNINGD_PAY_H
 #include "config.h"
+#include <ccan/htable/htable_type.h>
 #include <common/errcode.h>
+#include <lightningd/htlc_set.h>
 
+struct command;
 struct htlc_out;
 struct lightningd;
 struct onionreply;
@@ -11,6 +14,88 @@ struct sha256;
 struct json_stream;
 struct wallet_payment;
 struct routing_failure;
+struct payment_part_map;
+
+/* (payment_hash, partid, groupid) uniquely identifies a payment part. */
+struct payment_part_id {
+	struct sha256 payment_hash;
+	u64 partid;
+	u64 groupid;
+};
+
+static inline size_t hash_payment_part_id(const struct payment_part_id *id)
+{
+	struct siphash24_ctx ctx;
+
+	siphash24_init(&ctx, siphash_seed());
+	siphash24_update(&ctx, &id->payment_hash, sizeof(id->payment_hash));
+	siphash24_u64(&ctx, id->partid);
+	siphash24_u64(&ctx, id->groupid);
+	return siphash24_done(&ctx);
+}
+
+/* Outstanding sendpay or waitsendpay command */
+struct sendpay_command {
+	struct payment_part_id id;
+	struct command *cmd;
+	/* The map we're in, so we can remove ourselves. */
+	struct sendpay_command_map *map;
+};
+
+static inline const struct payment_part_id *
+keyof_sendpay_command(const struct sendpay_command *pc)
+{
+	return &pc->id;
+}
+
+static inline bool sendpay_command_eq(const struct sendpay_command *pc,
+				      const struct payment_part_id *id)
+{
+	return sha256_eq(&pc->id.payment_hash, &id->payment_hash)
+		&& pc->id.partid == id->partid
+		&& pc->id.groupid == id->groupid;
+}
+
+HTABLE_DEFINE_TYPE(struct sendpay_command,
+		   keyof_sendpay_command,
+		   hash_payment_part_id,
+		   sendpay_command_eq,
+		   sendpay_command_map);
+
+/* Summary of all parts for a payment_hash, kept while any are pending so
+ * sendpay doesn't have to reload every previous attempt from the db. */
+struct payment_parts {
+	struct sha256 payment_hash;
+	/* The parts themselves, by partid (one per groupid). */
+	struct payment_part_map *parts;
+	/* Sum of msatoshi of the pending parts. */
+	struct amount_msat pending_msat;
+	size_t num_pending;
+	/* How many of the pending parts are partid 0 (non-parallel). */
+	size_t num_pending_nonparallel;
+	/* Valid if num_pending != 0 */
+	u64 pending_groupid;
+	struct amount_msat pending_total_msat;
+	size_t num_complete;
+};
+
+static inline const struct sha256 *
+keyof_payment_parts(const struct payment_parts *parts)
+{
+	return &parts->payment_hash;
+}
+
+static inline bool payment_parts_eq(const struct payment_parts *parts,
+				    const struct sha256 *payment_hash)
+{
+	return sha256_eq(&parts->payment_hash, payment_hash);
+}
+
+HTABLE_DEFINE_TYPE(struct payment_parts,
+		   keyof_payment_parts,
+		   hash_payment_hash,
+		   payment_parts_eq,
+		   payment_parts_map);
 
 void payment_succeeded(struct lightningd *ld, struct htlc_out *hout,
 		       const struct preimage *rval);
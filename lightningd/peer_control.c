@@ -77,6 +77,16 @@ static void destroy_peer(struct peer *peer)
 		peer_dbid_map_del(peer->ld->peers_by_dbid, peer);
 }
 
+/* peer_connected is part of what listchannelbalances reports. */
+static void peer_set_connected(struct peer *peer, enum peer_connect_state connected)
+{
+	struct channel *channel;
+
+	peer->connected = connected;
+	list_for_each(&peer->channels, channel, list)
+		channel_balance_changed(channel);
+}
+
 void peer_set_dbid(struct peer *peer, u64 dbid)
 {
 	assert(!peer->dbid);
@@ -443,26 +453,22 @@ void channel_errmsg(struct channel *channel,
 				       err_for_them ? "sent" : "received", desc);
 }
 
-static void json_add_htlcs(struct lightningd *ld,
-			   struct json_stream *response,
+static void json_add_htlcs(struct json_stream *response,
 			   const struct channel *channel)
 {
-	/* FIXME: make per-channel htlc maps! */
 	const struct htlc_in *hin;
-	struct htlc_in_map_iter ini;
 	const struct htlc_out *hout;
-	struct htlc_out_map_iter outi;
-	u32 local_feerate = get_feerate(channel->fee_states,
-					channel->opener, LOCAL);
+	u32 local_feerate;
+
+	/* Don't walk every HTLC if they're filtered out anyway. */
+	if (!json_stream_wants(response, "htlcs"))
+		return;
+
+	local_feerate = get_feerate(channel->fee_states, channel->opener, LOCAL);
 
 	/* FIXME: Add more fields. */
 	json_array_start(response, "htlcs");
-	for (hin = htlc_in_map_first(ld->htlcs_in, &ini);
-	     hin;
-	     hin = htlc_in_map_next(ld->htlcs_in, &ini)) {
-		if (hin->key.channel != channel)
-			continue;
-
+	list_for_each(&channel->htlcs_in, hin, list) {
 		json_object_start(response, NULL);
 		json_add_string(response, "direction", "in");
 		json_add_u64(response, "id", hin->key.id);
@@ -481,12 +487,7 @@ static void json_add_htlcs(struct lightningd *ld,
 		json_object_end(response);
 	}
 
-	for (hout = htlc_out_map_first(ld->htlcs_out, &outi);
-	     hout;
-	     hout = htlc_out_map_next(ld->htlcs_out, &outi)) {
-		if (hout->key.channel != channel)
-			continue;
-
+	list_for_each(&channel->htlcs_out, hout, list) {
 		json_object_start(response, NULL);
 		json_add_string(response, "direction", "out");
 		json_add_u64(response, "id", hout->key.id);
@@ -505,53 +506,59 @@ static void json_add_htlcs(struct lightningd *ld,
 	json_array_end(response);
 }
 
-/* Fee a commitment transaction would currently cost */
-static struct amount_sat commit_txfee(const struct channel *channel,
-				      struct amount_msat amount,
-				      enum side side)
+/* Would this HTLC appear in @side's commitment transaction? */
+static bool htlc_untrimmed(const struct channel *channel,
+			   enum side htlc_owner, struct amount_msat amount,
+			   enum side side)
 {
-	/* FIXME: make per-channel htlc maps! */
-	const struct htlc_in *hin;
-	struct htlc_in_map_iter ini;
-	const struct htlc_out *hout;
-	struct htlc_out_map_iter outi;
-	struct lightningd *ld = channel->peer->ld;
-	size_t num_untrimmed_htlcs = 0;
-	u32 feerate = get_feerate(channel->fee_states,
-				  channel->opener, side);
+	u32 feerate = get_feerate(channel->fee_states, channel->opener, side);
 	struct amount_sat dust_limit;
-	struct amount_sat fee;
-	bool option_anchor_outputs = channel_has(channel, OPT_ANCHOR_OUTPUTS);
-	bool option_anchors_zero_fee_htlc_tx = channel_has(channel, OPT_ANCHORS_ZERO_FEE_HTLC_TX);
 
 	if (side == LOCAL)
 		dust_limit = channel->our_config.dust_limit;
-	if (side == REMOTE)
+	else
 		dust_limit = channel->channel_info.their_config.dust_limit;
 
-	/* Assume we tried to add "amount" */
-	if (!htlc_is_trimmed(side, amount, feerate, dust_limit, side,
-			     option_anchor_outputs, option_anchors_zero_fee_htlc_tx))
-		num_untrimmed_htlcs++;
+	return !htlc_is_trimmed(htlc_owner, amount, feerate, dust_limit, side,
+				channel_has(channel, OPT_ANCHOR_OUTPUTS),
+				channel_has(channel, OPT_ANCHORS_ZERO_FEE_HTLC_TX));
+}
 
-	for (hin = htlc_in_map_first(ld->htlcs_in, &ini);
-	     hin;
-	     hin = htlc_in_map_next(ld->htlcs_in, &ini)) {
-		if (hin->key.channel != channel)
-			continue;
-		if (!htlc_is_trimmed(!side, hin->msat, feerate, dust_limit,
-				     side, option_anchor_outputs, option_anchors_zero_fee_htlc_tx))
+static size_t num_untrimmed_htlcs(const struct channel *channel,
+				  enum side side)
+{
+	const struct htlc_in *hin;
+	const struct htlc_out *hout;
+	size_t num_untrimmed_htlcs = 0;
+
+	/* Trimming depends on the feerate, so we can't keep a running count:
+	 * but this is bounded by max_accepted_htlcs, not by every HTLC. */
+	list_for_each(&channel->htlcs_in, hin, list) {
+		if (htlc_untrimmed(channel, !side, hin->msat, side))
 			num_untrimmed_htlcs++;
 	}
-	for (hout = htlc_out_map_first(ld->htlcs_out, &outi);
-	     hout;
-	     hout = htlc_out_map_next(ld->htlcs_out, &outi)) {
-		if (hout->key.channel != channel)
-			continue;
-		if (!htlc_is_trimmed(side, hout->msat, feerate, dust_limit,
-				     side, option_anchor_outputs, option_anchors_zero_fee_htlc_tx))
+	list_for_each(&channel->htlcs_out, hout, list) {
+		if (htlc_untrimmed(channel, side, hout->msat, side))
 			num_untrimmed_htlcs++;
 	}
+	return num_untrimmed_htlcs;
+}
+
+/* Fee a commitment transaction would currently cost */
+static struct amount_sat commit_txfee(const struct channel *channel,
+				      struct amount_msat amount,
+				      enum side side,
+				      size_t num_untrimmed_htlcs)
+{
+	u32 feerate = get_feerate(channel->fee_states,
+				  channel->opener, side);
+	struct amount_sat fee;
+	bool option_anchor_outputs = channel_has(channel, OPT_ANCHOR_OUTPUTS);
+	bool option_anchors_zero_fee_htlc_tx = channel_has(channel, OPT_ANCHORS_ZERO_FEE_HTLC_TX);
+
+	/* Assume we tried to add "amount" */
+	if (htlc_untrimmed(channel, side, amount, side))
+		num_untrimmed_htlcs++;
 
 	/*
 	 * BOLT #2:
@@ -582,41 +589,12 @@ static struct amount_sat commit_txfee(const struct channel *channel,
 	return fee;
 }
 
-static void subtract_offered_htlcs(const struct channel *channel,
-				   struct amount_msat *amount)
-{
-	const struct htlc_out *hout;
-	struct htlc_out_map_iter outi;
-	struct lightningd *ld = channel->peer->ld;
-
-	for (hout = htlc_out_map_first(ld->htlcs_out, &outi);
-	     hout;
-	     hout = htlc_out_map_next(ld->htlcs_out, &outi)) {
-		if (hout->key.channel != channel)
-			continue;
-		if (!amount_msat_sub(amount, *amount, hout->msat))
-			*amount = AMOUNT_MSAT(0);
-	}
-}
-
-static void subtract_received_htlcs(const struct channel *channel,
-				    struct amount_msat *amount)
-{
-	const struct htlc_in *hin;
-	struct htlc_in_map_iter ini;
-	struct lightningd *ld = channel->peer->ld;
-
-	for (hin = htlc_in_map_first(ld->htlcs_in, &ini);
-	     hin;
-	     hin = htlc_in_map_next(ld->htlcs_in, &ini)) {
-		if (hin->key.channel != channel)
-			continue;
-		if (!amount_msat_sub(amount, *amount, hin->msat))
-			*amount = AMOUNT_MSAT(0);
-	}
-}
-
-struct amount_msat channel_amount_spendable(const struct channel *channel)
+/* @offered is the total of the HTLCs we have offered, and
+ * @num_untrimmed_local how many HTLCs are in our commitment tx (only
+ * needed if we're the opener). */
+static struct amount_msat amount_spendable(const struct channel *channel,
+					   struct amount_msat offered,
+					   size_t num_untrimmed_local)
 {
 	struct amount_msat spendable;
 	bool wumbo;
@@ -628,13 +606,15 @@ struct amount_msat channel_amount_spendable(const struct channel *channel)
 		return AMOUNT_MSAT(0);
 
 	/* Take away any currently-offered HTLCs. */
-	subtract_offered_htlcs(channel, &spendable);
+	if (!amount_msat_sub(&spendable, spendable, offered))
+		return AMOUNT_MSAT(0);
 
 	/* If we're opener, subtract txfees we'll need to spend this */
 	if (channel->opener == LOCAL) {
 		if (!amount_msat_sub_sat(&spendable, spendable,
 					 commit_txfee(channel, spendable,
-						      LOCAL)))
+						      LOCAL,
+						      num_untrimmed_local)))
 			return AMOUNT_MSAT(0);
 	}
 
@@ -656,7 +636,19 @@ struct amount_msat channel_amount_spendable(const struct channel *channel)
 	return spendable;
 }
 
-struct amount_msat channel_amount_receivable(const struct channel *channel)
+struct amount_msat channel_amount_spendable(const struct channel *channel)
+{
+	return amount_spendable(channel, channel->htlcs_out_msat,
+				channel->opener == LOCAL
+				? num_untrimmed_htlcs(channel, LOCAL) : 0);
+}
+
+/* @received is the total of the HTLCs they have offered, and
+ * @num_untrimmed_remote how many HTLCs are in their commitment tx (only
+ * needed if they're the opener). */
+static struct amount_msat amount_receivable(const struct channel *channel,
+					    struct amount_msat received,
+					    size_t num_untrimmed_remote)
 {
 	struct amount_msat their_msat, receivable;
 	bool wumbo;
@@ -672,13 +664,15 @@ struct amount_msat channel_amount_receivable(const struct channel *channel)
 		return AMOUNT_MSAT(0);
 
 	/* Take away any currently-offered HTLCs. */
-	subtract_received_htlcs(channel, &receivable);
+	if (!amount_msat_sub(&receivable, receivable, received))
+		return AMOUNT_MSAT(0);
 
 	/* If they're opener, subtract txfees they'll need to spend this */
 	if (channel->opener == REMOTE) {
 		if (!amount_msat_sub_sat(&receivable, receivable,
 					 commit_txfee(channel,
-						      receivable, REMOTE)))
+						      receivable, REMOTE,
+						      num_untrimmed_remote)))
 			return AMOUNT_MSAT(0);
 	}
 
@@ -699,6 +693,13 @@ struct amount_msat channel_amount_receivable(const struct channel *channel)
 	return receivable;
 }
 
+struct amount_msat channel_amount_receivable(const struct channel *channel)
+{
+	return amount_receivable(channel, channel->htlcs_in_msat,
+				 channel->opener == REMOTE
+				 ? num_untrimmed_htlcs(channel, REMOTE) : 0);
+}
+
 void json_add_channel_type(struct json_stream *response,
 			   const char *fieldname,
 			   const struct channel_type *channel_type)
@@ -722,6 +723,22 @@ void json_add_channel_type(struct json_stream *response,
 	json_object_end(response);
 }
 
+static bool wants_channel_stats(const struct json_stream *response)
+{
+	static const char *fields[] = {
+		"in_payments_offered", "in_offered_msat",
+		"in_payments_fulfilled", "in_fulfilled_msat",
+		"out_payments_offered", "out_offered_msat",
+		"out_payments_fulfilled", "out_fulfilled_msat",
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(fields); i++) {
+		if (json_stream_wants(response, fields[i]))
+			return true;
+	}
+	return false;
+}
+
 static void json_add_channel(struct lightningd *ld,
 			     struct json_stream *response, const char *key,
 			     const struct channel *channel,
@@ -993,14 +1010,16 @@ static void json_add_channel(struct lightningd *ld,
 				 channel->channel_info.their_config.channel_reserve);
 
 	/* append spendable to JSON output */
-	json_add_amount_msat(response,
-			     "spendable_msat",
-			     channel_amount_spendable(channel));
+	if (json_stream_wants(response, "spendable_msat"))
+		json_add_amount_msat(response,
+				     "spendable_msat",
+				     channel_amount_spendable(channel));
 
 	/* append receivable to JSON output */
-	json_add_amount_msat(response,
-			     "receivable_msat",
-			     channel_amount_receivable(channel));
+	if (json_stream_wants(response, "receivable_msat"))
+		json_add_amount_msat(response,
+				     "receivable_msat",
+				     channel_amount_receivable(channel));
 
 	json_add_amount_msat(response,
 			     "minimum_htlc_in_msat",
@@ -1023,22 +1042,26 @@ static void json_add_channel(struct lightningd *ld,
 	json_add_num(response, "max_accepted_htlcs",
 		     channel->our_config.max_accepted_htlcs);
 
-	state_changes = wallet_state_change_get(ld->wallet, tmpctx, channel->dbid);
-	json_array_start(response, "state_changes");
-	for (size_t i = 0; i < tal_count(state_changes); i++) {
-		json_object_start(response, NULL);
-		json_add_timeiso(response, "timestamp",
-				 &state_changes[i].timestamp);
-		json_add_string(response, "old_state",
-				channel_state_str(state_changes[i].old_state));
-		json_add_string(response, "new_state",
-				channel_state_str(state_changes[i].new_state));
-		json_add_string(response, "cause",
-				channel_change_state_reason_str(state_changes[i].cause));
-		json_add_string(response, "message", state_changes[i].message);
-		json_object_end(response);
+	/* Don't hit the db if they don't want these */
+	if (json_stream_wants(response, "state_changes")) {
+		state_changes = wallet_state_change_get(ld->wallet, tmpctx,
+							channel->dbid);
+		json_array_start(response, "state_changes");
+		for (size_t i = 0; i < tal_count(state_changes); i++) {
+			json_object_start(response, NULL);
+			json_add_timeiso(response, "timestamp",
+					 &state_changes[i].timestamp);
+			json_add_string(response, "old_state",
+					channel_state_str(state_changes[i].old_state));
+			json_add_string(response, "new_state",
+					channel_state_str(state_changes[i].new_state));
+			json_add_string(response, "cause",
+					channel_change_state_reason_str(state_changes[i].cause));
+			json_add_string(response, "message", state_changes[i].message);
+			json_object_end(response);
+		}
+		json_array_end(response);
 	}
-	json_array_end(response);
 
 	json_array_start(response, "status");
 	for (size_t i = 0; i < ARRAY_SIZE(channel->billboard.permanent); i++) {
@@ -1051,30 +1074,33 @@ static void json_add_channel(struct lightningd *ld,
 		json_add_string(response, NULL, channel->billboard.transient);
 	json_array_end(response);
 
-	/* Provide channel statistics */
-	wallet_channel_stats_load(ld->wallet, channel->dbid, &channel_stats);
-	json_add_u64(response, "in_payments_offered",
-		     channel_stats.in_payments_offered);
-	json_add_amount_msat(response,
-			     "in_offered_msat",
-			     channel_stats.in_msatoshi_offered);
-	json_add_u64(response, "in_payments_fulfilled",
-		     channel_stats.in_payments_fulfilled);
-	json_add_amount_msat(response,
-			     "in_fulfilled_msat",
-			     channel_stats.in_msatoshi_fulfilled);
-	json_add_u64(response, "out_payments_offered",
-		     channel_stats.out_payments_offered);
-	json_add_amount_msat(response,
-			     "out_offered_msat",
-			     channel_stats.out_msatoshi_offered);
-	json_add_u64(response, "out_payments_fulfilled",
-		     channel_stats.out_payments_fulfilled);
-	json_add_amount_msat(response,
-			     "out_fulfilled_msat",
-			     channel_stats.out_msatoshi_fulfilled);
+	/* Provide channel statistics (only load them if they're wanted) */
+	if (wants_channel_stats(response)) {
+		wallet_channel_stats_load(ld->wallet, channel->dbid,
+					  &channel_stats);
+		json_add_u64(response, "in_payments_offered",
+			     channel_stats.in_payments_offered);
+		json_add_amount_msat(response,
+				     "in_offered_msat",
+				     channel_stats.in_msatoshi_offered);
+		json_add_u64(response, "in_payments_fulfilled",
+			     channel_stats.in_payments_fulfilled);
+		json_add_amount_msat(response,
+				     "in_fulfilled_msat",
+				     channel_stats.in_msatoshi_fulfilled);
+		json_add_u64(response, "out_payments_offered",
+			     channel_stats.out_payments_offered);
+		json_add_amount_msat(response,
+				     "out_offered_msat",
+				     channel_stats.out_msatoshi_offered);
+		json_add_u64(response, "out_payments_fulfilled",
+			     channel_stats.out_payments_fulfilled);
+		json_add_amount_msat(response,
+				     "out_fulfilled_msat",
+				     channel_stats.out_msatoshi_fulfilled);
+	}
 
-	json_add_htlcs(ld, response, channel);
+	json_add_htlcs(response, channel);
 	json_object_end(response);
 }
 
@@ -1229,7 +1255,7 @@ static void peer_connected_hook_final(struct peer_connected_hook_payload *payloa
 
 	/* Now we finally consider ourselves connected! */
 	assert(peer->connected == PEER_CONNECTING);
-	peer->connected = PEER_CONNECTED;
+	peer_set_connected(peer, PEER_CONNECTED);
 
 	/* Succeed any connect() commands */
 	connect_succeeded(ld, peer, payload->incoming, &payload->addr);
@@ -1441,7 +1467,7 @@ void peer_connected(struct lightningd *ld, const u8 *msg)
 
 	/* We mark peer in "connecting" state until hooks have passed. */
 	assert(peer->connected == PEER_DISCONNECTED);
-	peer->connected = PEER_CONNECTING;
+	peer_set_connected(peer, PEER_CONNECTING);
 
 	/* Update peer address and direction */
 	peer->addr = hook_payload->addr;
@@ -1595,7 +1621,7 @@ void peer_spoke(struct lightningd *ld, const u8 *msg)
 		channel = new_unsaved_channel(peer,
 					      peer->ld->config.fee_base,
 					      peer->ld->config.fee_per_satoshi);
-		channel->cid = channel_id;
+		channel_set_cid(channel, &channel_id);
 		if (socketpair(AF_LOCAL, SOCK_STREAM, 0, fds) != 0) {
 			log_broken(ld->log,
 				   "Failed to create socketpair: %s",
@@ -1669,7 +1695,7 @@ void peer_disconnect_done(struct lightningd *ld, const u8 *msg)
 	if (p) {
 		assert(p->connectd_counter == connectd_counter);
 		log_peer_debug(ld->log, &id, "peer_disconnect_done");
-		p->connected = PEER_DISCONNECTED;
+		peer_set_connected(p, PEER_DISCONNECTED);
 	}
 
 	/* If you were trying to connect, it failed. */
@@ -1757,6 +1783,7 @@ static void update_channel_from_inflight(struct lightningd *ld,
 	channel->funding = inflight->funding->outpoint;
 	channel->funding_sats = inflight->funding->total_funds;
 	channel->our_funds = inflight->funding->our_funds;
+	channel_balance_changed(channel);
 
 	/* Lease infos ! */
 	channel->lease_expiry = inflight->lease_expiry;
@@ -1856,8 +1883,8 @@ static enum watch_result funding_depth_cb(struct lightningd *ld,
 		/* If we restart, we could already have peer->scid from database,
 		 * we don't need to update scid for stub channels(1x1x1) */
 		if (!channel->scid) {
-			channel->scid = tal(channel, struct short_channel_id);
-			*channel->scid = scid;
+			channel_set_scid(channel, &scid);
+			channel_balance_changed(channel);
 			wallet_channel_save(ld->wallet, channel);
 
 		} else if (!short_channel_id_eq(channel->scid, &scid) &&
@@ -1881,7 +1908,8 @@ static enum watch_result funding_depth_cb(struct lightningd *ld,
 					       short_channel_id_to_str(tmpctx, &scid),
 					       short_channel_id_to_str(tmpctx, channel->scid));
 
-			*channel->scid = scid;
+			channel_set_scid(channel, &scid);
+			channel_balance_changed(channel);
 			wallet_channel_save(ld->wallet, channel);
 			return KEEP_WATCHING;
 		}
@@ -2159,6 +2187,142 @@ static const struct json_command listpeerchannels_command = {
 };
 AUTODATA(json_command, &listpeerchannels_command);
 
+static bool channel_balance_stale(const struct channel *channel)
+{
+	return channel->balance.gen != channel->balance_gen;
+}
+
+/* Only channels which changed since we last looked need recalculating. */
+static void refresh_channel_balances(struct lightningd *ld)
+{
+	struct peer *peer;
+	struct peer_node_id_map_iter it;
+	struct channel *channel;
+
+	for (peer = peer_node_id_map_first(ld->peers, &it);
+	     peer;
+	     peer = peer_node_id_map_next(ld->peers, &it)) {
+		list_for_each(&peer->channels, channel, list) {
+			struct channel_balance *b = &channel->balance;
+
+			if (channel_unsaved(channel)
+			    || !channel_balance_stale(channel))
+				continue;
+			b->offered = channel->htlcs_out_msat;
+			b->received = channel->htlcs_in_msat;
+			for (enum side side = 0; side < NUM_SIDES; side++)
+				b->num_untrimmed[side]
+					= num_untrimmed_htlcs(channel, side);
+			b->num_htlcs = channel->num_htlcs_in
+				+ channel->num_htlcs_out;
+			b->spendable = amount_spendable(channel, b->offered,
+							b->num_untrimmed[LOCAL]);
+			b->receivable = amount_receivable(channel, b->received,
+							  b->num_untrimmed[REMOTE]);
+			b->gen = channel->balance_gen;
+		}
+	}
+}
+
+static void json_add_channel_balance(struct lightningd *ld,
+				     struct json_stream *response,
+				     struct channel *channel)
+{
+	const struct channel_balance *balance = &channel->balance;
+	struct amount_msat funding_msat;
+
+	json_object_start(response, NULL);
+	json_add_node_id(response, "peer_id", &channel->peer->id);
+	json_add_bool(response, "peer_connected",
+		      channel->peer->connected == PEER_CONNECTED);
+	json_add_string(response, "state", channel_state_name(channel));
+	if (channel->scid)
+		json_add_short_channel_id(response, "short_channel_id",
+					  channel->scid);
+	if (channel->alias[LOCAL] || channel->alias[REMOTE]) {
+		json_object_start(response, "alias");
+		if (channel->alias[LOCAL])
+			json_add_short_channel_id(response, "local",
+						  channel->alias[LOCAL]);
+		if (channel->alias[REMOTE])
+			json_add_short_channel_id(response, "remote",
+						  channel->alias[REMOTE]);
+		json_object_end(response);
+	}
+	/* As in listpeerchannels: only usable channels get a direction. */
+	if (channel->scid || channel->alias[LOCAL] || channel->alias[REMOTE])
+		json_add_num(response, "direction",
+			     node_id_idx(&ld->id, &channel->peer->id));
+	json_add_channel_id(response, "channel_id", &channel->cid);
+	json_add_txid(response, "funding_txid", &channel->funding.txid);
+	json_add_bool(response, "private",
+		      !(channel->channel_flags & CHANNEL_FLAGS_ANNOUNCE_CHANNEL));
+	if (!amount_sat_to_msat(&funding_msat, channel->funding_sats))
+		funding_msat = AMOUNT_MSAT(0);
+	json_add_amount_msat(response, "total_msat", funding_msat);
+	json_add_amount_msat(response, "to_us_msat", channel->our_msat);
+	json_add_amount_msat(response, "spendable_msat", balance->spendable);
+	json_add_amount_msat(response, "receivable_msat", balance->receivable);
+	json_add_num(response, "max_accepted_htlcs",
+		     channel->our_config.max_accepted_htlcs);
+	json_add_num(response, "num_htlcs", balance->num_htlcs);
+	json_add_u64(response, "generation", channel->balance_gen);
+	json_object_end(response);
+}
+
+static void json_add_channel_balances(struct lightningd *ld,
+				      struct json_stream *response,
+				      u64 since)
+{
+	struct peer *peer;
+	struct peer_node_id_map_iter it;
+	struct channel *channel;
+
+	refresh_channel_balances(ld);
+
+	json_add_u64(response, "generation", ld->channel_balance_gen);
+	json_array_start(response, "channels");
+	for (peer = peer_node_id_map_first(ld->peers, &it);
+	     peer;
+	     peer = peer_node_id_map_next(ld->peers, &it)) {
+		list_for_each(&peer->channels, channel, list) {
+			if (channel_unsaved(channel))
+				continue;
+			if (channel->balance_gen <= since)
+				continue;
+			json_add_channel_balance(ld, response, channel);
+		}
+	}
+	json_array_end(response);
+}
+
+static struct command_result *json_listchannelbalances(struct command *cmd,
+						       const char *buffer,
+						       const jsmntok_t *obj UNNEEDED,
+						       const jsmntok_t *params)
+{
+	u64 *since;
+	struct json_stream *response;
+
+	if (!param(cmd, buffer, params,
+		   p_opt_def("since", param_u64, &since, 0),
+		   NULL))
+		return command_param_failed();
+
+	response = json_stream_success(cmd);
+	json_add_channel_balances(cmd->ld, response, *since);
+	return command_success(cmd, response);
+}
+
+static const struct json_command listchannelbalances_command = {
+	"listchannelbalances",
+	"network",
+	json_listchannelbalances,
+	"Show the spendable and receivable amounts of our channels,"
+	" optionally only those which changed after generation {since}."
+};
+AUTODATA(json_command, &listchannelbalances_command);
+
 struct command_result *
 command_find_channel(struct command *cmd,
 		     const char *buffer, const jsmntok_t *tok,
@@ -37,7 +37,7 @@ struct peer {
 	struct list_head channels;
 
 	/* Are we connected? */
-	enum {
+	enum peer_connect_state {
 		/* Connectd said we're connecting, we called hooks... */
 		PEER_CONNECTING,
 		/* Hooks succeeded, we're connected. */
@@ -27,16 +27,22 @@
 #define SUPERVERBOSE(...)
 #endif
 
+/* How often (in commitments) we archive resolved HTLCs, how long ago they
+ * must have been resolved, and how many we move at once. */
+#define HTLC_ARCHIVE_INTERVAL 100
+#define HTLC_ARCHIVE_DEPTH 1000
+#define HTLC_ARCHIVE_BATCH 1000
+
 static bool state_update_ok(struct channel *channel,
 			    enum htlc_state oldstate, enum htlc_state newstate,
 			    u64 htlc_id, const char *dir)
 {
 	enum htlc_state expected = oldstate + 1;
 
-	/* We never get told about RCVD_REMOVE_HTLC, so skip over that
-	 * (we initialize in SENT_ADD_HTLC / RCVD_ADD_COMMIT, so those
-	 * work). */
-	if (expected == RCVD_REMOVE_HTLC)
+	/* We're only told about RCVD_REMOVE_HTLC when channeld passes
+	 * a preimage through early, so otherwise skip over that (we
+	 * initialize in SENT_ADD_HTLC / RCVD_ADD_COMMIT, so those work). */
+	if (expected == RCVD_REMOVE_HTLC && newstate != RCVD_REMOVE_HTLC)
 		expected = RCVD_REMOVE_COMMIT;
 
 	if (newstate != expected) {
@@ -568,6 +574,7 @@ static void rcvd_htlc_reply(struct subd *subd, const u8 *msg, const int *fds UNU
 
 	/* Add it to lookup table now we know id. */
 	connect_htlc_out(subd->ld->htlcs_out, hout);
+	channel_balance_changed(hout->key.channel);
 
 	/* When channeld includes it in commitment, we'll make it persistent. */
 }
@@ -1183,11 +1190,34 @@ static bool ecdh_maybe_blinding(const struct pubkey *ephemeral_key,
 	return true;
 }
 
-REGISTER_PLUGIN_HOOK(htlc_accepted,
-		     htlc_accepted_hook_deserialize,
-		     htlc_accepted_hook_final,
-		     htlc_accepted_hook_serialize,
-		     struct htlc_accepted_hook_payload *);
+/* Filters are TLV types: only matches final hops which have one. */
+static bool htlc_accepted_hook_filter(struct htlc_accepted_hook_payload *p,
+				      const struct hook_filter *filter)
+{
+	const struct tlv_field *fields;
+
+	if (p->route_step->nextcase != ONION_END)
+		return false;
+
+	/* We reject unknown even types, but the plugin may not (keysend!) */
+	if (!p->payload)
+		return true;
+
+	fields = p->payload->tlv->fields;
+	for (size_t i = 0; i < tal_count(fields); i++) {
+		if (fields[i].numtype >= filter->min
+		    && fields[i].numtype <= filter->max)
+			return true;
+	}
+	return false;
+}
+
+REGISTER_FILTERED_PLUGIN_HOOK(htlc_accepted,
+			      htlc_accepted_hook_deserialize,
+			      htlc_accepted_hook_final,
+			      htlc_accepted_hook_serialize,
+			      htlc_accepted_hook_filter,
+			      struct htlc_accepted_hook_payload *);
 
 
 /* Figures out how to fwd, allocating return off hp */
@@ -1489,27 +1519,68 @@ static bool peer_fulfilled_our_htlc(struct channel *channel,
 	if (!htlc_out_update_state(channel, hout, RCVD_REMOVE_COMMIT))
 		return false;
 
-	fulfill_our_htlc_out(channel, hout, &fulfilled->payment_preimage);
+	/* channeld usually told us already, via peer_got_preimage */
+	if (!hout->preimage)
+		fulfill_our_htlc_out(channel, hout,
+				     &fulfilled->payment_preimage);
 	return true;
 }
 
+void peer_got_preimage(struct channel *channel, const u8 *msg)
+{
+	struct lightningd *ld = channel->peer->ld;
+	struct htlc_out *hout;
+	struct preimage preimage;
+	struct sha256 payment_hash;
+	u64 id;
+
+	if (!fromwire_channeld_got_preimage(msg, &id, &preimage)) {
+		channel_internal_error(channel,
+				       "bad fromwire_channeld_got_preimage %s",
+				       tal_hex(channel, msg));
+		return;
+	}
+
+	hout = find_htlc_out(ld->htlcs_out, channel, id);
+	if (!hout) {
+		channel_internal_error(channel,
+				       "got_preimage unknown htlc %"PRIu64, id);
+		return;
+	}
+
+	sha256(&payment_hash, &preimage, sizeof(preimage));
+	if (!sha256_eq(&payment_hash, &hout->payment_hash)) {
+		channel_internal_error(channel,
+				       "got_preimage bad preimage for htlc %"PRIu64,
+				       id);
+		return;
+	}
+
+	/* Peer can resend update_fulfill_htlc after reconnect: we
+	 * rolled back our state for channeld, but kept the preimage. */
+	if (hout->preimage)
+		return;
+
+	/* This isn't committed yet, but the preimage is all we need to
+	 * claim onchain.  Save it along with our upstream fulfill, so
+	 * neither can be lost without the other. */
+	if (!htlc_out_update_state(channel, hout, RCVD_REMOVE_HTLC))
+		return;
+
+	log_debug(channel->log, "Got preimage for HTLC %"PRIu64" early", id);
+	fulfill_our_htlc_out(channel, hout, &preimage);
+}
+
 void onchain_fulfilled_htlc(struct channel *channel,
 			    const struct preimage *preimage)
 {
-	struct htlc_out_map_iter outi;
 	struct htlc_out *hout;
 	struct sha256 payment_hash;
-	struct lightningd *ld = channel->peer->ld;
 
 	sha256(&payment_hash, preimage, sizeof(*preimage));
 
 	/* FIXME: use db to look this up! */
-	for (hout = htlc_out_map_first(ld->htlcs_out, &outi);
-	     hout;
-	     hout = htlc_out_map_next(ld->htlcs_out, &outi)) {
-		if (hout->key.channel != channel)
-			continue;
-
+	list_for_each(&channel->htlcs_out, hout, list) {
 		/* It's possible that we failed some and succeeded one,
 		 * if we got multiple errors. */
 		if (hout->failmsg || hout->failonion)
@@ -1545,6 +1616,19 @@ static bool peer_failed_our_htlc(struct channel *channel,
 		return false;
 	}
 
+	/* After reconnect, they could fail an HTLC they'd already given
+	 * us the preimage for.  We've fulfilled upstream, and we can't
+	 * account for it failing here as well, so go onchain: there they
+	 * either claim it using the preimage, or we time it out. */
+	if (hout->preimage) {
+		channel_fail_permanent(channel,
+				       REASON_PROTOCOL,
+				       "Peer failed HTLC %"PRIu64
+				       " after fulfilling it",
+				       hout->key.id);
+		return false;
+	}
+
 	if (!htlc_out_update_state(channel, hout, RCVD_REMOVE_COMMIT))
 		return false;
 
@@ -1824,6 +1908,7 @@ static void remove_htlc_in(struct channel *channel, struct htlc_in *hin)
 	}
 
 	tal_free(hin);
+	channel_balance_changed(channel);
 }
 
 static void remove_htlc_out(struct channel *channel, struct htlc_out *hout)
@@ -1878,6 +1963,7 @@ static void remove_htlc_out(struct channel *channel, struct htlc_out *hout)
 	}
 
 	tal_free(hout);
+	channel_balance_changed(channel);
 }
 
 static bool update_in_htlc(struct channel *channel,
@@ -2018,6 +2104,14 @@ static bool peer_save_commitsig_sent(struct channel *channel, u64 commitnum)
 
 	/* FIXME: Save to database, with sig and HTLCs. */
 	wallet_channel_save(ld->wallet, channel);
+
+	/* Every so often, move long-resolved HTLCs out of the way. */
+	if (channel->next_index[REMOTE] % HTLC_ARCHIVE_INTERVAL == 0
+	    && channel->next_index[REMOTE] > HTLC_ARCHIVE_DEPTH)
+		wallet_htlcs_archive(ld->wallet, channel,
+				     channel->next_index[REMOTE]
+				     - HTLC_ARCHIVE_DEPTH,
+				     HTLC_ARCHIVE_BATCH);
 	return true;
 }
 
@@ -2055,6 +2149,9 @@ void peer_sending_commitsig(struct channel *channel, const u8 *msg)
 		return;
 	}
 
+	/* HTLC states and feerates move on: our balance follows. */
+	channel_balance_changed(channel);
+
 	for (i = 0; i < tal_count(changed_htlcs); i++) {
 		if (!changed_htlc(channel, changed_htlcs + i)) {
 			channel_internal_error(channel,
@@ -2261,6 +2358,8 @@ void peer_got_commitsig(struct channel *channel, const u8 *msg)
 		return;
 	}
 
+	channel_balance_changed(channel);
+
 	/* If we're not synced with bitcoin network, we can't accept
 	 * any new HTLCs.  We stall at this point, in the hope that it
 	 * won't take long! */
@@ -2421,6 +2520,8 @@ void peer_got_revoke(struct channel *channel, const u8 *msg)
 		return;
 	}
 
+	channel_balance_changed(channel);
+
 	log_debug(channel->log,
 		  "got revoke %"PRIu64": %zu changed",
 		  revokenum, tal_count(changed));
@@ -2532,23 +2633,15 @@ const struct existing_htlc **peer_htlcs(const tal_t *ctx,
 					const struct channel *channel)
 {
 	struct existing_htlc **htlcs;
-	struct htlc_in_map_iter ini;
-	struct htlc_out_map_iter outi;
 	struct htlc_in *hin;
 	struct htlc_out *hout;
-	struct lightningd *ld = channel->peer->ld;
 
 	htlcs = tal_arr(ctx, struct existing_htlc *, 0);
 
-	for (hin = htlc_in_map_first(ld->htlcs_in, &ini);
-	     hin;
-	     hin = htlc_in_map_next(ld->htlcs_in, &ini)) {
+	list_for_each(&channel->htlcs_in, hin, list) {
 		struct failed_htlc *f;
 		struct existing_htlc *existing;
 
-		if (hin->key.channel != channel)
-			continue;
-
 		if (hin->badonion)
 			f = take(mk_failed_htlc_badonion(NULL, hin, hin->badonion));
 		else if (hin->failonion)
@@ -2566,14 +2659,11 @@ const struct existing_htlc **peer_htlcs(const tal_t *ctx,
 		tal_arr_expand(&htlcs, existing);
 	}
 
-	for (hout = htlc_out_map_first(ld->htlcs_out, &outi);
-	     hout;
-	     hout = htlc_out_map_next(ld->htlcs_out, &outi)) {
+	list_for_each(&channel->htlcs_out, hout, list) {
 		struct failed_htlc *f;
 		struct existing_htlc *existing;
-
-		if (hout->key.channel != channel)
-			continue;
+		enum htlc_state hstate = hout->hstate;
+		const struct preimage *preimage = hout->preimage;
 
 		/* Note that channeld doesn't actually care *why* outgoing
 		 * HTLCs failed, so just use a dummy here. */
@@ -2588,12 +2678,28 @@ const struct existing_htlc **peer_htlcs(const tal_t *ctx,
 		} else
 			f = NULL;
 
-		existing = new_existing_htlc(htlcs, hout->key.id, hout->hstate,
+		/* BOLT #2:
+		 *
+		 * A node:
+		 *...
+		 *   - upon disconnection:
+		 *     - MUST reverse any uncommitted updates sent by the other side (i.e. all
+		 *     messages beginning with `update_` for which no `commitment_signed` has
+		 *     been received).
+		 *
+		 * So a preimage we got early is forgotten by channeld (the
+		 * peer will resend it), though we keep it ourselves. */
+		if (hstate == RCVD_REMOVE_HTLC && preimage) {
+			hstate = SENT_ADD_ACK_REVOCATION;
+			preimage = NULL;
+		}
+
+		existing = new_existing_htlc(htlcs, hout->key.id, hstate,
 					     hout->msat, &hout->payment_hash,
 					     hout->cltv_expiry,
 					     hout->onion_routing_packet,
 					     hout->blinding,
-					     hout->preimage,
+					     preimage,
 					     f);
 		tal_arr_expand(&htlcs, existing);
 	}
@@ -2612,13 +2718,22 @@ void free_htlcs(struct lightningd *ld, const struct channel *channel)
 
 	/* FIXME: Implement check_htlcs to ensure no dangling hout->in ptrs! */
 
+	/* Each removes itself from the channel's list as we free it */
+	if (channel) {
+		while ((hout = list_top(&channel->htlcs_out,
+					struct htlc_out, list)) != NULL)
+			tal_free(hout);
+		while ((hin = list_top(&channel->htlcs_in,
+				       struct htlc_in, list)) != NULL)
+			tal_free(hin);
+		return;
+	}
+
 	do {
 		deleted = false;
 		for (hout = htlc_out_map_first(ld->htlcs_out, &outi);
 		     hout;
 		     hout = htlc_out_map_next(ld->htlcs_out, &outi)) {
-			if (channel && hout->key.channel != channel)
-				continue;
 			tal_free(hout);
 			deleted = true;
 		}
@@ -2626,8 +2741,6 @@ void free_htlcs(struct lightningd *ld, const struct channel *channel)
 		for (hin = htlc_in_map_first(ld->htlcs_in, &ini);
 		     hin;
 		     hin = htlc_in_map_next(ld->htlcs_in, &ini)) {
-			if (channel && hin->key.channel != channel)
-				continue;
 			tal_free(hin);
 			deleted = true;
 		}
@@ -2956,6 +3069,10 @@ static void listforwardings_add_forwardings(struct json_stream *response,
 {
 	const struct forwarding *forwardings;
 
+	/* Don't even query the db if they're filtered out. */
+	if (!json_stream_wants(response, "forwards"))
+		return;
+
 	forwardings = wallet_forwarded_payments_get(wallet, tmpctx, status, chan_in, chan_out);
 
 	json_array_start(response, "forwards");
@@ -1341,7 +1341,7 @@ static const char *plugin_subscriptions_add(struct plugin *plugin,
 static const char *plugin_hooks_add(struct plugin *plugin, const char *buffer,
 				    const jsmntok_t *resulttok)
 {
-	const jsmntok_t *t, *hookstok, *beforetok, *aftertok;
+	const jsmntok_t *t, *hookstok, *beforetok, *aftertok, *filterstok;
 	size_t i;
 
 	hookstok = json_get_member(buffer, resulttok, "hooks");
@@ -1350,6 +1350,7 @@ static const char *plugin_hooks_add(struct plugin *plugin, const char *buffer,
 
 	json_for_each_arr(i, t, hookstok) {
 		char *name;
+		const char *err;
 		struct plugin_hook *hook;
 
 		if (t->type == JSMN_OBJECT) {
@@ -1363,10 +1364,11 @@ static const char *plugin_hooks_add(struct plugin *plugin, const char *buffer,
 			name = json_strdup(tmpctx, buffer, nametok);
 			beforetok = json_get_member(buffer, t, "before");
 			aftertok = json_get_member(buffer, t, "after");
+			filterstok = json_get_member(buffer, t, "filters");
 		} else {
 			/* FIXME: deprecate in 3 releases after v0.9.2! */
 			name = json_strdup(tmpctx, plugin->buffer, t);
-			beforetok = aftertok = NULL;
+			beforetok = aftertok = filterstok = NULL;
 		}
 
 		hook = plugin_hook_register(plugin, name);
@@ -1379,6 +1381,10 @@ static const char *plugin_hooks_add(struct plugin *plugin, const char *buffer,
 		}
 
 		plugin_hook_add_deps(hook, plugin, buffer, beforetok, aftertok);
+		err = plugin_hook_add_filters(plugin, hook, plugin, buffer,
+					      filterstok);
+		if (err)
+			return err;
 		tal_free(name);
 	}
 	return NULL;
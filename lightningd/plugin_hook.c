@@ -25,6 +25,9 @@ struct hook_instance {
 
 	/* Dependencies it asked for. */
 	const char **before, **after;
+
+	/* Only call if one of these match (NULL == call always). */
+	struct hook_filter *filters;
 };
 
 /* A link in the plugin_hook call chain (there's a joke in there about
@@ -97,6 +100,7 @@ struct plugin_hook *plugin_hook_register(struct plugin *plugin, const char *meth
 	h->plugin = plugin;
 	h->before = tal_arr(h, const char *, 0);
 	h->after = tal_arr(h, const char *, 0);
+	h->filters = NULL;
 	tal_add_destructor2(h, destroy_hook_instance, hook);
 
 	tal_arr_expand(&hook->hooks, h);
@@ -245,49 +249,75 @@ static void plugin_hook_call_next(struct plugin_hook_request *ph_req)
 	plugin_request_send(ph_req->plugin, req);
 }
 
+static bool hook_wants(const struct plugin_hook *hook,
+		       const struct hook_instance *h,
+		       void *cb_arg)
+{
+	if (!h->filters)
+		return true;
+
+	for (size_t i = 0; i < tal_count(h->filters); i++) {
+		if (hook->filter_payload(cb_arg, &h->filters[i]))
+			return true;
+	}
+	return false;
+}
+
 bool plugin_hook_call_(struct lightningd *ld, const struct plugin_hook *hook,
 		       const char *cmd_id TAKES,
 		       tal_t *cb_arg STEALS)
 {
-	struct plugin_hook_request *ph_req;
+	struct plugin_hook_request *ph_req = NULL;
 	struct plugin_hook_call_link *link;
-	if (tal_count(hook->hooks)) {
+
+	for (size_t i=0; i<tal_count(hook->hooks); i++) {
+		/* Don't bother them with things they've said they don't
+		 * care about. */
+		if (!hook_wants(hook, hook->hooks[i], cb_arg))
+			continue;
+
 		/* If we have a plugin that has registered for this
 		 * hook, serialize and call it */
-		/* FIXME: technically this is a leak, but we don't
-		 * currently have a list to store these. We might want
-		 * to eventually to inspect in-flight requests. */
-		ph_req = notleak(tal(hook->hooks, struct plugin_hook_request));
-		ph_req->hook = hook;
-		ph_req->cb_arg = tal_steal(ph_req, cb_arg);
-		ph_req->db = ld->wallet->db;
-		ph_req->ld = ld;
-		if (cmd_id)
-			ph_req->cmd_id = tal_strdup(ph_req, cmd_id);
-		else
-			ph_req->cmd_id = NULL;
-
-		list_head_init(&ph_req->call_chain);
-		for (size_t i=0; i<tal_count(hook->hooks); i++) {
-			/* We allocate this off of the plugin so we get notified if the plugin dies. */
-			link = tal(hook->hooks[i]->plugin,
-				   struct plugin_hook_call_link);
-			link->plugin = hook->hooks[i]->plugin;
-			link->req = ph_req;
-			tal_add_destructor(link, plugin_hook_killed);
-			list_add_tail(&ph_req->call_chain, &link->list);
+		if (!ph_req) {
+			/* FIXME: technically this is a leak, but we don't
+			 * currently have a list to store these. We might want
+			 * to eventually to inspect in-flight requests. */
+			ph_req = notleak(tal(hook->hooks,
+					     struct plugin_hook_request));
+			ph_req->hook = hook;
+			ph_req->cb_arg = tal_steal(ph_req, cb_arg);
+			ph_req->db = ld->wallet->db;
+			ph_req->ld = ld;
+			if (cmd_id)
+				ph_req->cmd_id = tal_strdup(ph_req, cmd_id);
+			else
+				ph_req->cmd_id = NULL;
+			list_head_init(&ph_req->call_chain);
 		}
+
+		/* We allocate this off of the plugin so we get notified if the plugin dies. */
+		link = tal(hook->hooks[i]->plugin,
+			   struct plugin_hook_call_link);
+		link->plugin = hook->hooks[i]->plugin;
+		link->req = ph_req;
+		tal_add_destructor(link, plugin_hook_killed);
+		list_add_tail(&ph_req->call_chain, &link->list);
+	}
+
+	if (ph_req) {
 		plugin_hook_call_next(ph_req);
 		return false;
-	} else {
-		/* If no plugin has registered for this hook, just
-		 * call the callback with a NULL result. Saves us the
-		 * roundtrip to the serializer and deserializer. If we
-		 * were expecting a default response it should have
-		 * been part of the `cb_arg`. */
-		hook->final_cb(cb_arg);
-		return true;
 	}
+
+	/* If no plugin has registered for this hook (or wants this call),
+	 * just call the callback with a NULL result. Saves us the
+	 * roundtrip to the serializer and deserializer. If we
+	 * were expecting a default response it should have
+	 * been part of the `cb_arg`. */
+	if (taken(cmd_id))
+		tal_free(cmd_id);
+	hook->final_cb(cb_arg);
+	return true;
 }
 
 /* We open-code this, because it's just different and special enough to be
@@ -449,6 +479,64 @@ void plugin_hook_add_deps(struct plugin_hook *hook,
 	add_deps(&h->after, buffer, after);
 }
 
+/* Either a single number, or [min, max] */
+static bool json_to_hook_filter(const char *buffer, const jsmntok_t *tok,
+				struct hook_filter *filter)
+{
+	if (tok->type == JSMN_ARRAY) {
+		if (tok->size != 2)
+			return false;
+		return json_to_u64(buffer, tok + 1, &filter->min)
+			&& json_to_u64(buffer, tok + 2, &filter->max)
+			&& filter->min <= filter->max;
+	}
+	if (!json_to_u64(buffer, tok, &filter->min))
+		return false;
+	filter->max = filter->min;
+	return true;
+}
+
+const char *plugin_hook_add_filters(const tal_t *ctx,
+				    struct plugin_hook *hook,
+				    struct plugin *plugin,
+				    const char *buffer,
+				    const jsmntok_t *filters)
+{
+	struct hook_instance *h = NULL;
+	const jsmntok_t *t;
+	size_t i;
+
+	if (!filters)
+		return NULL;
+
+	if (!hook->filter_payload)
+		return tal_fmt(ctx, "hook '%s' does not support filters",
+			       hook->name);
+
+	if (filters->type != JSMN_ARRAY)
+		return tal_fmt(ctx, "hook '%s' filters must be an array",
+			       hook->name);
+
+	/* We just added this, it must exist */
+	for (size_t n = 0; n < tal_count(hook->hooks); n++) {
+		if (hook->hooks[n]->plugin == plugin) {
+			h = hook->hooks[n];
+			break;
+		}
+	}
+	assert(h);
+
+	h->filters = tal_arr(h, struct hook_filter, filters->size);
+	json_for_each_arr(i, t, filters) {
+		if (!json_to_hook_filter(buffer, t, &h->filters[i]))
+			return tal_fmt(ctx, "hook '%s' invalid filter %.*s",
+				       hook->name,
+				       json_tok_full_len(t),
+				       json_tok_full(buffer, t));
+	}
+	return NULL;
+}
+
 struct hook_node {
 	/* Is this copied into the ordered array yet? */
 	bool finished;
@@ -34,7 +34,17 @@
  * function that performs typechecking at compile time, and makes sure
  * that all the provided functions for serialization, deserialization
  * and callback have the correct type.
+ *
+ * Hooks registered with REGISTER_FILTERED_PLUGIN_HOOK also let plugins
+ * give "filters" in their getmanifest: ranges of numbers whose meaning
+ * depends on the hook (e.g. a custommsg type).  `filter_payload` says if
+ * a payload matches a filter, and we don't call a plugin at all if none
+ * of its filters match.
  */
+struct hook_filter {
+	u64 min, max;
+};
+
 struct plugin_hook {
 	const char *name;
 
@@ -47,6 +57,9 @@ struct plugin_hook {
 	void (*serialize_payload)(void *src, struct json_stream *dest,
 				  struct plugin *plugin);
 
+	/* NULL if this hook doesn't support filters. */
+	bool (*filter_payload)(void *src, const struct hook_filter *filter);
+
 	/* Which plugins have registered this hook? This is a `tal_arr`
 	 * initialized at creation. */
 	struct hook_instance **hooks;
@@ -80,16 +93,8 @@ bool plugin_hook_continue(void *arg, const char *buffer, const jsmntok_t *toks);
 		return plugin_hook_call_(ld, &name##_hook_gen, cmd_id, cb_arg); \
 	}
 
-/* Typechecked registration of a plugin hook. We check that the
- * serialize_payload function converts an object of type payload_type
- * to a json_stream (.params object in the JSON-RPC request), that the
- * deserialize_response function converts from the JSON-RPC response
- * json_stream to an object of type response_type and that the
- * response_cb function accepts the deserialized response format and
- * an arbitrary extra argument used to maintain context.
- */
-#define REGISTER_PLUGIN_HOOK(name, deserialize_cb, final_cb,                   \
-			     serialize_payload, cb_arg_type)                   \
+#define PLUGIN_HOOK_GEN(name, deserialize_cb, final_cb,                        \
+			serialize_payload, filter_payload, cb_arg_type)        \
 	struct plugin_hook name##_hook_gen = {                                 \
 	    stringify(name),                                                   \
 	    typesafe_cb_cast(                                                  \
@@ -102,11 +107,37 @@ bool plugin_hook_continue(void *arg, const char *buffer, const jsmntok_t *toks);
 		void (*)(void *, struct json_stream *, struct plugin *),       \
 		void (*)(cb_arg_type, struct json_stream *, struct plugin *),  \
 		serialize_payload),                                            \
+	    filter_payload,                                                    \
 	    NULL, /* .plugins */                                               \
 	};                                                                     \
 	AUTODATA(hooks, &name##_hook_gen);                                     \
 	PLUGIN_HOOK_CALL_DEF(name, cb_arg_type)
 
+/* Typechecked registration of a plugin hook. We check that the
+ * serialize_payload function converts an object of type payload_type
+ * to a json_stream (.params object in the JSON-RPC request), that the
+ * deserialize_response function converts from the JSON-RPC response
+ * json_stream to an object of type response_type and that the
+ * response_cb function accepts the deserialized response format and
+ * an arbitrary extra argument used to maintain context.
+ */
+#define REGISTER_PLUGIN_HOOK(name, deserialize_cb, final_cb,                   \
+			     serialize_payload, cb_arg_type)                   \
+	PLUGIN_HOOK_GEN(name, deserialize_cb, final_cb, serialize_payload,     \
+			NULL, cb_arg_type)
+
+/* As above, but plugins can ask for only those calls which filter_payload
+ * says match. */
+#define REGISTER_FILTERED_PLUGIN_HOOK(name, deserialize_cb, final_cb,          \
+				      serialize_payload, filter_payload,       \
+				      cb_arg_type)                             \
+	PLUGIN_HOOK_GEN(name, deserialize_cb, final_cb, serialize_payload,     \
+			typesafe_cb_cast(                                      \
+			    bool (*)(void *, const struct hook_filter *),      \
+			    bool (*)(cb_arg_type, const struct hook_filter *), \
+			    filter_payload),                                   \
+			cb_arg_type)
+
 struct plugin_hook *plugin_hook_register(struct plugin *plugin,
 					 const char *method);
 
@@ -120,6 +151,13 @@ void plugin_hook_add_deps(struct plugin_hook *hook,
 			  const jsmntok_t *before,
 			  const jsmntok_t *after);
 
+/* Add filters for this hook: returns error message if they're invalid. */
+const char *plugin_hook_add_filters(const tal_t *ctx,
+				    struct plugin_hook *hook,
+				    struct plugin *plugin,
+				    const char *buffer,
+				    const jsmntok_t *filters);
+
 /* Returns array of plugins which cannot be ordered (empty on success) */
 struct plugin **plugin_hooks_make_ordered(const tal_t *ctx);
 
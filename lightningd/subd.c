@@ -17,10 +17,15 @@
 #include <lightningd/log_status.h>
 #include <lightningd/peer_fd.h>
 #include <lightningd/subd.h>
+#include <signal.h>
 #include <sys/socket.h>
 #include <sys/wait.h>
 #include <wire/wire_io.h>
 
+#if HAVE_NR_CLOSE_RANGE
+#include <sys/syscall.h>
+#endif
+
 void maybe_subd_child(struct lightningd *ld, int childpid, int wstatus)
 {
 	struct subd *sd;
@@ -198,16 +203,76 @@ static void close_taken_fds(va_list *ap)
 	}
 }
 
+/* vfork() shares our address space with the child until it execs, so the
+ * child must not allocate or touch our heap: that means closefrom() must be
+ * a simple syscall, not a walk of /proc/self/fd. */
+static bool can_vfork(void)
+{
+#if HAVE_CLOSEFROM
+	return true;
+#elif HAVE_NR_CLOSE_RANGE
+	static int close_range_works = -1;
+
+	if (close_range_works == -1)
+		close_range_works
+			= (syscall(__NR_close_range, INT_MAX, INT_MAX, 0) == 0);
+	return close_range_works;
+#else
+	return false;
+#endif
+}
+
+/* Runs in the child (possibly vforked!): only syscalls from here on. */
+static void NORETURN exec_subd(char **args, int **fds, size_t num_fds,
+			       const sigset_t *oldmask)
+{
+	int err;
+
+	if (!shuffle_fds(fds, num_fds))
+		goto fail;
+
+	/* Make (fairly!) sure all other fds are closed. */
+	closefrom(num_fds);
+
+	/* Our handlers must not run in here: exec resets them anyway. */
+	for (int sig = 1; sig < NSIG; sig++) {
+		struct sigaction sa;
+
+		if (sigaction(sig, NULL, &sa) == 0
+		    && sa.sa_handler != SIG_IGN
+		    && sa.sa_handler != SIG_DFL) {
+			sa.sa_handler = SIG_DFL;
+			sigaction(sig, &sa, NULL);
+		}
+	}
+	sigprocmask(SIG_SETMASK, oldmask, NULL);
+
+	execv(args[0], args);
+
+fail:
+	err = errno;
+	/* Gcc's warn-unused-result fail.  (shuffle_fds updates fds[]) */
+	if (write(*fds[num_fds - 1], &err, sizeof(err))) {
+		;
+	}
+	_exit(127);
+}
+
 /* We use sockets, not pipes, because fds are bidir. */
 static int subd(const char *path, const char *name,
 		const char *debug_subdaemon,
 		int *msgfd,
-		bool io_logging,
+		enum log_level print_level,
 		va_list *ap)
 {
 	int childmsg[2], execfail[2];
 	pid_t childpid;
 	int err, *fd;
+	size_t num_args;
+	char *args[] = { NULL, NULL, NULL, NULL, NULL };
+	int *childfds, **fds;
+	sigset_t allsigs, oldmask;
+	va_list ap_child;
 
 	if (socketpair(AF_LOCAL, SOCK_STREAM, 0, childmsg) != 0)
 		goto fail;
@@ -219,57 +284,69 @@ static int subd(const char *path, const char *name,
 		  | FD_CLOEXEC) < 0)
 		goto close_execfail_fail;
 
-	childpid = fork();
-	if (childpid < 0)
-		goto close_execfail_fail;
-
-	if (childpid == 0) {
-		size_t num_args;
-		char *args[] = { NULL, NULL, NULL, NULL };
-		int **fds = tal_arr(tmpctx, int *, 3);
-		int stdoutfd = STDOUT_FILENO, stderrfd = STDERR_FILENO;
-
-		close(childmsg[0]);
-		close(execfail[0]);
-
-		/* msg = STDIN (0) */
-		fds[0] = &childmsg[1];
-		/* These are untouched */
-		fds[1] = &stdoutfd;
-		fds[2] = &stderrfd;
-
-		while ((fd = va_arg(*ap, int *)) != NULL) {
+	/* Everything the child needs is set up here, so it does nothing
+	 * but shuffle fds and exec: the child gets its own copies of the
+	 * fd numbers, since a vforked child shares our memory. */
+	childfds = tal_arr(tmpctx, int, 3);
+	/* msg = STDIN (0) */
+	childfds[0] = childmsg[1];
+	/* These are untouched */
+	childfds[1] = STDOUT_FILENO;
+	childfds[2] = STDERR_FILENO;
+
+	if (ap) {
+		va_copy(ap_child, *ap);
+		while ((fd = va_arg(ap_child, int *)) != NULL) {
 			assert(*fd != -1);
-			tal_arr_expand(&fds, fd);
+			tal_arr_expand(&childfds, *fd);
 		}
+		va_end(ap_child);
+	}
 
-		/* Finally, the fd to report exec errors on */
-		tal_arr_expand(&fds, &execfail[1]);
-
-		if (!shuffle_fds(fds, tal_count(fds)))
-			goto child_errno_fail;
-
-		/* Make (fairly!) sure all other fds are closed. */
-		closefrom(tal_count(fds));
-
-		num_args = 0;
-		args[num_args++] = tal_strdup(NULL, path);
-		if (io_logging)
-			args[num_args++] = "--log-io";
+	/* Finally, the fd to report exec errors on */
+	tal_arr_expand(&childfds, execfail[1]);
+
+	fds = tal_arr(tmpctx, int *, tal_count(childfds));
+	for (size_t i = 0; i < tal_count(childfds); i++)
+		fds[i] = &childfds[i];
+
+	num_args = 0;
+	args[num_args++] = tal_strdup(tmpctx, path);
+	if (print_level < LOG_DBG)
+		args[num_args++] = "--log-io";
+	else if (print_level > LOG_DBG) {
+		/* We send UNUSUAL and BROKEN to plugins as warnings,
+		 * even if we don't print them. */
+		if (print_level > LOG_UNUSUAL)
+			print_level = LOG_UNUSUAL;
+		args[num_args++] = tal_fmt(tmpctx, "--log-level=%s",
+					   log_level_name(print_level));
+	}
 #if DEVELOPER
-		if (debug_subdaemon && strends(name, debug_subdaemon))
-			args[num_args++] = "--debugger";
+	if (debug_subdaemon && strends(name, debug_subdaemon))
+		args[num_args++] = "--debugger";
 #endif
-		execv(args[0], args);
 
-	child_errno_fail:
-		err = errno;
-		/* Gcc's warn-unused-result fail. */
-		if (write(execfail[1], &err, sizeof(err))) {
-			;
-		}
-		exit(127);
-	}
+	/* Don't let signal handlers run in the child until it has
+	 * reset them. */
+	sigfillset(&allsigs);
+	sigprocmask(SIG_SETMASK, &allsigs, &oldmask);
+
+	/*~ fork() has to copy our page tables, which for a large node
+	 * with thousands of channels is most of the cost of starting a
+	 * subdaemon (and then we take copy-on-write faults until it
+	 * execs).  vfork() simply borrows our address space until exec. */
+	if (can_vfork())
+		childpid = vfork();
+	else
+		childpid = fork();
+
+	if (childpid == 0)
+		exec_subd(args, fds, tal_count(fds), &oldmask);
+
+	sigprocmask(SIG_SETMASK, &oldmask, NULL);
+	if (childpid < 0)
+		goto close_execfail_fail;
 
 	close(childmsg[1]);
 	close(execfail[1]);
@@ -664,24 +741,27 @@ static void destroy_subd(struct subd *sd)
 
 static struct io_plan *msg_send_next(struct io_conn *conn, struct subd *sd)
 {
-	const u8 *msg;
+	const u8 *msg, **msgs;
 	int fd;
 
 	/* Don't send if we haven't read version! */
 	if (!sd->rcvd_version)
 		return msg_queue_wait(conn, sd->outq, msg_send_next, sd);
 
+	/* Batch up whatever is queued before the next fd (if any). */
+	msgs = msg_dequeue_many(sd, sd->outq, WIRE_WRITE_BATCH);
+	if (msgs)
+		return io_write_wires(conn, take(msgs), msg_send_next, sd);
+
 	/* Nothing to do?  Wait for msg_enqueue. */
 	msg = msg_dequeue(sd->outq);
 	if (!msg)
 		return msg_queue_wait(conn, sd->outq, msg_send_next, sd);
 
 	fd = msg_extract_fd(sd->outq, msg);
-	if (fd >= 0) {
-		tal_free(msg);
-		return io_send_fd(conn, fd, true, msg_send_next, sd);
-	}
-	return io_write_wire(conn, take(msg), msg_send_next, sd);
+	assert(fd >= 0);
+	tal_free(msg);
+	return io_send_fd(conn, fd, true, msg_send_next, sd);
 }
 
 static struct io_plan *msg_setup(struct io_conn *conn, struct subd *sd)
@@ -716,6 +796,7 @@ static struct subd *new_subd(const tal_t *ctx,
 	int msg_fd;
 	const char *debug_subd = NULL;
 	const char *shortname;
+	enum log_level print_level;
 
 	assert(name != NULL);
 
@@ -738,11 +819,22 @@ static struct subd *new_subd(const tal_t *ctx,
 
 	const char *path = subdaemon_path(tmpctx, ld, name);
 
+	/* We only turn on subdaemon io logging if we're going to print it:
+	 * too stressful otherwise!  We want everything else for our log
+	 * book, unless they've asked us to filter (global daemons log for
+	 * many peers). */
+	if (log_filter_subdaemons(sd->log))
+		print_level = node_id ? log_print_level(sd->log, node_id)
+			: log_print_level_any(sd->log);
+	else {
+		print_level = log_print_level(sd->log, node_id);
+		if (print_level > LOG_DBG)
+			print_level = LOG_DBG;
+	}
+
 	sd->pid = subd(path, name, debug_subd,
 		       &msg_fd,
-		       /* We only turn on subdaemon io logging if we're going
-			* to print it: too stressful otherwise! */
-		       log_print_level(sd->log, node_id) < LOG_DBG,
+		       print_level,
 		       ap);
 	if (sd->pid == (pid_t)-1) {
 		log_unusual(ld->log, "subd %s failed: %s",
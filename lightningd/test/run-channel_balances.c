@@ -0,0 +1,903 @@
+#include "config.h"
+#include "../htlc_end.c"
+#include "../peer_control.c"
+#include <ccan/json_out/json_out.h>
+#include <common/json_filter.h>
+#include <common/setup.h>
+#include <stdio.h>
+
+/* AUTOGENERATED MOCKS START */
+/* Generated stub for any_channel_by_scid */
+struct channel *any_channel_by_scid(struct lightningd *ld UNNEEDED,
+				    const struct short_channel_id *scid UNNEEDED,
+				    bool privacy_leak_ok UNNEEDED)
+{ fprintf(stderr, "any_channel_by_scid called!\n"); abort(); }
+/* Generated stub for bip32_pubkey */
+void bip32_pubkey(struct lightningd *ld UNNEEDED, struct pubkey *pubkey UNNEEDED, u32 index UNNEEDED)
+{ fprintf(stderr, "bip32_pubkey called!\n"); abort(); }
+/* Generated stub for bitcoind_getutxout_ */
+void bitcoind_getutxout_(struct bitcoind *bitcoind UNNEEDED,
+			 const struct bitcoin_outpoint *outpoint UNNEEDED,
+			 void (*cb)(struct bitcoind * UNNEEDED,
+				    const struct bitcoin_tx_output * UNNEEDED,
+				    void *) UNNEEDED,
+			 void *arg UNNEEDED)
+{ fprintf(stderr, "bitcoind_getutxout_ called!\n"); abort(); }
+/* Generated stub for broadcast_tx_ */
+void broadcast_tx_(struct chain_topology *topo UNNEEDED,
+		   struct channel *channel UNNEEDED,
+		   const struct bitcoin_tx *tx TAKES UNNEEDED,
+		   const char *cmd_id UNNEEDED, bool allowhighfees UNNEEDED, u32 minblock UNNEEDED,
+		   bool (*finished)(struct channel * UNNEEDED,
+				    const struct bitcoin_tx * UNNEEDED,
+				    bool success UNNEEDED,
+				    const char *err UNNEEDED,
+				    void *) UNNEEDED,
+		   bool (*refresh)(struct channel * UNNEEDED, const struct bitcoin_tx ** UNNEEDED, void *) UNNEEDED,
+		   void *cbarg TAKES UNNEEDED)
+{ fprintf(stderr, "broadcast_tx_ called!\n"); abort(); }
+/* Generated stub for channel_cleanup_commands */
+void channel_cleanup_commands(struct channel *channel UNNEEDED, const char *why UNNEEDED)
+{ fprintf(stderr, "channel_cleanup_commands called!\n"); abort(); }
+/* Generated stub for channel_fail_forget */
+void channel_fail_forget(struct channel *channel UNNEEDED, const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "channel_fail_forget called!\n"); abort(); }
+/* Generated stub for channel_fail_permanent */
+void channel_fail_permanent(struct channel *channel UNNEEDED,
+			    enum state_change reason UNNEEDED,
+			    const char *fmt UNNEEDED,
+			    ...)
+{ fprintf(stderr, "channel_fail_permanent called!\n"); abort(); }
+/* Generated stub for channel_fail_transient */
+void channel_fail_transient(struct channel *channel UNNEEDED,
+			    const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "channel_fail_transient called!\n"); abort(); }
+/* Generated stub for channel_has_htlc_in */
+struct htlc_in *channel_has_htlc_in(struct channel *channel UNNEEDED)
+{ fprintf(stderr, "channel_has_htlc_in called!\n"); abort(); }
+/* Generated stub for channel_has_htlc_out */
+struct htlc_out *channel_has_htlc_out(struct channel *channel UNNEEDED)
+{ fprintf(stderr, "channel_has_htlc_out called!\n"); abort(); }
+/* Generated stub for channel_inflight_find */
+struct channel_inflight *channel_inflight_find(struct channel *channel UNNEEDED,
+					       const struct bitcoin_txid *txid UNNEEDED)
+{ fprintf(stderr, "channel_inflight_find called!\n"); abort(); }
+/* Generated stub for channel_internal_error */
+void channel_internal_error(struct channel *channel UNNEEDED, const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "channel_internal_error called!\n"); abort(); }
+/* Generated stub for channel_last_funding_feerate */
+u32 channel_last_funding_feerate(const struct channel *channel UNNEEDED)
+{ fprintf(stderr, "channel_last_funding_feerate called!\n"); abort(); }
+/* Generated stub for channel_set_cid */
+void channel_set_cid(struct channel *channel UNNEEDED, const struct channel_id *cid UNNEEDED)
+{ fprintf(stderr, "channel_set_cid called!\n"); abort(); }
+/* Generated stub for channel_set_last_tx */
+void channel_set_last_tx(struct channel *channel UNNEEDED,
+			 struct bitcoin_tx *tx UNNEEDED,
+			 const struct bitcoin_signature *sig UNNEEDED)
+{ fprintf(stderr, "channel_set_last_tx called!\n"); abort(); }
+/* Generated stub for channel_set_scid */
+void channel_set_scid(struct channel *channel UNNEEDED,
+		      const struct short_channel_id *scid UNNEEDED)
+{ fprintf(stderr, "channel_set_scid called!\n"); abort(); }
+/* Generated stub for channel_tell_depth */
+bool channel_tell_depth(struct lightningd *ld UNNEEDED,
+				 struct channel *channel UNNEEDED,
+				 const struct bitcoin_txid *txid UNNEEDED,
+				 u32 depth UNNEEDED)
+{ fprintf(stderr, "channel_tell_depth called!\n"); abort(); }
+/* Generated stub for channel_unsaved_close_conn */
+void channel_unsaved_close_conn(struct channel *channel UNNEEDED, const char *why UNNEEDED)
+{ fprintf(stderr, "channel_unsaved_close_conn called!\n"); abort(); }
+/* Generated stub for channel_update_reserve */
+void channel_update_reserve(struct channel *channel UNNEEDED,
+			    struct channel_config *their_config UNNEEDED,
+			    struct amount_sat funding_total UNNEEDED)
+{ fprintf(stderr, "channel_update_reserve called!\n"); abort(); }
+/* Generated stub for command_fail */
+struct command_result *command_fail(struct command *cmd UNNEEDED, enum jsonrpc_errcode code UNNEEDED,
+				    const char *fmt UNNEEDED, ...)
+
+{ fprintf(stderr, "command_fail called!\n"); abort(); }
+/* Generated stub for command_filter_ptr */
+struct json_filter **command_filter_ptr(struct command *cmd UNNEEDED)
+{ fprintf(stderr, "command_filter_ptr called!\n"); abort(); }
+/* Generated stub for command_param_failed */
+struct command_result *command_param_failed(void)
+
+{ fprintf(stderr, "command_param_failed called!\n"); abort(); }
+/* Generated stub for command_still_pending */
+struct command_result *command_still_pending(struct command *cmd)
+
+{ fprintf(stderr, "command_still_pending called!\n"); abort(); }
+/* Generated stub for command_success */
+struct command_result *command_success(struct command *cmd UNNEEDED,
+				       struct json_stream *response)
+
+{ fprintf(stderr, "command_success called!\n"); abort(); }
+/* Generated stub for commit_tx_boost */
+bool commit_tx_boost(struct channel *channel UNNEEDED,
+		     const struct bitcoin_tx **tx UNNEEDED,
+		     struct anchor_details *adet UNNEEDED)
+{ fprintf(stderr, "commit_tx_boost called!\n"); abort(); }
+/* Generated stub for connect_any_cmd_id */
+const char *connect_any_cmd_id(const tal_t *ctx UNNEEDED,
+			       struct lightningd *ld UNNEEDED, const struct peer *peer UNNEEDED)
+{ fprintf(stderr, "connect_any_cmd_id called!\n"); abort(); }
+/* Generated stub for connect_failed_disconnect */
+void connect_failed_disconnect(struct lightningd *ld UNNEEDED,
+			       const struct node_id *id UNNEEDED,
+			       const struct wireaddr_internal *addr UNNEEDED)
+{ fprintf(stderr, "connect_failed_disconnect called!\n"); abort(); }
+/* Generated stub for connect_succeeded */
+void connect_succeeded(struct lightningd *ld UNNEEDED, const struct peer *peer UNNEEDED,
+		       bool incoming UNNEEDED,
+		       const struct wireaddr_internal *addr UNNEEDED)
+{ fprintf(stderr, "connect_succeeded called!\n"); abort(); }
+/* Generated stub for create_anchor_details */
+struct anchor_details *create_anchor_details(const tal_t *ctx UNNEEDED,
+					     struct channel *channel UNNEEDED,
+					     const struct bitcoin_tx *tx UNNEEDED)
+{ fprintf(stderr, "create_anchor_details called!\n"); abort(); }
+/* Generated stub for delete_channel */
+void delete_channel(struct channel *channel STEALS UNNEEDED)
+{ fprintf(stderr, "delete_channel called!\n"); abort(); }
+/* Generated stub for encode_scriptpubkey_to_addr */
+char *encode_scriptpubkey_to_addr(const tal_t *ctx UNNEEDED,
+				  const struct chainparams *chainparams UNNEEDED,
+				  const u8 *scriptPubkey UNNEEDED)
+{ fprintf(stderr, "encode_scriptpubkey_to_addr called!\n"); abort(); }
+/* Generated stub for fatal */
+void   fatal(const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "fatal called!\n"); abort(); }
+/* Generated stub for find_channel_by_id */
+struct channel *find_channel_by_id(const struct peer *peer UNNEEDED,
+				   const struct channel_id *cid UNNEEDED)
+{ fprintf(stderr, "find_channel_by_id called!\n"); abort(); }
+/* Generated stub for fromwire_channeld_dev_memleak_reply */
+bool fromwire_channeld_dev_memleak_reply(const void *p UNNEEDED, bool *leak UNNEEDED)
+{ fprintf(stderr, "fromwire_channeld_dev_memleak_reply called!\n"); abort(); }
+/* Generated stub for fromwire_connectd_peer_connected */
+bool fromwire_connectd_peer_connected(const tal_t *ctx UNNEEDED, const void *p UNNEEDED, struct node_id *id UNNEEDED, u64 *counter UNNEEDED, struct wireaddr_internal *addr UNNEEDED, struct wireaddr **remote_addr UNNEEDED, bool *incoming UNNEEDED, u8 **features UNNEEDED)
+{ fprintf(stderr, "fromwire_connectd_peer_connected called!\n"); abort(); }
+/* Generated stub for fromwire_connectd_peer_disconnect_done */
+bool fromwire_connectd_peer_disconnect_done(const void *p UNNEEDED, struct node_id *id UNNEEDED, u64 *counter UNNEEDED)
+{ fprintf(stderr, "fromwire_connectd_peer_disconnect_done called!\n"); abort(); }
+/* Generated stub for fromwire_connectd_peer_spoke */
+bool fromwire_connectd_peer_spoke(const void *p UNNEEDED, struct node_id *id UNNEEDED, u64 *counter UNNEEDED, u16 *msgtype UNNEEDED, struct channel_id *channel_id UNNEEDED)
+{ fprintf(stderr, "fromwire_connectd_peer_spoke called!\n"); abort(); }
+/* Generated stub for fromwire_dualopend_dev_memleak_reply */
+bool fromwire_dualopend_dev_memleak_reply(const void *p UNNEEDED, bool *leak UNNEEDED)
+{ fprintf(stderr, "fromwire_dualopend_dev_memleak_reply called!\n"); abort(); }
+/* Generated stub for fromwire_hsmd_sign_commitment_tx_reply */
+bool fromwire_hsmd_sign_commitment_tx_reply(const void *p UNNEEDED, struct bitcoin_signature *sig UNNEEDED)
+{ fprintf(stderr, "fromwire_hsmd_sign_commitment_tx_reply called!\n"); abort(); }
+/* Generated stub for fromwire_onchaind_dev_memleak_reply */
+bool fromwire_onchaind_dev_memleak_reply(const void *p UNNEEDED, bool *leak UNNEEDED)
+{ fprintf(stderr, "fromwire_onchaind_dev_memleak_reply called!\n"); abort(); }
+/* Generated stub for fromwire_openingd_dev_memleak_reply */
+bool fromwire_openingd_dev_memleak_reply(const void *p UNNEEDED, bool *leak UNNEEDED)
+{ fprintf(stderr, "fromwire_openingd_dev_memleak_reply called!\n"); abort(); }
+/* Generated stub for get_block_height */
+u32 get_block_height(const struct chain_topology *topo UNNEEDED)
+{ fprintf(stderr, "get_block_height called!\n"); abort(); }
+/* Generated stub for hsm_sync_req */
+const u8 *hsm_sync_req(const tal_t *ctx UNNEEDED,
+		       struct lightningd *ld UNNEEDED,
+		       const u8 *msg TAKES UNNEEDED)
+{ fprintf(stderr, "hsm_sync_req called!\n"); abort(); }
+/* Generated stub for htlc_max_possible_send */
+struct amount_msat htlc_max_possible_send(const struct channel *channel UNNEEDED)
+{ fprintf(stderr, "htlc_max_possible_send called!\n"); abort(); }
+/* Generated stub for json_add_log */
+void json_add_log(struct json_stream *result UNNEEDED,
+		  const struct log_book *lr UNNEEDED,
+		  const struct node_id *node_id UNNEEDED,
+		  enum log_level minlevel UNNEEDED)
+{ fprintf(stderr, "json_add_log called!\n"); abort(); }
+/* Generated stub for json_add_unsaved_channel */
+void json_add_unsaved_channel(struct json_stream *response UNNEEDED,
+			      const struct channel *channel UNNEEDED,
+			      /* Only set for listpeerchannels */
+			      const struct peer *peer UNNEEDED)
+{ fprintf(stderr, "json_add_unsaved_channel called!\n"); abort(); }
+/* Generated stub for json_stream_success */
+struct json_stream *json_stream_success(struct command *cmd UNNEEDED)
+{ fprintf(stderr, "json_stream_success called!\n"); abort(); }
+/* Generated stub for json_to_node_id */
+bool json_to_node_id(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+			       struct node_id *id UNNEEDED)
+{ fprintf(stderr, "json_to_node_id called!\n"); abort(); }
+/* Generated stub for json_to_short_channel_id */
+bool json_to_short_channel_id(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+			      struct short_channel_id *scid UNNEEDED)
+{ fprintf(stderr, "json_to_short_channel_id called!\n"); abort(); }
+/* Generated stub for json_tok_channel_id */
+bool json_tok_channel_id(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+			 struct channel_id *cid UNNEEDED)
+{ fprintf(stderr, "json_tok_channel_id called!\n"); abort(); }
+/* Generated stub for kill_uncommitted_channel */
+void kill_uncommitted_channel(struct uncommitted_channel *uc UNNEEDED,
+			      const char *why UNNEEDED)
+{ fprintf(stderr, "kill_uncommitted_channel called!\n"); abort(); }
+/* Generated stub for log_ */
+void log_(struct log *log UNNEEDED, enum log_level level UNNEEDED,
+	  const struct node_id *node_id UNNEEDED,
+	  bool call_notifier UNNEEDED,
+	  const char *fmt UNNEEDED, ...)
+
+{ fprintf(stderr, "log_ called!\n"); abort(); }
+/* Generated stub for new_height_states */
+struct height_states *new_height_states(const tal_t *ctx UNNEEDED,
+					enum side opener UNNEEDED,
+					const u32 *blockheight UNNEEDED)
+{ fprintf(stderr, "new_height_states called!\n"); abort(); }
+/* Generated stub for new_peer_fd */
+struct peer_fd *new_peer_fd(const tal_t *ctx UNNEEDED, int peer_fd UNNEEDED)
+{ fprintf(stderr, "new_peer_fd called!\n"); abort(); }
+/* Generated stub for new_reltimer_ */
+struct oneshot *new_reltimer_(struct timers *timers UNNEEDED,
+			      const tal_t *ctx UNNEEDED,
+			      struct timerel expire UNNEEDED,
+			      void (*cb)(void *) UNNEEDED, void *arg UNNEEDED)
+{ fprintf(stderr, "new_reltimer_ called!\n"); abort(); }
+/* Generated stub for new_uncommitted_channel */
+struct uncommitted_channel *new_uncommitted_channel(struct peer *peer UNNEEDED)
+{ fprintf(stderr, "new_uncommitted_channel called!\n"); abort(); }
+/* Generated stub for new_unsaved_channel */
+struct channel *new_unsaved_channel(struct peer *peer UNNEEDED,
+				    u32 feerate_base UNNEEDED,
+				    u32 feerate_ppm UNNEEDED)
+{ fprintf(stderr, "new_unsaved_channel called!\n"); abort(); }
+/* Generated stub for notify_connect */
+void notify_connect(struct lightningd *ld UNNEEDED,
+		    const struct node_id *nodeid UNNEEDED,
+		    bool incoming UNNEEDED,
+		    const struct wireaddr_internal *addr UNNEEDED)
+{ fprintf(stderr, "notify_connect called!\n"); abort(); }
+/* Generated stub for notify_disconnect */
+void notify_disconnect(struct lightningd *ld UNNEEDED, struct node_id *nodeid UNNEEDED)
+{ fprintf(stderr, "notify_disconnect called!\n"); abort(); }
+/* Generated stub for onchaind_funding_spent */
+enum watch_result onchaind_funding_spent(struct channel *channel UNNEEDED,
+					 const struct bitcoin_tx *tx UNNEEDED,
+					 u32 blockheight UNNEEDED)
+{ fprintf(stderr, "onchaind_funding_spent called!\n"); abort(); }
+/* Generated stub for param */
+bool param(struct command *cmd UNNEEDED, const char *buffer UNNEEDED,
+	   const jsmntok_t params[] UNNEEDED, ...)
+{ fprintf(stderr, "param called!\n"); abort(); }
+/* Generated stub for param_bool */
+struct command_result *param_bool(struct command *cmd UNNEEDED, const char *name UNNEEDED,
+				  const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+				  bool **b UNNEEDED)
+{ fprintf(stderr, "param_bool called!\n"); abort(); }
+/* Generated stub for param_channel_id */
+struct command_result *param_channel_id(struct command *cmd UNNEEDED,
+					const char *name UNNEEDED,
+					const char *buffer UNNEEDED,
+					const jsmntok_t *tok UNNEEDED,
+					struct channel_id **cid UNNEEDED)
+{ fprintf(stderr, "param_channel_id called!\n"); abort(); }
+/* Generated stub for param_loglevel */
+struct command_result *param_loglevel(struct command *cmd UNNEEDED,
+				      const char *name UNNEEDED,
+				      const char *buffer UNNEEDED,
+				      const jsmntok_t *tok UNNEEDED,
+				      enum log_level **level UNNEEDED)
+{ fprintf(stderr, "param_loglevel called!\n"); abort(); }
+/* Generated stub for param_msat */
+struct command_result *param_msat(struct command *cmd UNNEEDED, const char *name UNNEEDED,
+				  const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+				  struct amount_msat **msat UNNEEDED)
+{ fprintf(stderr, "param_msat called!\n"); abort(); }
+/* Generated stub for param_node_id */
+struct command_result *param_node_id(struct command *cmd UNNEEDED,
+				     const char *name UNNEEDED,
+				     const char *buffer UNNEEDED,
+				     const jsmntok_t *tok UNNEEDED,
+				     struct node_id **id UNNEEDED)
+{ fprintf(stderr, "param_node_id called!\n"); abort(); }
+/* Generated stub for param_number */
+struct command_result *param_number(struct command *cmd UNNEEDED, const char *name UNNEEDED,
+				    const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+				    unsigned int **num UNNEEDED)
+{ fprintf(stderr, "param_number called!\n"); abort(); }
+/* Generated stub for param_short_channel_id */
+struct command_result *param_short_channel_id(struct command *cmd UNNEEDED,
+					      const char *name UNNEEDED,
+					      const char *buffer UNNEEDED,
+					      const jsmntok_t *tok UNNEEDED,
+					      struct short_channel_id **scid UNNEEDED)
+{ fprintf(stderr, "param_short_channel_id called!\n"); abort(); }
+/* Generated stub for param_u64 */
+struct command_result *param_u64(struct command *cmd UNNEEDED, const char *name UNNEEDED,
+				 const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+				 uint64_t **num UNNEEDED)
+{ fprintf(stderr, "param_u64 called!\n"); abort(); }
+/* Generated stub for peer_any_active_channel */
+struct channel *peer_any_active_channel(struct peer *peer UNNEEDED, bool *others UNNEEDED)
+{ fprintf(stderr, "peer_any_active_channel called!\n"); abort(); }
+/* Generated stub for peer_restart_dualopend */
+bool peer_restart_dualopend(struct peer *peer UNNEEDED,
+			    struct peer_fd *peer_fd UNNEEDED,
+			    struct channel *channel UNNEEDED)
+{ fprintf(stderr, "peer_restart_dualopend called!\n"); abort(); }
+/* Generated stub for peer_start_channeld */
+bool peer_start_channeld(struct channel *channel UNNEEDED,
+			 struct peer_fd *peer_fd UNNEEDED,
+			 const u8 *fwd_msg UNNEEDED,
+			 bool reconnected UNNEEDED,
+			 bool reestablish_only UNNEEDED)
+{ fprintf(stderr, "peer_start_channeld called!\n"); abort(); }
+/* Generated stub for peer_start_dualopend */
+bool peer_start_dualopend(struct peer *peer UNNEEDED, struct peer_fd *peer_fd UNNEEDED,
+			  struct channel *channel UNNEEDED)
+{ fprintf(stderr, "peer_start_dualopend called!\n"); abort(); }
+/* Generated stub for peer_start_openingd */
+bool peer_start_openingd(struct peer *peer UNNEEDED,
+			 struct peer_fd *peer_fd UNNEEDED)
+{ fprintf(stderr, "peer_start_openingd called!\n"); abort(); }
+/* Generated stub for plugin_hook_call_ */
+bool plugin_hook_call_(struct lightningd *ld UNNEEDED,
+		       const struct plugin_hook *hook UNNEEDED,
+		       const char *cmd_id TAKES UNNEEDED,
+		       tal_t *cb_arg STEALS UNNEEDED)
+{ fprintf(stderr, "plugin_hook_call_ called!\n"); abort(); }
+/* Generated stub for report_subd_memleak */
+void report_subd_memleak(struct leak_detect *leak_detect UNNEEDED, struct subd *leaker UNNEEDED)
+{ fprintf(stderr, "report_subd_memleak called!\n"); abort(); }
+/* Generated stub for resolve_close_command */
+const char *resolve_close_command(const tal_t *ctx UNNEEDED,
+				  struct lightningd *ld UNNEEDED, struct channel *channel UNNEEDED,
+				  bool cooperative UNNEEDED)
+{ fprintf(stderr, "resolve_close_command called!\n"); abort(); }
+/* Generated stub for start_leak_request */
+void start_leak_request(const struct subd_req *req UNNEEDED,
+			struct leak_detect *leak_detect UNNEEDED)
+{ fprintf(stderr, "start_leak_request called!\n"); abort(); }
+/* Generated stub for subd_req_ */
+struct subd_req *subd_req_(const tal_t *ctx UNNEEDED,
+	       struct subd *sd UNNEEDED,
+	       const u8 *msg_out UNNEEDED,
+	       int fd_out UNNEEDED, size_t num_fds_in UNNEEDED,
+	       void (*replycb)(struct subd * UNNEEDED, const u8 * UNNEEDED, const int * UNNEEDED, void *) UNNEEDED,
+	       void *replycb_data UNNEEDED)
+{ fprintf(stderr, "subd_req_ called!\n"); abort(); }
+/* Generated stub for subd_send_fd */
+void subd_send_fd(struct subd *sd UNNEEDED, int fd UNNEEDED)
+{ fprintf(stderr, "subd_send_fd called!\n"); abort(); }
+/* Generated stub for subd_send_msg */
+void subd_send_msg(struct subd *sd UNNEEDED, const u8 *msg_out UNNEEDED)
+{ fprintf(stderr, "subd_send_msg called!\n"); abort(); }
+/* Generated stub for towire_channeld_config_channel */
+u8 *towire_channeld_config_channel(const tal_t *ctx UNNEEDED, u32 *feerate_base UNNEEDED, u32 *feerate_ppm UNNEEDED, struct amount_msat *htlc_minimum UNNEEDED, struct amount_msat *htlc_maximum UNNEEDED)
+{ fprintf(stderr, "towire_channeld_config_channel called!\n"); abort(); }
+/* Generated stub for towire_channeld_dev_memleak */
+u8 *towire_channeld_dev_memleak(const tal_t *ctx UNNEEDED)
+{ fprintf(stderr, "towire_channeld_dev_memleak called!\n"); abort(); }
+/* Generated stub for towire_channeld_dev_reenable_commit */
+u8 *towire_channeld_dev_reenable_commit(const tal_t *ctx UNNEEDED)
+{ fprintf(stderr, "towire_channeld_dev_reenable_commit called!\n"); abort(); }
+/* Generated stub for towire_connectd_discard_peer */
+u8 *towire_connectd_discard_peer(const tal_t *ctx UNNEEDED, const struct node_id *id UNNEEDED, u64 counter UNNEEDED)
+{ fprintf(stderr, "towire_connectd_discard_peer called!\n"); abort(); }
+/* Generated stub for towire_connectd_peer_connect_subd */
+u8 *towire_connectd_peer_connect_subd(const tal_t *ctx UNNEEDED, const struct node_id *id UNNEEDED, u64 counter UNNEEDED, const struct channel_id *channel_id UNNEEDED)
+{ fprintf(stderr, "towire_connectd_peer_connect_subd called!\n"); abort(); }
+/* Generated stub for towire_connectd_peer_final_msg */
+u8 *towire_connectd_peer_final_msg(const tal_t *ctx UNNEEDED, const struct node_id *id UNNEEDED, u64 counter UNNEEDED, const u8 *msg UNNEEDED)
+{ fprintf(stderr, "towire_connectd_peer_final_msg called!\n"); abort(); }
+/* Generated stub for towire_dualopend_dev_memleak */
+u8 *towire_dualopend_dev_memleak(const tal_t *ctx UNNEEDED)
+{ fprintf(stderr, "towire_dualopend_dev_memleak called!\n"); abort(); }
+/* Generated stub for towire_errorfmt */
+u8 *towire_errorfmt(const tal_t *ctx UNNEEDED,
+		    const struct channel_id *channel UNNEEDED,
+		    const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "towire_errorfmt called!\n"); abort(); }
+/* Generated stub for towire_gossipd_discovered_ip */
+u8 *towire_gossipd_discovered_ip(const tal_t *ctx UNNEEDED, const struct wireaddr *discovered_ip UNNEEDED)
+{ fprintf(stderr, "towire_gossipd_discovered_ip called!\n"); abort(); }
+/* Generated stub for towire_hsmd_sign_commitment_tx */
+u8 *towire_hsmd_sign_commitment_tx(const tal_t *ctx UNNEEDED, const struct node_id *peer_id UNNEEDED, u64 channel_dbid UNNEEDED, const struct bitcoin_tx *tx UNNEEDED, const struct pubkey *remote_funding_key UNNEEDED, u64 commit_num UNNEEDED)
+{ fprintf(stderr, "towire_hsmd_sign_commitment_tx called!\n"); abort(); }
+/* Generated stub for towire_onchaind_dev_memleak */
+u8 *towire_onchaind_dev_memleak(const tal_t *ctx UNNEEDED)
+{ fprintf(stderr, "towire_onchaind_dev_memleak called!\n"); abort(); }
+/* Generated stub for towire_openingd_dev_memleak */
+u8 *towire_openingd_dev_memleak(const tal_t *ctx UNNEEDED)
+{ fprintf(stderr, "towire_openingd_dev_memleak called!\n"); abort(); }
+/* Generated stub for towire_scb_chan */
+void towire_scb_chan(u8 **p UNNEEDED, const struct scb_chan *scb_chan UNNEEDED)
+{ fprintf(stderr, "towire_scb_chan called!\n"); abort(); }
+/* Generated stub for towire_warningfmt */
+u8 *towire_warningfmt(const tal_t *ctx UNNEEDED,
+		      const struct channel_id *channel UNNEEDED,
+		      const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "towire_warningfmt called!\n"); abort(); }
+/* Generated stub for try_reconnect */
+void try_reconnect(const tal_t *ctx UNNEEDED,
+		   struct peer *peer UNNEEDED,
+		   const struct wireaddr_internal *addrhint UNNEEDED)
+{ fprintf(stderr, "try_reconnect called!\n"); abort(); }
+/* Generated stub for version */
+const char *version(void)
+{ fprintf(stderr, "version called!\n"); abort(); }
+/* Generated stub for wallet_annotate_txout */
+void wallet_annotate_txout(struct wallet *w UNNEEDED,
+			   const struct bitcoin_outpoint *outpoint UNNEEDED,
+			   enum wallet_tx_type type UNNEEDED, u64 channel UNNEEDED)
+{ fprintf(stderr, "wallet_annotate_txout called!\n"); abort(); }
+/* Generated stub for wallet_channel_save */
+void wallet_channel_save(struct wallet *w UNNEEDED, struct channel *chan UNNEEDED)
+{ fprintf(stderr, "wallet_channel_save called!\n"); abort(); }
+/* Generated stub for wallet_channeltxs_add */
+void wallet_channeltxs_add(struct wallet *w UNNEEDED, struct channel *chan UNNEEDED,
+			    const int type UNNEEDED, const struct bitcoin_txid *txid UNNEEDED,
+			   const u32 input_num UNNEEDED, const u32 blockheight UNNEEDED)
+{ fprintf(stderr, "wallet_channeltxs_add called!\n"); abort(); }
+/* Generated stub for wallet_delete_peer_if_unused */
+void wallet_delete_peer_if_unused(struct wallet *w UNNEEDED, u64 peer_dbid UNNEEDED)
+{ fprintf(stderr, "wallet_delete_peer_if_unused called!\n"); abort(); }
+/* Generated stub for wallet_htlcs_load_in_for_channel */
+bool wallet_htlcs_load_in_for_channel(struct wallet *wallet UNNEEDED,
+				      struct channel *chan UNNEEDED,
+				      struct htlc_in_map *htlcs_in UNNEEDED)
+{ fprintf(stderr, "wallet_htlcs_load_in_for_channel called!\n"); abort(); }
+/* Generated stub for wallet_htlcs_load_out_for_channel */
+bool wallet_htlcs_load_out_for_channel(struct wallet *wallet UNNEEDED,
+				       struct channel *chan UNNEEDED,
+				       struct htlc_out_map *htlcs_out UNNEEDED,
+				       struct htlc_in_map *remaining_htlcs_in UNNEEDED)
+{ fprintf(stderr, "wallet_htlcs_load_out_for_channel called!\n"); abort(); }
+/* Generated stub for wallet_init_channels */
+bool wallet_init_channels(struct wallet *w UNNEEDED)
+{ fprintf(stderr, "wallet_init_channels called!\n"); abort(); }
+/* Generated stub for wallet_total_forward_fees */
+struct amount_msat wallet_total_forward_fees(struct wallet *w UNNEEDED)
+{ fprintf(stderr, "wallet_total_forward_fees called!\n"); abort(); }
+/* Generated stub for wallet_transaction_add */
+void wallet_transaction_add(struct wallet *w UNNEEDED, const struct wally_tx *tx UNNEEDED,
+			    const u32 blockheight UNNEEDED, const u32 txindex UNNEEDED)
+{ fprintf(stderr, "wallet_transaction_add called!\n"); abort(); }
+/* Generated stub for wallet_transaction_locate */
+struct txlocator *wallet_transaction_locate(const tal_t *ctx UNNEEDED, struct wallet *w UNNEEDED,
+					    const struct bitcoin_txid *txid UNNEEDED)
+{ fprintf(stderr, "wallet_transaction_locate called!\n"); abort(); }
+/* Generated stub for watch_txid */
+struct txwatch *watch_txid(const tal_t *ctx UNNEEDED,
+			   struct chain_topology *topo UNNEEDED,
+			   struct channel *channel UNNEEDED,
+			   const struct bitcoin_txid *txid UNNEEDED,
+			   enum watch_result (*cb)(struct lightningd *ld UNNEEDED,
+						   struct channel * UNNEEDED,
+						   const struct bitcoin_txid * UNNEEDED,
+						   const struct bitcoin_tx * UNNEEDED,
+						   unsigned int depth))
+{ fprintf(stderr, "watch_txid called!\n"); abort(); }
+/* Generated stub for watch_txo */
+struct txowatch *watch_txo(const tal_t *ctx UNNEEDED,
+			   struct chain_topology *topo UNNEEDED,
+			   struct channel *channel UNNEEDED,
+			   const struct bitcoin_outpoint *outpoint UNNEEDED,
+			   enum watch_result (*cb)(struct channel * UNNEEDED,
+						   const struct bitcoin_tx *tx UNNEEDED,
+						   size_t input_num UNNEEDED,
+						   const struct block *block))
+{ fprintf(stderr, "watch_txo called!\n"); abort(); }
+/* AUTOGENERATED MOCKS END */
+
+#if DEVELOPER
+/* Generated stub for dev_disconnect_permanent */
+bool dev_disconnect_permanent(struct lightningd *ld UNNEEDED)
+{ fprintf(stderr, "dev_disconnect_permanent called!\n"); abort(); }
+#endif
+
+/* Every channel has this many state changes in the db, as a real one
+ * which went through opening would. */
+#define NUM_STATE_CHANGES 3
+
+/* How many channels change between incremental listchannelbalances */
+#define NUM_CHANGED 3
+
+void channel_balance_changed(struct channel *channel)
+{
+	channel->balance_gen = ++channel->peer->ld->channel_balance_gen;
+}
+
+const char *channel_change_state_reason_str(enum state_change reason UNNEEDED)
+{
+	return "user";
+}
+
+const char *channel_state_str(enum channel_state state)
+{
+	return state == CHANNELD_NORMAL ? "CHANNELD_NORMAL"
+		: "CHANNELD_AWAITING_LOCKIN";
+}
+
+const char *channel_state_name(const struct channel *channel)
+{
+	return channel_state_str(channel->state);
+}
+
+void json_add_uncommitted_channel(struct json_stream *response UNNEEDED,
+				  const struct uncommitted_channel *uc,
+				  const struct peer *peer UNNEEDED)
+{
+	/* We never have any */
+	assert(!uc);
+}
+
+void wallet_channel_stats_load(struct wallet *w UNNEEDED,
+			       u64 cdbid UNNEEDED,
+			       struct channel_stats *stats)
+{
+	memset(stats, 0, sizeof(*stats));
+}
+
+struct state_change_entry *wallet_state_change_get(struct wallet *w UNNEEDED,
+						   const tal_t *ctx,
+						   u64 channel_id UNNEEDED)
+{
+	struct state_change_entry *changes;
+
+	changes = tal_arr(ctx, struct state_change_entry, NUM_STATE_CHANGES);
+	for (size_t i = 0; i < NUM_STATE_CHANGES; i++) {
+		changes[i].timestamp.ts.tv_sec = 1600000000 + i;
+		changes[i].timestamp.ts.tv_nsec = 0;
+		changes[i].old_state = CHANNELD_AWAITING_LOCKIN;
+		changes[i].new_state = CHANNELD_NORMAL;
+		changes[i].cause = REASON_USER;
+		changes[i].message = "Lockin complete";
+	}
+	return changes;
+}
+
+static void set_config(struct channel_config *config)
+{
+	config->dust_limit = AMOUNT_SAT(546);
+	config->max_htlc_value_in_flight = AMOUNT_MSAT(-1ULL);
+	config->channel_reserve = AMOUNT_SAT(10000);
+	config->htlc_minimum = AMOUNT_MSAT(1);
+	config->to_self_delay = 144;
+	config->max_accepted_htlcs = 483;
+}
+
+static struct channel *add_channel(struct lightningd *ld, size_t i)
+{
+	struct peer *peer = talz(ld, struct peer);
+	struct channel *c = talz(peer, struct channel);
+	u32 feerate = 7500;
+
+	peer->ld = ld;
+	peer->id.k[0] = 0x03;
+	memcpy(peer->id.k + 1, &i, sizeof(i));
+	peer->connected = PEER_CONNECTED;
+	peer->their_features = tal_arr(peer, u8, 0);
+	list_head_init(&peer->channels);
+	peer_node_id_map_add(ld->peers, peer);
+
+	c->peer = peer;
+	c->dbid = i + 1;
+	c->state = CHANNELD_NORMAL;
+	c->opener = (i % 2) ? LOCAL : REMOTE;
+	c->closer = NUM_SIDES;
+	c->type = channel_type_static_remotekey(c);
+	c->fee_states = new_fee_states(c, c->opener, &feerate);
+	c->funding_sats = AMOUNT_SAT(10000000);
+	if (c->opener == LOCAL)
+		c->our_funds = c->funding_sats;
+	c->our_msat = AMOUNT_MSAT(5000000000);
+	c->msat_to_us_min = c->msat_to_us_max = c->our_msat;
+	set_config(&c->our_config);
+	set_config(&c->channel_info.their_config);
+	c->scid = tal(c, struct short_channel_id);
+	if (!mk_short_channel_id(c->scid, 100000 + i, 1, 0))
+		abort();
+	c->alias[LOCAL] = tal(c, struct short_channel_id);
+	if (!mk_short_channel_id(c->alias[LOCAL], 10000000 + i, 1, 0))
+		abort();
+	memcpy(c->cid.id, &i, sizeof(i));
+	list_head_init(&c->inflights);
+	list_head_init(&c->htlcs_in);
+	list_head_init(&c->htlcs_out);
+	list_add_tail(&peer->channels, &c->list);
+	channel_balance_changed(c);
+
+	return c;
+}
+
+static void add_htlc(struct lightningd *ld, struct channel *c, size_t i)
+{
+	if (i % 2) {
+		struct htlc_in *hin = talz(c, struct htlc_in);
+		hin->key.channel = c;
+		hin->key.id = i;
+		hin->msat = amount_msat(100000 + i);
+		hin->cltv_expiry = 1000;
+		hin->hstate = RCVD_ADD_ACK_REVOCATION;
+		connect_htlc_in(ld->htlcs_in, hin);
+	} else {
+		struct htlc_out *hout = talz(c, struct htlc_out);
+		hout->key.channel = c;
+		hout->key.id = i;
+		hout->msat = amount_msat(100000 + i);
+		hout->cltv_expiry = 1000;
+		hout->hstate = SENT_ADD_ACK_REVOCATION;
+		connect_htlc_out(ld->htlcs_out, hout);
+	}
+	channel_balance_changed(c);
+}
+
+/* What listpeerchannels does, optionally with a filter of channel fields */
+static struct json_stream *list_peerchannels(struct lightningd *ld,
+					     const char **fields)
+{
+	struct json_stream *js = new_json_stream(tmpctx, NULL, NULL);
+	struct peer *peer;
+	struct peer_node_id_map_iter it;
+
+	json_object_start(js, NULL);
+	if (fields) {
+		struct json_filter *filter = json_filter_new(js), *f;
+
+		f = json_filter_subobj(filter, "channels", strlen("channels"));
+		f = json_filter_subarr(f);
+		for (size_t i = 0; fields[i]; i++)
+			json_filter_subobj(f, fields[i], strlen(fields[i]));
+		json_stream_attach_filter(js, filter);
+	}
+	json_array_start(js, "channels");
+	for (peer = peer_node_id_map_first(ld->peers, &it);
+	     peer;
+	     peer = peer_node_id_map_next(ld->peers, &it)) {
+		json_add_peerchannels(ld, js, peer);
+	}
+	json_array_end(js);
+	if (fields)
+		assert(!json_stream_detach_filter(tmpctx, js));
+	json_object_end(js);
+	return js;
+}
+
+/* What listchannelbalances does */
+static struct json_stream *list_channelbalances(struct lightningd *ld,
+						u64 since)
+{
+	struct json_stream *js = new_json_stream(tmpctx, NULL, NULL);
+
+	json_object_start(js, NULL);
+	json_add_channel_balances(ld, js, since);
+	json_object_end(js);
+	return js;
+}
+
+static const jsmntok_t *get_channels(struct json_stream *js,
+				     const char **buf)
+{
+	size_t len;
+	jsmntok_t *toks;
+
+	*buf = json_out_contents(js->jout, &len);
+	toks = json_parse_simple(js, *buf, len);
+	assert(toks);
+	return json_get_member(*buf, toks, "channels");
+}
+
+static void assert_same(const char *buf1, const jsmntok_t *obj1,
+			const char *buf2, const jsmntok_t *obj2,
+			const char *field)
+{
+	const jsmntok_t *t1 = json_get_member(buf1, obj1, field);
+	const jsmntok_t *t2 = json_get_member(buf2, obj2, field);
+
+	assert(t1 && t2);
+	assert(json_tok_full_len(t1) == json_tok_full_len(t2));
+	assert(memcmp(json_tok_full(buf1, t1), json_tok_full(buf2, t2),
+		      json_tok_full_len(t1)) == 0);
+}
+
+/* listchannelbalances must say exactly what listpeerchannels does. */
+static void check_balances(struct json_stream *peerchannels,
+			   struct json_stream *channelbalances)
+{
+	const char *pbuf, *bbuf;
+	const jsmntok_t *parr, *barr, *p, *b;
+	size_t i;
+
+	parr = get_channels(peerchannels, &pbuf);
+	barr = get_channels(channelbalances, &bbuf);
+	assert(parr->size == barr->size);
+
+	/* Both walk the peers in the same order. */
+	b = barr + 1;
+	json_for_each_arr(i, p, parr) {
+		u32 num_htlcs;
+
+		assert_same(pbuf, p, bbuf, b, "peer_id");
+		assert_same(pbuf, p, bbuf, b, "short_channel_id");
+		assert_same(pbuf, p, bbuf, b, "direction");
+		assert_same(pbuf, p, bbuf, b, "spendable_msat");
+		assert_same(pbuf, p, bbuf, b, "receivable_msat");
+		assert_same(pbuf, p, bbuf, b, "max_accepted_htlcs");
+		assert(json_to_u32(bbuf, json_get_member(bbuf, b, "num_htlcs"),
+				   &num_htlcs));
+		assert(num_htlcs == json_get_member(pbuf, p, "htlcs")->size);
+		b = json_next(b);
+	}
+}
+
+/* Filtered output is exactly those fields of the unfiltered output. */
+static void check_filtered(struct json_stream *full,
+			   struct json_stream *filtered,
+			   const char **fields)
+{
+	const char *fbuf, *buf;
+	const jsmntok_t *farr, *arr, *f, *t;
+	size_t i, num_fields = 0;
+
+	while (fields[num_fields])
+		num_fields++;
+
+	farr = get_channels(full, &fbuf);
+	arr = get_channels(filtered, &buf);
+	assert(farr->size == arr->size);
+
+	f = farr + 1;
+	json_for_each_arr(i, t, arr) {
+		assert(t->size == num_fields);
+		for (size_t n = 0; n < num_fields; n++)
+			assert_same(fbuf, f, buf, t, fields[n]);
+		f = json_next(f);
+	}
+}
+
+/* Each channel's HTLC lists and totals agree with the global maps. */
+static void check_htlc_totals(struct lightningd *ld,
+			      struct channel **channels)
+{
+	const struct htlc_in *hin;
+	struct htlc_in_map_iter ini;
+	const struct htlc_out *hout;
+	struct htlc_out_map_iter outi;
+	size_t *num_in = tal_arrz(tmpctx, size_t, tal_count(channels));
+	size_t *num_out = tal_arrz(tmpctx, size_t, tal_count(channels));
+	struct amount_msat *in_msat, *out_msat;
+
+	in_msat = tal_arrz(tmpctx, struct amount_msat, tal_count(channels));
+	out_msat = tal_arrz(tmpctx, struct amount_msat, tal_count(channels));
+	for (hin = htlc_in_map_first(ld->htlcs_in, &ini);
+	     hin;
+	     hin = htlc_in_map_next(ld->htlcs_in, &ini)) {
+		size_t i = hin->key.channel->dbid - 1;
+		num_in[i]++;
+		if (!amount_msat_add(&in_msat[i], in_msat[i], hin->msat))
+			abort();
+	}
+	for (hout = htlc_out_map_first(ld->htlcs_out, &outi);
+	     hout;
+	     hout = htlc_out_map_next(ld->htlcs_out, &outi)) {
+		size_t i = hout->key.channel->dbid - 1;
+		num_out[i]++;
+		if (!amount_msat_add(&out_msat[i], out_msat[i], hout->msat))
+			abort();
+	}
+
+	for (size_t i = 0; i < tal_count(channels); i++) {
+		struct channel *c = channels[i];
+		size_t n;
+
+		assert(c->num_htlcs_in == num_in[i]);
+		assert(c->num_htlcs_out == num_out[i]);
+		assert(amount_msat_eq(c->htlcs_in_msat, in_msat[i]));
+		assert(amount_msat_eq(c->htlcs_out_msat, out_msat[i]));
+
+		n = 0;
+		list_for_each(&c->htlcs_in, hin, list) {
+			assert(hin->key.channel == c);
+			n++;
+		}
+		assert(n == num_in[i]);
+		n = 0;
+		list_for_each(&c->htlcs_out, hout, list) {
+			assert(hout->key.channel == c);
+			n++;
+		}
+		assert(n == num_out[i]);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	struct lightningd *ld;
+	struct channel **channels;
+	struct json_stream *peerchannels, *balances, *filtered;
+	const char *balance_fields[] = { "short_channel_id", "spendable_msat",
+					 NULL };
+	const char *cheap_fields[] = { "short_channel_id", "to_us_msat",
+				       NULL };
+	size_t num_channels = 10, num_htlcs = 40;
+	const char *buf;
+	u64 gen;
+
+	common_setup(argv[0]);
+	chainparams = chainparams_for_network("regtest");
+
+	ld = talz(NULL, struct lightningd);
+	ld->id.k[0] = 0x02;
+	ld->our_features = feature_set_for_feature(ld,
+				OPTIONAL_FEATURE(OPT_LARGE_CHANNELS));
+	ld->peers = tal(ld, struct peer_node_id_map);
+	peer_node_id_map_init(ld->peers);
+	ld->htlcs_in = tal(ld, struct htlc_in_map);
+	htlc_in_map_init(ld->htlcs_in);
+	ld->htlcs_out = tal(ld, struct htlc_out_map);
+	htlc_out_map_init(ld->htlcs_out);
+
+	channels = tal_arr(ld, struct channel *, num_channels);
+	for (size_t i = 0; i < num_channels; i++)
+		channels[i] = add_channel(ld, i);
+	for (size_t i = 0; i < num_htlcs; i++)
+		add_htlc(ld, channels[(i * 7919) % num_channels], i);
+	check_htlc_totals(ld, channels);
+
+	peerchannels = list_peerchannels(ld, NULL);
+	balances = list_channelbalances(ld, 0);
+	check_balances(peerchannels, balances);
+	tal_free(balances);
+
+	/* Filtered listpeerchannels skips the HTLC walks it doesn't need. */
+	filtered = list_peerchannels(ld, balance_fields);
+	check_filtered(peerchannels, filtered, balance_fields);
+	tal_free(filtered);
+
+	filtered = list_peerchannels(ld, cheap_fields);
+	check_filtered(peerchannels, filtered, cheap_fields);
+	tal_free(filtered);
+	tal_free(peerchannels);
+
+	balances = list_channelbalances(ld, 0);
+	assert(get_channels(balances, &buf)->size == num_channels);
+	tal_free(balances);
+
+	/* A few payments later... */
+	gen = ld->channel_balance_gen;
+	for (size_t i = 0; i < NUM_CHANGED; i++) {
+		struct channel *c = channels[i * num_channels / NUM_CHANGED];
+		if (!amount_msat_sub(&c->our_msat, c->our_msat,
+				     AMOUNT_MSAT(1000000)))
+			abort();
+		add_htlc(ld, c, num_htlcs + i);
+	}
+	balances = list_channelbalances(ld, gen);
+	assert(get_channels(balances, &buf)->size == NUM_CHANGED);
+	tal_free(balances);
+
+	/* Those were recalculated correctly. */
+	for (size_t i = 0; i < NUM_CHANGED; i++) {
+		struct channel *c = channels[i * num_channels / NUM_CHANGED];
+		assert(c->balance.gen == c->balance_gen);
+		assert(amount_msat_eq(c->balance.spendable,
+				      channel_amount_spendable(c)));
+		assert(amount_msat_eq(c->balance.receivable,
+				      channel_amount_receivable(c)));
+	}
+
+	/* Nothing since then. */
+	balances = list_channelbalances(ld, ld->channel_balance_gen);
+	assert(get_channels(balances, &buf)->size == 0);
+	tal_free(balances);
+
+	/* Resolved HTLCs leave their channel's lists and totals. */
+	for (size_t i = 0; i < NUM_CHANGED; i++) {
+		struct channel *c = channels[i * num_channels / NUM_CHANGED];
+		tal_free(list_top(&c->htlcs_in, struct htlc_in, list));
+		tal_free(list_top(&c->htlcs_out, struct htlc_out, list));
+	}
+	check_htlc_totals(ld, channels);
+
+	tal_free(ld);
+	common_shutdown();
+}
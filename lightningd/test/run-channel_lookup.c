@@ -0,0 +1,374 @@
+#include "config.h"
+#include "../channel.c"
+#include <common/setup.h>
+#include <stdio.h>
+
+/* AUTOGENERATED MOCKS START */
+/* Generated stub for command_fail */
+struct command_result *command_fail(struct command *cmd UNNEEDED, enum jsonrpc_errcode code UNNEEDED,
+				    const char *fmt UNNEEDED, ...)
+
+{ fprintf(stderr, "command_fail called!\n"); abort(); }
+/* Generated stub for command_success */
+struct command_result *command_success(struct command *cmd UNNEEDED,
+				       struct json_stream *response)
+
+{ fprintf(stderr, "command_success called!\n"); abort(); }
+/* Generated stub for dev_disconnect_permanent */
+bool dev_disconnect_permanent(struct lightningd *ld UNNEEDED)
+{ fprintf(stderr, "dev_disconnect_permanent called!\n"); abort(); }
+/* Generated stub for drop_to_chain */
+void drop_to_chain(struct lightningd *ld UNNEEDED, struct channel *channel UNNEEDED, bool cooperative UNNEEDED)
+{ fprintf(stderr, "drop_to_chain called!\n"); abort(); }
+/* Generated stub for dup_height_states */
+struct height_states *dup_height_states(const tal_t *ctx UNNEEDED,
+					const struct height_states *states TAKES UNNEEDED)
+{ fprintf(stderr, "dup_height_states called!\n"); abort(); }
+/* Generated stub for fatal */
+void   fatal(const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "fatal called!\n"); abort(); }
+/* Generated stub for fromwire_hsmd_get_channel_basepoints_reply */
+bool fromwire_hsmd_get_channel_basepoints_reply(const void *p UNNEEDED, struct basepoints *basepoints UNNEEDED, struct pubkey *funding_pubkey UNNEEDED)
+{ fprintf(stderr, "fromwire_hsmd_get_channel_basepoints_reply called!\n"); abort(); }
+/* Generated stub for fromwire_hsmd_new_channel_reply */
+bool fromwire_hsmd_new_channel_reply(const void *p UNNEEDED)
+{ fprintf(stderr, "fromwire_hsmd_new_channel_reply called!\n"); abort(); }
+/* Generated stub for hash_htlc_key */
+size_t hash_htlc_key(const struct htlc_key *htlc_key UNNEEDED)
+{ fprintf(stderr, "hash_htlc_key called!\n"); abort(); }
+/* Generated stub for hsm_sync_req */
+const u8 *hsm_sync_req(const tal_t *ctx UNNEEDED,
+		       struct lightningd *ld UNNEEDED,
+		       const u8 *msg TAKES UNNEEDED)
+{ fprintf(stderr, "hsm_sync_req called!\n"); abort(); }
+/* Generated stub for json_add_bool */
+void json_add_bool(struct json_stream *result UNNEEDED, const char *fieldname UNNEEDED,
+		   bool value UNNEEDED)
+{ fprintf(stderr, "json_add_bool called!\n"); abort(); }
+/* Generated stub for json_add_channel_id */
+void json_add_channel_id(struct json_stream *response UNNEEDED,
+			 const char *fieldname UNNEEDED,
+			 const struct channel_id *cid UNNEEDED)
+{ fprintf(stderr, "json_add_channel_id called!\n"); abort(); }
+/* Generated stub for json_add_string */
+void json_add_string(struct json_stream *js UNNEEDED,
+		     const char *fieldname UNNEEDED,
+		     const char *str TAKES UNNEEDED)
+{ fprintf(stderr, "json_add_string called!\n"); abort(); }
+/* Generated stub for json_stream_success */
+struct json_stream *json_stream_success(struct command *cmd UNNEEDED)
+{ fprintf(stderr, "json_stream_success called!\n"); abort(); }
+/* Generated stub for log_ */
+void log_(struct log *log UNNEEDED, enum log_level level UNNEEDED,
+	  const struct node_id *node_id UNNEEDED,
+	  bool call_notifier UNNEEDED,
+	  const char *fmt UNNEEDED, ...)
+
+{ fprintf(stderr, "log_ called!\n"); abort(); }
+/* Generated stub for maybe_delete_peer */
+void maybe_delete_peer(struct peer *peer UNNEEDED)
+{ fprintf(stderr, "maybe_delete_peer called!\n"); abort(); }
+/* Generated stub for new_log */
+struct log *new_log(const tal_t *ctx UNNEEDED, struct log_book *record UNNEEDED,
+		    const struct node_id *default_node_id UNNEEDED,
+		    const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "new_log called!\n"); abort(); }
+/* Generated stub for notify_channel_open_failed */
+void notify_channel_open_failed(struct lightningd *ld UNNEEDED,
+                                const struct channel_id *cid UNNEEDED)
+{ fprintf(stderr, "notify_channel_open_failed called!\n"); abort(); }
+/* Generated stub for notify_channel_state_changed */
+void notify_channel_state_changed(struct lightningd *ld UNNEEDED,
+				  struct node_id *peer_id UNNEEDED,
+				  struct channel_id *cid UNNEEDED,
+				  struct short_channel_id *scid UNNEEDED,
+				  struct timeabs *timestamp UNNEEDED,
+				  enum channel_state old_state UNNEEDED,
+				  enum channel_state new_state UNNEEDED,
+				  enum state_change cause UNNEEDED,
+				  char *message UNNEEDED)
+{ fprintf(stderr, "notify_channel_state_changed called!\n"); abort(); }
+/* Generated stub for p2wpkh_for_keyidx */
+u8 *p2wpkh_for_keyidx(const tal_t *ctx UNNEEDED, struct lightningd *ld UNNEEDED, u64 keyidx UNNEEDED)
+{ fprintf(stderr, "p2wpkh_for_keyidx called!\n"); abort(); }
+/* Generated stub for subd_release_channel */
+void subd_release_channel(struct subd *owner UNNEEDED, const void *channel UNNEEDED)
+{ fprintf(stderr, "subd_release_channel called!\n"); abort(); }
+/* Generated stub for towire_errorfmt */
+u8 *towire_errorfmt(const tal_t *ctx UNNEEDED,
+		    const struct channel_id *channel UNNEEDED,
+		    const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "towire_errorfmt called!\n"); abort(); }
+/* Generated stub for towire_hsmd_get_channel_basepoints */
+u8 *towire_hsmd_get_channel_basepoints(const tal_t *ctx UNNEEDED, const struct node_id *peerid UNNEEDED, u64 dbid UNNEEDED)
+{ fprintf(stderr, "towire_hsmd_get_channel_basepoints called!\n"); abort(); }
+/* Generated stub for towire_hsmd_new_channel */
+u8 *towire_hsmd_new_channel(const tal_t *ctx UNNEEDED, const struct node_id *id UNNEEDED, u64 dbid UNNEEDED)
+{ fprintf(stderr, "towire_hsmd_new_channel called!\n"); abort(); }
+/* Generated stub for txfilter_add_scriptpubkey */
+void txfilter_add_scriptpubkey(struct txfilter *filter UNNEEDED, const u8 *script TAKES UNNEEDED)
+{ fprintf(stderr, "txfilter_add_scriptpubkey called!\n"); abort(); }
+/* Generated stub for wallet_channel_close */
+void wallet_channel_close(struct wallet *w UNNEEDED, u64 wallet_id UNNEEDED)
+{ fprintf(stderr, "wallet_channel_close called!\n"); abort(); }
+/* Generated stub for wallet_channel_save */
+void wallet_channel_save(struct wallet *w UNNEEDED, struct channel *chan UNNEEDED)
+{ fprintf(stderr, "wallet_channel_save called!\n"); abort(); }
+/* Generated stub for wallet_get_channel_dbid */
+u64 wallet_get_channel_dbid(struct wallet *wallet UNNEEDED)
+{ fprintf(stderr, "wallet_get_channel_dbid called!\n"); abort(); }
+/* Generated stub for wallet_state_change_add */
+void wallet_state_change_add(struct wallet *w UNNEEDED,
+			     const u64 channel_id UNNEEDED,
+			     struct timeabs *timestamp UNNEEDED,
+			     enum channel_state old_state UNNEEDED,
+			     enum channel_state new_state UNNEEDED,
+			     enum state_change cause UNNEEDED,
+			     char *message UNNEEDED)
+{ fprintf(stderr, "wallet_state_change_add called!\n"); abort(); }
+/* AUTOGENERATED MOCKS END */
+
+/* The old way: walk every channel of every peer. */
+static struct channel *scan_by_scid(struct lightningd *ld,
+				    const struct short_channel_id *scid,
+				    bool privacy_leak_ok)
+{
+	struct peer *p;
+	struct channel *chan;
+	struct peer_node_id_map_iter it;
+
+	for (p = peer_node_id_map_first(ld->peers, &it);
+	     p;
+	     p = peer_node_id_map_next(ld->peers, &it)) {
+		list_for_each(&p->channels, chan, list) {
+			if (chan->alias[LOCAL] &&
+			    short_channel_id_eq(scid, chan->alias[LOCAL]))
+				return chan;
+			if (!privacy_leak_ok
+			    && channel_type_has(chan->type, OPT_SCID_ALIAS))
+				continue;
+			if (chan->scid
+			    && short_channel_id_eq(scid, chan->scid))
+				return chan;
+		}
+	}
+	return NULL;
+}
+
+static struct channel *scan_by_cid(struct lightningd *ld,
+				   const struct channel_id *cid)
+{
+	struct peer *p;
+	struct channel *chan;
+	struct peer_node_id_map_iter it;
+
+	for (p = peer_node_id_map_first(ld->peers, &it);
+	     p;
+	     p = peer_node_id_map_next(ld->peers, &it)) {
+		list_for_each(&p->channels, chan, list) {
+			if (channel_id_eq(&chan->cid, cid))
+				return chan;
+		}
+	}
+	return NULL;
+}
+
+static void random_fill(void *p, size_t len)
+{
+	for (size_t i = 0; i < len; i++)
+		((u8 *)p)[i] = pseudorand(256);
+}
+
+static struct peer *new_test_peer(struct lightningd *ld, size_t n)
+{
+	struct peer *peer = talz(ld, struct peer);
+
+	peer->ld = ld;
+	memcpy(peer->id.k, &n, sizeof(n));
+	list_head_init(&peer->channels);
+	peer_node_id_map_add(ld->peers, peer);
+	return peer;
+}
+
+/* Like new_channel() (dbid != 0) or new_unsaved_channel() (dbid == 0) */
+static struct channel *new_test_channel(struct peer *peer, u64 dbid,
+					const struct short_channel_id *scid,
+					bool private)
+{
+	struct channel *c = talz(peer->ld, struct channel);
+	struct channel_type *type = channel_type_none(c);
+	struct short_channel_id alias;
+
+	c->peer = peer;
+	c->dbid = dbid;
+	if (scid)
+		c->scid = tal_dup(c, struct short_channel_id, scid);
+	if (private)
+		channel_type_set_scid_alias(type);
+	c->type = type;
+	random_fill(&alias, sizeof(alias));
+	c->alias[LOCAL] = tal_dup(c, struct short_channel_id, &alias);
+	random_fill(&c->cid, sizeof(c->cid));
+	c->forgets = tal_arr(c, struct command *, 0);
+	list_head_init(&c->inflights);
+	list_head_init(&c->htlcs_in);
+	list_head_init(&c->htlcs_out);
+	list_add_tail(&peer->channels, &c->list);
+	channel_index(c);
+	tal_add_destructor(c, destroy_channel);
+	return c;
+}
+
+static void check_indexed(struct lightningd *ld, struct channel *c)
+{
+	if (c->alias[LOCAL])
+		assert(any_channel_by_scid(ld, c->alias[LOCAL], false) == c);
+	if (c->scid) {
+		assert(any_channel_by_scid(ld, c->scid, true) == c);
+		if (channel_type_has(c->type, OPT_SCID_ALIAS))
+			assert(!any_channel_by_scid(ld, c->scid, false));
+		else
+			assert(any_channel_by_scid(ld, c->scid, false) == c);
+	}
+	assert(channel_by_cid(ld, &c->cid) == c);
+	if (c->dbid)
+		assert(channel_by_dbid(ld, c->dbid) == c);
+}
+
+static void test_updates(struct lightningd *ld, struct peer *peer)
+{
+	struct short_channel_id scid, old_scid, alias, stub;
+	struct channel_id cid, old_cid;
+	struct channel *c, *c2;
+	struct channel_type *private_type;
+
+	/* Unsaved channels only have a cid; they get a dbid once saved */
+	c = new_test_channel(peer, 0, NULL, false);
+	check_indexed(ld, c);
+	channel_set_dbid(c, 1000001);
+	check_indexed(ld, c);
+
+	/* channel_id can change during dual-funding negotiation */
+	old_cid = c->cid;
+	memset(&cid, 7, sizeof(cid));
+	channel_set_cid(c, &cid);
+	assert(!channel_by_cid(ld, &old_cid));
+	check_indexed(ld, c);
+
+	/* scid appears on lockin, and can change on reorg or splice */
+	assert(mk_short_channel_id(&scid, 1000001, 1, 0));
+	channel_set_scid(c, &scid);
+	check_indexed(ld, c);
+	old_scid = scid;
+	assert(mk_short_channel_id(&scid, 1000002, 1, 0));
+	channel_set_scid(c, &scid);
+	assert(!any_channel_by_scid(ld, &old_scid, true));
+	check_indexed(ld, c);
+
+	/* Local alias changes */
+	old_scid = *c->alias[LOCAL];
+	assert(mk_short_channel_id(&alias, 1000003, 1, 0));
+	channel_set_local_alias(c, &alias);
+	assert(!any_channel_by_scid(ld, &old_scid, true));
+	check_indexed(ld, c);
+
+	/* Stub scids (from recovery) are shared: we must not stop at a
+	 * private one when looking for a public one. */
+	assert(mk_short_channel_id(&stub, 1, 1, 1));
+	c2 = new_test_channel(peer, 1000002, &stub, true);
+	check_indexed(ld, c2);
+	channel_set_scid(c, &stub);
+	private_type = channel_type_none(c);
+	channel_type_set_scid_alias(private_type);
+	c->type = private_type;
+	assert(!any_channel_by_scid(ld, &stub, false));
+	c->type = channel_type_none(c);
+	assert(any_channel_by_scid(ld, &stub, false) == c);
+	assert(any_channel_by_scid(ld, &stub, true));
+
+	/* Freeing removes it from every index */
+	scid = *c->alias[LOCAL];
+	cid = c->cid;
+	tal_free(c);
+	assert(any_channel_by_scid(ld, &stub, true) == c2);
+	assert(!any_channel_by_scid(ld, &scid, true));
+	assert(!channel_by_cid(ld, &cid));
+	assert(!channel_by_dbid(ld, 1000001));
+	tal_free(c2);
+	assert(!any_channel_by_scid(ld, &stub, true));
+	assert(!channel_by_dbid(ld, 1000002));
+}
+
+/* Find the outgoing channel the way a forward does: by scid (no
+ * privacy leaks!), then by channel_id.  The indexes must agree with
+ * walking every channel. */
+static void check_forwards(struct lightningd *ld, struct channel **chans)
+{
+	for (size_t i = 0; i < tal_count(chans); i++) {
+		struct channel *c = chans[i];
+		const struct short_channel_id *scid;
+		struct channel *out;
+
+		scid = c->alias[LOCAL];
+		if (!channel_type_has(c->type, OPT_SCID_ALIAS) && (i % 2))
+			scid = c->scid;
+
+		out = any_channel_by_scid(ld, scid, false);
+		assert(out == scan_by_scid(ld, scid, false));
+		assert(channel_by_cid(ld, &out->cid) == c);
+
+		/* Private channels don't leak their real scid */
+		assert(any_channel_by_scid(ld, c->scid, false)
+		       == scan_by_scid(ld, c->scid, false));
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	struct lightningd *ld;
+	struct channel **chans;
+	size_t num_chans = 100;
+
+	common_setup(argv[0]);
+
+	ld = tal(tmpctx, struct lightningd);
+	ld->peers = tal(ld, struct peer_node_id_map);
+	peer_node_id_map_init(ld->peers);
+	ld->channels_by_scid = tal(ld, struct channel_scid_map);
+	channel_scid_map_init(ld->channels_by_scid);
+	ld->channels_by_alias = tal(ld, struct channel_alias_map);
+	channel_alias_map_init(ld->channels_by_alias);
+	ld->channels_by_cid = tal(ld, struct channel_cid_map);
+	channel_cid_map_init(ld->channels_by_cid);
+	ld->channels_by_dbid = tal(ld, struct channel_dbid_map);
+	channel_dbid_map_init(ld->channels_by_dbid);
+	/* Accessed in channel destructor sanity check */
+	ld->htlcs_in = tal(ld, struct htlc_in_map);
+	htlc_in_map_init(ld->htlcs_in);
+	ld->htlcs_out = tal(ld, struct htlc_out_map);
+	htlc_out_map_init(ld->htlcs_out);
+
+	test_updates(ld, new_test_peer(ld, 0));
+
+	/* A few channels per peer, a quarter of them private. */
+	chans = tal_arr(tmpctx, struct channel *, num_chans);
+	for (size_t i = 0; i < num_chans; i++) {
+		static struct peer *peer;
+		struct short_channel_id scid;
+
+		if (i % 3 == 0)
+			peer = new_test_peer(ld, i / 3 + 1);
+		assert(mk_short_channel_id(&scid, 700000 + i / 1000, i % 1000, 0));
+		chans[i] = new_test_channel(peer, i + 1, &scid, i % 4 == 0);
+	}
+	for (size_t i = 0; i < num_chans; i++) {
+		check_indexed(ld, chans[i]);
+		assert(scan_by_cid(ld, &chans[i]->cid) == chans[i]);
+	}
+
+	check_forwards(ld, chans);
+
+	for (size_t i = 0; i < num_chans; i++)
+		tal_free(chans[i]);
+	common_shutdown();
+}
@@ -142,12 +142,18 @@ void log_backtrace_exit(void)
 /* Generated stub for log_backtrace_print */
 void log_backtrace_print(const char *fmt UNNEEDED, ...)
 { fprintf(stderr, "log_backtrace_print called!\n"); abort(); }
+/* Generated stub for log_filter_subdaemons */
+bool log_filter_subdaemons(const struct log *log UNNEEDED)
+{ fprintf(stderr, "log_filter_subdaemons called!\n"); abort(); }
 /* Generated stub for log_prefix */
 const char *log_prefix(const struct log *log UNNEEDED)
 { fprintf(stderr, "log_prefix called!\n"); abort(); }
 /* Generated stub for log_print_level */
 enum log_level log_print_level(struct log *log UNNEEDED, const struct node_id *node_id UNNEEDED)
 { fprintf(stderr, "log_print_level called!\n"); abort(); }
+/* Generated stub for log_print_level_any */
+enum log_level log_print_level_any(struct log *log UNNEEDED)
+{ fprintf(stderr, "log_print_level_any called!\n"); abort(); }
 /* Generated stub for log_status_msg */
 bool log_status_msg(struct log *log UNNEEDED,
  		    const struct node_id *node_id UNNEEDED,
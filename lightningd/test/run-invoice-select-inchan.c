@@ -63,6 +63,9 @@ void broadcast_tx_(struct chain_topology *topo UNNEEDED,
 		   bool (*refresh)(struct channel * UNNEEDED, const struct bitcoin_tx ** UNNEEDED, void *) UNNEEDED,
 		   void *cbarg TAKES UNNEEDED)
 { fprintf(stderr, "broadcast_tx_ called!\n"); abort(); }
+/* Generated stub for channel_balance_changed */
+void channel_balance_changed(struct channel *channel UNNEEDED)
+{ fprintf(stderr, "channel_balance_changed called!\n"); abort(); }
 /* Generated stub for channel_change_state_reason_str */
 const char *channel_change_state_reason_str(enum state_change reason UNNEEDED)
 { fprintf(stderr, "channel_change_state_reason_str called!\n"); abort(); }
@@ -98,11 +101,18 @@ void channel_internal_error(struct channel *channel UNNEEDED, const char *fmt UN
 /* Generated stub for channel_last_funding_feerate */
 u32 channel_last_funding_feerate(const struct channel *channel UNNEEDED)
 { fprintf(stderr, "channel_last_funding_feerate called!\n"); abort(); }
+/* Generated stub for channel_set_cid */
+void channel_set_cid(struct channel *channel UNNEEDED, const struct channel_id *cid UNNEEDED)
+{ fprintf(stderr, "channel_set_cid called!\n"); abort(); }
 /* Generated stub for channel_set_last_tx */
 void channel_set_last_tx(struct channel *channel UNNEEDED,
 			 struct bitcoin_tx *tx UNNEEDED,
 			 const struct bitcoin_signature *sig UNNEEDED)
 { fprintf(stderr, "channel_set_last_tx called!\n"); abort(); }
+/* Generated stub for channel_set_scid */
+void channel_set_scid(struct channel *channel UNNEEDED,
+		      const struct short_channel_id *scid UNNEEDED)
+{ fprintf(stderr, "channel_set_scid called!\n"); abort(); }
 /* Generated stub for channel_state_name */
 const char *channel_state_name(const struct channel *channel UNNEEDED)
 { fprintf(stderr, "channel_state_name called!\n"); abort(); }
@@ -494,6 +504,13 @@ struct json_stream *json_stream_fail(struct command *cmd UNNEEDED,
 /* Generated stub for json_stream_success */
 struct json_stream *json_stream_success(struct command *cmd UNNEEDED)
 { fprintf(stderr, "json_stream_success called!\n"); abort(); }
+/* Generated stub for json_stream_wants */
+bool json_stream_wants(const struct json_stream *js UNNEEDED, const char *fieldname UNNEEDED)
+{ fprintf(stderr, "json_stream_wants called!\n"); abort(); }
+/* Generated stub for json_stream_wants_in_array */
+bool json_stream_wants_in_array(const struct json_stream *js UNNEEDED,
+				const char *fieldname UNNEEDED)
+{ fprintf(stderr, "json_stream_wants_in_array called!\n"); abort(); }
 /* Generated stub for json_to_address_scriptpubkey */
 enum address_parse_result json_to_address_scriptpubkey(const tal_t *ctx UNNEEDED,
 			     const struct chainparams *chainparams UNNEEDED,
@@ -906,7 +923,9 @@ bool wallet_invoice_find_unpaid(struct wallet *wallet UNNEEDED,
 { fprintf(stderr, "wallet_invoice_find_unpaid called!\n"); abort(); }
 /* Generated stub for wallet_invoice_iterate */
 bool wallet_invoice_iterate(struct wallet *wallet UNNEEDED,
-			    struct invoice_iterator *it UNNEEDED)
+			    struct invoice_iterator *it UNNEEDED,
+			    bool want_invstring UNNEEDED,
+			    const struct sha256 *local_offer_id UNNEEDED)
 { fprintf(stderr, "wallet_invoice_iterate called!\n"); abort(); }
 /* Generated stub for wallet_invoice_iterator_deref */
 const struct invoice_details *wallet_invoice_iterator_deref(const tal_t *ctx UNNEEDED,
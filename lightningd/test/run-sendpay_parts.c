@@ -0,0 +1,686 @@
+#include "config.h"
+#include "../pay.c"
+#include <ccan/err/err.h>
+#include <common/setup.h>
+#include <stdio.h>
+
+/* AUTOGENERATED MOCKS START */
+/* Generated stub for channel_scid_or_local_alias */
+const struct short_channel_id *channel_scid_or_local_alias(const struct channel *chan UNNEEDED)
+{ fprintf(stderr, "channel_scid_or_local_alias called!\n"); abort(); }
+/* Generated stub for command_param_failed */
+struct command_result *command_param_failed(void)
+{ fprintf(stderr, "command_param_failed called!\n"); abort(); }
+/* Generated stub for create_onionpacket */
+struct onionpacket *create_onionpacket(
+	const tal_t * ctx UNNEEDED,
+	struct sphinx_path *sp UNNEEDED,
+	size_t fixed_size UNNEEDED,
+	struct secret **path_secrets
+	)
+{ fprintf(stderr, "create_onionpacket called!\n"); abort(); }
+/* Generated stub for find_channel_by_alias */
+struct channel *find_channel_by_alias(const struct peer *peer UNNEEDED,
+				      const struct short_channel_id *alias UNNEEDED,
+				      enum side side UNNEEDED)
+{ fprintf(stderr, "find_channel_by_alias called!\n"); abort(); }
+/* Generated stub for invoice_decode */
+struct tlv_invoice *invoice_decode(const tal_t *ctx UNNEEDED,
+				   const char *b12 UNNEEDED, size_t b12len UNNEEDED,
+				   const struct feature_set *our_features UNNEEDED,
+				   const struct chainparams *must_be_chain UNNEEDED,
+				   char **fail UNNEEDED)
+{ fprintf(stderr, "invoice_decode called!\n"); abort(); }
+/* Generated stub for json_to_msat */
+bool json_to_msat(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+		  struct amount_msat *msat UNNEEDED)
+{ fprintf(stderr, "json_to_msat called!\n"); abort(); }
+/* Generated stub for json_to_node_id */
+bool json_to_node_id(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+			       struct node_id *id UNNEEDED)
+{ fprintf(stderr, "json_to_node_id called!\n"); abort(); }
+/* Generated stub for json_to_number */
+bool json_to_number(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+		    unsigned int *num UNNEEDED)
+{ fprintf(stderr, "json_to_number called!\n"); abort(); }
+/* Generated stub for json_to_short_channel_id */
+bool json_to_short_channel_id(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+			      struct short_channel_id *scid UNNEEDED)
+{ fprintf(stderr, "json_to_short_channel_id called!\n"); abort(); }
+/* Generated stub for new_reltimer_ */
+struct oneshot *new_reltimer_(struct timers *timers UNNEEDED,
+			      const tal_t *ctx UNNEEDED,
+			      struct timerel expire UNNEEDED,
+			      void (*cb)(void *) UNNEEDED, void *arg UNNEEDED)
+{ fprintf(stderr, "new_reltimer_ called!\n"); abort(); }
+/* Generated stub for onion_final_hop */
+u8 *onion_final_hop(const tal_t *ctx UNNEEDED,
+		    struct amount_msat forward UNNEEDED,
+		    u32 outgoing_cltv UNNEEDED,
+		    struct amount_msat total_msat UNNEEDED,
+		    const struct secret *payment_secret UNNEEDED,
+		    const u8 *payment_metadata UNNEEDED)
+{ fprintf(stderr, "onion_final_hop called!\n"); abort(); }
+/* Generated stub for onion_nonfinal_hop */
+u8 *onion_nonfinal_hop(const tal_t *ctx UNNEEDED,
+		       const struct short_channel_id *scid UNNEEDED,
+		       struct amount_msat forward UNNEEDED,
+		       u32 outgoing_cltv UNNEEDED)
+{ fprintf(stderr, "onion_nonfinal_hop called!\n"); abort(); }
+/* Generated stub for param */
+bool param(struct command *cmd UNNEEDED, const char *buffer UNNEEDED,
+	   const jsmntok_t params[] UNNEEDED, ...)
+{ fprintf(stderr, "param called!\n"); abort(); }
+/* Generated stub for param_bin_from_hex */
+struct command_result *param_bin_from_hex(struct command *cmd UNNEEDED, const char *name UNNEEDED,
+					  const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+					  u8 **bin UNNEEDED)
+{ fprintf(stderr, "param_bin_from_hex called!\n"); abort(); }
+/* Generated stub for param_escaped_string */
+struct command_result *param_escaped_string(struct command *cmd UNNEEDED,
+					    const char *name UNNEEDED,
+					    const char *buffer UNNEEDED,
+					    const jsmntok_t *tok UNNEEDED,
+					    const char **str UNNEEDED)
+{ fprintf(stderr, "param_escaped_string called!\n"); abort(); }
+/* Generated stub for param_msat */
+struct command_result *param_msat(struct command *cmd UNNEEDED, const char *name UNNEEDED,
+				  const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+				  struct amount_msat **msat UNNEEDED)
+{ fprintf(stderr, "param_msat called!\n"); abort(); }
+/* Generated stub for param_node_id */
+struct command_result *param_node_id(struct command *cmd UNNEEDED,
+				     const char *name UNNEEDED,
+				     const char *buffer UNNEEDED,
+				     const jsmntok_t *tok UNNEEDED,
+				     struct node_id **id UNNEEDED)
+{ fprintf(stderr, "param_node_id called!\n"); abort(); }
+/* Generated stub for param_number */
+struct command_result *param_number(struct command *cmd UNNEEDED, const char *name UNNEEDED,
+				    const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+				    unsigned int **num UNNEEDED)
+{ fprintf(stderr, "param_number called!\n"); abort(); }
+/* Generated stub for param_secret */
+struct command_result *param_secret(struct command *cmd UNNEEDED, const char *name UNNEEDED,
+				    const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+				    struct secret **secret UNNEEDED)
+{ fprintf(stderr, "param_secret called!\n"); abort(); }
+/* Generated stub for param_short_channel_id */
+struct command_result *param_short_channel_id(struct command *cmd UNNEEDED,
+					      const char *name UNNEEDED,
+					      const char *buffer UNNEEDED,
+					      const jsmntok_t *tok UNNEEDED,
+					      struct short_channel_id **scid UNNEEDED)
+{ fprintf(stderr, "param_short_channel_id called!\n"); abort(); }
+/* Generated stub for param_string */
+struct command_result *param_string(struct command *cmd UNNEEDED, const char *name UNNEEDED,
+				    const char * buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+				    const char **str UNNEEDED)
+{ fprintf(stderr, "param_string called!\n"); abort(); }
+/* Generated stub for parse_onionpacket */
+struct onionpacket *parse_onionpacket(const tal_t *ctx UNNEEDED,
+				      const u8 *src UNNEEDED,
+				      const size_t srclen UNNEEDED,
+				      enum onion_wire *failcode UNNEEDED)
+{ fprintf(stderr, "parse_onionpacket called!\n"); abort(); }
+/* Generated stub for pubkey_from_node_id */
+bool pubkey_from_node_id(struct pubkey *key UNNEEDED, const struct node_id *id UNNEEDED)
+{ fprintf(stderr, "pubkey_from_node_id called!\n"); abort(); }
+/* Generated stub for sphinx_add_hop_has_length */
+bool sphinx_add_hop_has_length(struct sphinx_path *path UNNEEDED, const struct pubkey *pubkey UNNEEDED,
+			       const u8 *payload TAKES UNNEEDED)
+{ fprintf(stderr, "sphinx_add_hop_has_length called!\n"); abort(); }
+/* Generated stub for sphinx_path_new */
+struct sphinx_path *sphinx_path_new(const tal_t *ctx UNNEEDED,
+				    const u8 *associated_data UNNEEDED)
+{ fprintf(stderr, "sphinx_path_new called!\n"); abort(); }
+/* Generated stub for sphinx_path_new_with_key */
+struct sphinx_path *sphinx_path_new_with_key(const tal_t *ctx UNNEEDED,
+					     const u8 *associated_data UNNEEDED,
+					     const struct secret *session_key UNNEEDED)
+{ fprintf(stderr, "sphinx_path_new_with_key called!\n"); abort(); }
+/* Generated stub for sphinx_path_payloads_size */
+size_t sphinx_path_payloads_size(const struct sphinx_path *path UNNEEDED)
+{ fprintf(stderr, "sphinx_path_payloads_size called!\n"); abort(); }
+/* Generated stub for unwrap_onionreply */
+u8 *unwrap_onionreply(const tal_t *ctx UNNEEDED,
+		      const struct secret *shared_secrets UNNEEDED,
+		      const int numhops UNNEEDED,
+		      const struct onionreply *reply UNNEEDED,
+		      int *origin_index UNNEEDED)
+{ fprintf(stderr, "unwrap_onionreply called!\n"); abort(); }
+/* Generated stub for wallet_invoice_request_find */
+char *wallet_invoice_request_find(const tal_t *ctx UNNEEDED,
+			struct wallet *w UNNEEDED,
+			const struct sha256 *invreq_id UNNEEDED,
+			const struct json_escape **label UNNEEDED,
+			enum offer_status *status UNNEEDED)
+{ fprintf(stderr, "wallet_invoice_request_find called!\n"); abort(); }
+/* Generated stub for wallet_invoice_request_mark_used */
+void wallet_invoice_request_mark_used(struct db *db UNNEEDED, const struct sha256 *invreq_id UNNEEDED)
+{ fprintf(stderr, "wallet_invoice_request_mark_used called!\n"); abort(); }
+/* Generated stub for wallet_payment_delete */
+void wallet_payment_delete(struct wallet *wallet UNNEEDED,
+			   const struct sha256 *payment_hash UNNEEDED,
+			   const u64 *groupid UNNEEDED, const u64 *partid UNNEEDED,
+			   const enum wallet_payment_status *status UNNEEDED)
+{ fprintf(stderr, "wallet_payment_delete called!\n"); abort(); }
+/* Generated stub for wallet_payment_get_failinfo */
+void wallet_payment_get_failinfo(const tal_t *ctx UNNEEDED,
+				 struct wallet *wallet UNNEEDED,
+				 const struct sha256 *payment_hash UNNEEDED,
+				 u64 partid UNNEEDED,
+				 u64 groupid UNNEEDED,
+				 /* outputs */
+				 struct onionreply **failonionreply UNNEEDED,
+				 bool *faildestperm UNNEEDED,
+				 int *failindex UNNEEDED,
+				 enum onion_wire *failcode UNNEEDED,
+				 struct node_id **failnode UNNEEDED,
+				 struct short_channel_id **failchannel UNNEEDED,
+				 u8 **failupdate UNNEEDED,
+				 char **faildetail UNNEEDED,
+				 int *faildirection UNNEEDED)
+{ fprintf(stderr, "wallet_payment_get_failinfo called!\n"); abort(); }
+/* Generated stub for wallet_payment_get_groupid */
+u64 wallet_payment_get_groupid(struct wallet *wallet UNNEEDED,
+			       const struct sha256 *payment_hash UNNEEDED)
+{ fprintf(stderr, "wallet_payment_get_groupid called!\n"); abort(); }
+/* Generated stub for wallet_payments_by_invoice_request */
+const struct wallet_payment **wallet_payments_by_invoice_request(const tal_t *ctx UNNEEDED,
+								 struct wallet *wallet UNNEEDED,
+								 const struct sha256 *local_invreq_id UNNEEDED)
+{ fprintf(stderr, "wallet_payments_by_invoice_request called!\n"); abort(); }
+/* AUTOGENERATED MOCKS END */
+
+/* Concurrent payments, each split into this many parts */
+#define NUM_PAYMENTS 10
+#define NUM_PARTS 8
+
+/* This is private to jsonrpc.c */
+struct command_result {
+	char c;
+};
+static struct command_result result;
+static size_t num_pending, num_succeeded, num_failed;
+static enum jsonrpc_errcode last_errcode;
+
+static struct peer *peer;
+static struct channel *channel;
+
+/* Our fake db: payments by payment index (first bytes of payment_hash) */
+static struct wallet_payment **payments[NUM_PAYMENTS];
+static u64 next_payment_id;
+static size_t db_loads, db_rows_loaded;
+
+struct command_result *command_fail(struct command *cmd,
+				    enum jsonrpc_errcode code,
+				    const char *fmt UNNEEDED, ...)
+{
+	last_errcode = code;
+	num_failed++;
+	tal_free(cmd);
+	return &result;
+}
+
+struct command_result *command_failed(struct command *cmd,
+				      struct json_stream *js UNNEEDED)
+{
+	num_failed++;
+	tal_free(cmd);
+	return &result;
+}
+
+struct command_result *command_success(struct command *cmd,
+				       struct json_stream *js UNNEEDED)
+{
+	num_succeeded++;
+	tal_free(cmd);
+	return &result;
+}
+
+struct command_result *command_still_pending(struct command *cmd UNNEEDED)
+{
+	num_pending++;
+	return &result;
+}
+
+struct json_stream *json_stream_fail(struct command *cmd,
+				     enum jsonrpc_errcode code,
+				     const char *errmsg UNNEEDED)
+{
+	last_errcode = code;
+	return (struct json_stream *)tal(cmd, char);
+}
+
+struct json_stream *json_stream_success(struct command *cmd)
+{
+	return (struct json_stream *)tal(cmd, char);
+}
+
+void json_add_amount_msat(struct json_stream *result UNNEEDED,
+			  const char *msatfieldname UNNEEDED,
+			  struct amount_msat msat UNNEEDED)
+{
+}
+void json_add_hex(struct json_stream *result UNNEEDED,
+		  const char *fieldname UNNEEDED,
+		  const void *data UNNEEDED, size_t len UNNEEDED)
+{
+}
+void json_add_hex_talarr(struct json_stream *result UNNEEDED,
+			 const char *fieldname UNNEEDED,
+			 const tal_t *data UNNEEDED)
+{
+}
+void json_add_node_id(struct json_stream *response UNNEEDED,
+		      const char *fieldname UNNEEDED,
+		      const struct node_id *id UNNEEDED)
+{
+}
+void json_add_num(struct json_stream *result UNNEEDED,
+		  const char *fieldname UNNEEDED,
+		  unsigned int value UNNEEDED)
+{
+}
+void json_add_preimage(struct json_stream *result UNNEEDED,
+		       const char *fieldname UNNEEDED,
+		       const struct preimage *preimage UNNEEDED)
+{
+}
+void json_add_secret(struct json_stream *response UNNEEDED,
+		     const char *fieldname UNNEEDED,
+		     const struct secret *secret UNNEEDED)
+{
+}
+void json_add_sha256(struct json_stream *result UNNEEDED,
+		     const char *fieldname UNNEEDED,
+		     const struct sha256 *hash UNNEEDED)
+{
+}
+void json_add_short_channel_id(struct json_stream *response UNNEEDED,
+			       const char *fieldname UNNEEDED,
+			       const struct short_channel_id *id UNNEEDED)
+{
+}
+void json_add_string(struct json_stream *js UNNEEDED,
+		     const char *fieldname UNNEEDED,
+		     const char *str TAKES UNNEEDED)
+{
+}
+void json_add_u32(struct json_stream *result UNNEEDED,
+		  const char *fieldname UNNEEDED,
+		  uint32_t value UNNEEDED)
+{
+}
+void json_add_u64(struct json_stream *result UNNEEDED,
+		  const char *fieldname UNNEEDED,
+		  uint64_t value UNNEEDED)
+{
+}
+void json_array_end(struct json_stream *js UNNEEDED)
+{
+}
+void json_array_start(struct json_stream *js UNNEEDED,
+		      const char *fieldname UNNEEDED)
+{
+}
+void json_object_end(struct json_stream *js UNNEEDED)
+{
+}
+void json_object_start(struct json_stream *ks UNNEEDED,
+		       const char *fieldname UNNEEDED)
+{
+}
+
+void log_(struct log *log UNNEEDED, enum log_level level UNNEEDED,
+	  const struct node_id *node_id UNNEEDED,
+	  bool call_notifier UNNEEDED,
+	  const char *fmt UNNEEDED, ...)
+{
+}
+
+void notify_sendpay_failure(struct lightningd *ld UNNEEDED,
+			    const struct wallet_payment *payment UNNEEDED,
+			    enum jsonrpc_errcode pay_errcode UNNEEDED,
+			    const struct onionreply *onionreply UNNEEDED,
+			    const struct routing_failure *fail UNNEEDED,
+			    const char *errmsg UNNEEDED)
+{
+}
+
+void notify_sendpay_success(struct lightningd *ld UNNEEDED,
+			    const struct wallet_payment *payment UNNEEDED)
+{
+}
+
+struct peer *peer_by_id(struct lightningd *ld UNNEEDED,
+			const struct node_id *id UNNEEDED)
+{
+	return peer;
+}
+
+struct channel *find_channel_by_scid(const struct peer *p UNNEEDED,
+				     const struct short_channel_id *scid UNNEEDED)
+{
+	return channel;
+}
+
+u32 get_block_height(const struct chain_topology *topo UNNEEDED)
+{
+	return 100;
+}
+
+u8 *serialize_onionpacket(const tal_t *ctx,
+			  const struct onionpacket *packet UNNEEDED)
+{
+	return tal_arr(ctx, u8, 0);
+}
+
+const u8 *send_htlc_out(const tal_t *ctx UNNEEDED,
+			struct channel *out,
+			struct amount_msat amount UNNEEDED, u32 cltv UNNEEDED,
+			struct amount_msat final_msat UNNEEDED,
+			const struct sha256 *payment_hash,
+			const struct pubkey *blinding UNNEEDED,
+			u64 partid,
+			u64 groupid,
+			const u8 *onion_routing_packet UNNEEDED,
+			struct htlc_in *in UNNEEDED,
+			struct htlc_out **houtp)
+{
+	struct htlc_out *hout = talz(out, struct htlc_out);
+
+	hout->key.channel = out;
+	hout->payment_hash = *payment_hash;
+	hout->partid = partid;
+	hout->groupid = groupid;
+	*houtp = hout;
+	return NULL;
+}
+
+static struct wallet_payment ***payments_for(const struct sha256 *payment_hash)
+{
+	u32 idx;
+
+	memcpy(&idx, payment_hash, sizeof(idx));
+	assert(idx < NUM_PAYMENTS);
+	return &payments[idx];
+}
+
+/* Like the real thing, this costs per row. */
+const struct wallet_payment **wallet_payment_list(const tal_t *ctx,
+						  struct wallet *wallet UNNEEDED,
+						  const struct sha256 *payment_hash)
+{
+	struct wallet_payment **p = *payments_for(payment_hash);
+	const struct wallet_payment **ret;
+
+	ret = tal_arr(ctx, const struct wallet_payment *, tal_count(p));
+	for (size_t i = 0; i < tal_count(p); i++)
+		ret[i] = tal_dup(ret, struct wallet_payment, p[i]);
+	db_loads++;
+	db_rows_loaded += tal_count(p);
+	return ret;
+}
+
+struct wallet_payment *wallet_payment_by_hash(const tal_t *ctx UNNEEDED,
+					      struct wallet *wallet UNNEEDED,
+					      const struct sha256 *payment_hash,
+					      u64 partid, u64 groupid)
+{
+	struct wallet_payment **p = *payments_for(payment_hash);
+
+	for (size_t i = 0; i < tal_count(p); i++) {
+		if (p[i]->partid == partid && p[i]->groupid == groupid)
+			return p[i];
+	}
+	return NULL;
+}
+
+void wallet_payment_setup(struct wallet *wallet UNNEEDED,
+			  struct wallet_payment *payment)
+{
+	tal_arr_expand(payments_for(&payment->payment_hash), payment);
+}
+
+void wallet_payment_store(struct wallet *wallet UNNEEDED,
+			  struct wallet_payment *payment TAKES UNNEEDED)
+{
+	if (!payment->id)
+		payment->id = ++next_payment_id;
+}
+
+void wallet_payment_set_status(struct wallet *wallet,
+			       const struct sha256 *payment_hash,
+			       u64 partid, u64 groupid,
+			       const enum wallet_payment_status newstatus,
+			       const struct preimage *preimage UNNEEDED)
+{
+	wallet_payment_by_hash(NULL, wallet, payment_hash,
+			       partid, groupid)->status = newstatus;
+}
+
+void wallet_payment_set_failinfo(struct wallet *wallet UNNEEDED,
+				 const struct sha256 *payment_hash UNNEEDED,
+				 u64 partid UNNEEDED,
+				 const struct onionreply *failonionreply UNNEEDED,
+				 bool faildestperm UNNEEDED,
+				 int failindex UNNEEDED,
+				 enum onion_wire failcode UNNEEDED,
+				 const struct node_id *failnode UNNEEDED,
+				 const struct short_channel_id *failchannel UNNEEDED,
+				 const u8 *failupdate UNNEEDED,
+				 const char *faildetail UNNEEDED,
+				 int faildirection UNNEEDED)
+{
+}
+
+void wallet_local_htlc_out_delete(struct wallet *wallet UNNEEDED,
+				  struct channel *chan UNNEEDED,
+				  const struct sha256 *payment_hash UNNEEDED,
+				  u64 partid UNNEEDED)
+{
+}
+
+static struct sha256 payment_hash(u32 idx)
+{
+	struct sha256 h;
+
+	memset(&h, 0, sizeof(h));
+	memcpy(&h, &idx, sizeof(idx));
+	return h;
+}
+
+static struct command *new_cmd(struct lightningd *ld)
+{
+	struct command *cmd = talz(ld, struct command);
+	cmd->ld = ld;
+	return cmd;
+}
+
+/* sendpay, which returns once the HTLC is committed */
+static void sendpay(struct lightningd *ld, u32 idx, u64 partid, u64 groupid)
+{
+	struct sha256 h = payment_hash(idx);
+	struct route_hop first_hop;
+	struct node_id destination;
+	struct node_id *route_nodes = tal_arr(tmpctx, struct node_id, 1);
+	struct short_channel_id *route_channels
+		= tal_arr(tmpctx, struct short_channel_id, 1);
+
+	memset(&first_hop, 0, sizeof(first_hop));
+	first_hop.amount = AMOUNT_MSAT(1000);
+	memset(&destination, 1, sizeof(destination));
+	route_nodes[0] = destination;
+	memset(route_channels, 1, sizeof(*route_channels));
+
+	send_payment_core(ld, new_cmd(ld), &h, partid, groupid,
+			  &first_hop,
+			  AMOUNT_MSAT(1000),
+			  AMOUNT_MSAT(1000 * NUM_PARTS),
+			  NULL, NULL, NULL, NULL,
+			  &destination,
+			  route_nodes, route_channels,
+			  NULL, NULL);
+}
+
+/* HTLC is committed, so we store the payment */
+static void commit(struct lightningd *ld, u32 idx, u64 partid, u64 groupid)
+{
+	struct sha256 h = payment_hash(idx);
+
+	payment_store(ld, wallet_payment_by_hash(tmpctx, ld->wallet, &h,
+						 partid, groupid));
+}
+
+static void waitsendpay(struct lightningd *ld, u32 idx,
+			u64 partid, u64 groupid)
+{
+	struct sha256 h = payment_hash(idx);
+	struct command *cmd = new_cmd(ld);
+
+	if (!wait_payment(ld, cmd, &h, partid, groupid))
+		command_still_pending(cmd);
+}
+
+static struct htlc_out *find_hout(u32 idx, u64 partid, u64 groupid)
+{
+	struct sha256 h = payment_hash(idx);
+	struct wallet_payment *p = wallet_payment_by_hash(NULL, NULL, &h,
+							  partid, groupid);
+	/* Payment is allocated off the hout */
+	return tal_parent(p);
+}
+
+static void fail_part(struct lightningd *ld, u32 idx,
+		      u64 partid, u64 groupid)
+{
+	struct htlc_out *hout = find_hout(idx, partid, groupid);
+	u8 *failmsg = tal_arr(hout, u8, 0);
+
+	towire_u16(&failmsg, WIRE_TEMPORARY_CHANNEL_FAILURE);
+	hout->failmsg = failmsg;
+	payment_failed(ld, hout, "simulated failure");
+}
+
+static void succeed_part(struct lightningd *ld, u32 idx,
+			 u64 partid, u64 groupid)
+{
+	struct preimage preimage;
+
+	memset(&preimage, 0, sizeof(preimage));
+	payment_succeeded(ld, find_hout(idx, partid, groupid), &preimage);
+}
+
+/* Every payment sends NUM_PARTS parts, half fail and are retried with new
+ * partids, then everything succeeds. */
+static void run_payments(struct lightningd *ld)
+{
+	for (u32 i = 0; i < NUM_PAYMENTS; i++) {
+		for (u64 p = 1; p <= NUM_PARTS; p++) {
+			sendpay(ld, i, p, 1);
+			commit(ld, i, p, 1);
+			waitsendpay(ld, i, p, 1);
+		}
+		clean_tmpctx();
+	}
+	assert(num_succeeded == NUM_PAYMENTS * NUM_PARTS);
+	assert(num_pending == NUM_PAYMENTS * NUM_PARTS * 2);
+
+	for (u32 i = 0; i < NUM_PAYMENTS; i++) {
+		for (u64 p = 1; p <= NUM_PARTS / 2; p++)
+			fail_part(ld, i, p, 1);
+		clean_tmpctx();
+	}
+	assert(num_failed == NUM_PAYMENTS * NUM_PARTS / 2);
+
+	for (u32 i = 0; i < NUM_PAYMENTS; i++) {
+		for (u64 p = NUM_PARTS + 1; p <= NUM_PARTS * 3 / 2; p++) {
+			sendpay(ld, i, p, 1);
+			commit(ld, i, p, 1);
+			waitsendpay(ld, i, p, 1);
+		}
+		clean_tmpctx();
+	}
+
+	for (u32 i = 0; i < NUM_PAYMENTS; i++) {
+		for (u64 p = NUM_PARTS / 2 + 1; p <= NUM_PARTS * 3 / 2; p++)
+			succeed_part(ld, i, p, 1);
+		clean_tmpctx();
+	}
+	assert(num_failed == NUM_PAYMENTS * NUM_PARTS / 2);
+	assert(num_succeeded == NUM_PAYMENTS * NUM_PARTS * 5 / 2);
+}
+
+static void check_errors(struct lightningd *ld)
+{
+	size_t prev_failed, prev_succeeded;
+
+	/* While pending, another group is refused, as is mixing
+	 * non-parallel and parallel parts. */
+	sendpay(ld, 0, 1, 1);
+	prev_failed = num_failed;
+	sendpay(ld, 0, 2, 2);
+	assert(num_failed == prev_failed + 1);
+	assert(last_errcode == PAY_IN_PROGRESS);
+	sendpay(ld, 0, 0, 1);
+	assert(num_failed == prev_failed + 2);
+	assert(last_errcode == PAY_IN_PROGRESS);
+
+	/* Repeating a pending part just tells us it's in progress. */
+	commit(ld, 0, 1, 1);
+	prev_succeeded = num_succeeded;
+	sendpay(ld, 0, 1, 1);
+	assert(num_succeeded == prev_succeeded + 1);
+
+	/* Once one part succeeds, no more may be sent. */
+	succeed_part(ld, 0, 1, 1);
+	sendpay(ld, 0, 2, 1);
+	assert(num_failed == prev_failed + 3);
+	assert(last_errcode == PAY_RHASH_ALREADY_USED);
+
+	/* Nothing left in flight. */
+	assert(payment_parts_map_count(ld->payment_parts) == 0);
+}
+
+int main(int argc, char *argv[])
+{
+	struct lightningd *ld;
+
+	common_setup(argv[0]);
+
+	ld = talz(NULL, struct lightningd);
+	ld->waitsendpay_commands = tal(ld, struct sendpay_command_map);
+	sendpay_command_map_init(ld->waitsendpay_commands);
+	ld->sendpay_commands = tal(ld, struct sendpay_command_map);
+	sendpay_command_map_init(ld->sendpay_commands);
+	ld->payment_parts = tal(ld, struct payment_parts_map);
+	payment_parts_map_init(ld->payment_parts);
+
+	peer = talz(ld, struct peer);
+	channel = talz(ld, struct channel);
+	channel->peer = peer;
+	channel->state = CHANNELD_NORMAL;
+	for (size_t i = 0; i < NUM_PAYMENTS; i++)
+		payments[i] = tal_arr(ld, struct wallet_payment *, 0);
+
+	run_payments(ld);
+
+	/* Nobody left waiting, and nothing left in flight. */
+	assert(sendpay_command_map_count(ld->sendpay_commands) == 0);
+	assert(sendpay_command_map_count(ld->waitsendpay_commands) == 0);
+	assert(payment_parts_map_count(ld->payment_parts) == 0);
+
+	/* We only went to the db once per payment, and it was empty. */
+	assert(db_loads == NUM_PAYMENTS);
+	assert(db_rows_loaded == 0);
+
+	/* Start again with an empty db for this payment_hash. */
+	tal_free(payments[0]);
+	payments[0] = tal_arr(ld, struct wallet_payment *, 0);
+	check_errors(ld);
+
+	tal_free(ld);
+	common_shutdown();
+}
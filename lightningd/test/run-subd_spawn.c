@@ -0,0 +1,180 @@
+#include "config.h"
+#include "../subd.c"
+#include <common/json_stream.h>
+#include <common/setup.h>
+#include <stdio.h>
+
+/* AUTOGENERATED MOCKS START */
+/* Generated stub for db_begin_transaction_ */
+void db_begin_transaction_(struct db *db UNNEEDED, const char *location UNNEEDED)
+{ fprintf(stderr, "db_begin_transaction_ called!\n"); abort(); }
+/* Generated stub for db_commit_transaction */
+void db_commit_transaction(struct db *db UNNEEDED)
+{ fprintf(stderr, "db_commit_transaction called!\n"); abort(); }
+/* Generated stub for db_in_transaction */
+bool db_in_transaction(struct db *db UNNEEDED)
+{ fprintf(stderr, "db_in_transaction called!\n"); abort(); }
+/* Generated stub for fatal */
+void   fatal(const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "fatal called!\n"); abort(); }
+/* Generated stub for fromwire_bigsize */
+bigsize_t fromwire_bigsize(const u8 **cursor UNNEEDED, size_t *max UNNEEDED)
+{ fprintf(stderr, "fromwire_bigsize called!\n"); abort(); }
+/* Generated stub for fromwire_channel_id */
+bool fromwire_channel_id(const u8 **cursor UNNEEDED, size_t *max UNNEEDED,
+			 struct channel_id *channel_id UNNEEDED)
+{ fprintf(stderr, "fromwire_channel_id called!\n"); abort(); }
+/* Generated stub for fromwire_node_id */
+void fromwire_node_id(const u8 **cursor UNNEEDED, size_t *max UNNEEDED, struct node_id *id UNNEEDED)
+{ fprintf(stderr, "fromwire_node_id called!\n"); abort(); }
+/* Generated stub for fromwire_status_fail */
+bool fromwire_status_fail(const tal_t *ctx UNNEEDED, const void *p UNNEEDED, enum status_failreason *failreason UNNEEDED, wirestring **desc UNNEEDED)
+{ fprintf(stderr, "fromwire_status_fail called!\n"); abort(); }
+/* Generated stub for fromwire_status_peer_billboard */
+bool fromwire_status_peer_billboard(const tal_t *ctx UNNEEDED, const void *p UNNEEDED, bool *perm UNNEEDED, wirestring **happenings UNNEEDED)
+{ fprintf(stderr, "fromwire_status_peer_billboard called!\n"); abort(); }
+/* Generated stub for fromwire_status_peer_error */
+bool fromwire_status_peer_error(const tal_t *ctx UNNEEDED, const void *p UNNEEDED, struct channel_id *channel UNNEEDED, wirestring **desc UNNEEDED, bool *warning UNNEEDED, u8 **error_for_them UNNEEDED)
+{ fprintf(stderr, "fromwire_status_peer_error called!\n"); abort(); }
+/* Generated stub for fromwire_status_version */
+bool fromwire_status_version(const tal_t *ctx UNNEEDED, const void *p UNNEEDED, wirestring **version UNNEEDED)
+{ fprintf(stderr, "fromwire_status_version called!\n"); abort(); }
+/* Generated stub for log_ */
+void log_(struct log *log UNNEEDED, enum log_level level UNNEEDED,
+	  const struct node_id *node_id UNNEEDED,
+	  bool call_notifier UNNEEDED,
+	  const char *fmt UNNEEDED, ...)
+
+{ fprintf(stderr, "log_ called!\n"); abort(); }
+/* Generated stub for log_filter_subdaemons */
+bool log_filter_subdaemons(const struct log *log UNNEEDED)
+{ fprintf(stderr, "log_filter_subdaemons called!\n"); abort(); }
+/* Generated stub for log_prefix */
+const char *log_prefix(const struct log *log UNNEEDED)
+{ fprintf(stderr, "log_prefix called!\n"); abort(); }
+/* Generated stub for log_print_level */
+enum log_level log_print_level(struct log *log UNNEEDED, const struct node_id *node_id UNNEEDED)
+{ fprintf(stderr, "log_print_level called!\n"); abort(); }
+/* Generated stub for log_print_level_any */
+enum log_level log_print_level_any(struct log *log UNNEEDED)
+{ fprintf(stderr, "log_print_level_any called!\n"); abort(); }
+/* Generated stub for log_status_msg */
+bool log_status_msg(struct log *log UNNEEDED,
+ 		    const struct node_id *node_id UNNEEDED,
+		    const u8 *msg UNNEEDED)
+{ fprintf(stderr, "log_status_msg called!\n"); abort(); }
+/* Generated stub for new_log */
+struct log *new_log(const tal_t *ctx UNNEEDED, struct log_book *record UNNEEDED,
+		    const struct node_id *default_node_id UNNEEDED,
+		    const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "new_log called!\n"); abort(); }
+/* Generated stub for new_peer_fd_arr */
+struct peer_fd *new_peer_fd_arr(const tal_t *ctx UNNEEDED, const int *fd UNNEEDED)
+{ fprintf(stderr, "new_peer_fd_arr called!\n"); abort(); }
+/* Generated stub for subdaemon_path */
+const char *subdaemon_path(const tal_t *ctx UNNEEDED, const struct lightningd *ld UNNEEDED, const char *name UNNEEDED)
+{ fprintf(stderr, "subdaemon_path called!\n"); abort(); }
+/* Generated stub for towire_bigsize */
+void towire_bigsize(u8 **pptr UNNEEDED, const bigsize_t val UNNEEDED)
+{ fprintf(stderr, "towire_bigsize called!\n"); abort(); }
+/* Generated stub for towire_channel_id */
+void towire_channel_id(u8 **pptr UNNEEDED, const struct channel_id *channel_id UNNEEDED)
+{ fprintf(stderr, "towire_channel_id called!\n"); abort(); }
+/* Generated stub for towire_node_id */
+void towire_node_id(u8 **pptr UNNEEDED, const struct node_id *id UNNEEDED)
+{ fprintf(stderr, "towire_node_id called!\n"); abort(); }
+/* Generated stub for version */
+const char *version(void)
+{ fprintf(stderr, "version called!\n"); abort(); }
+/* AUTOGENERATED MOCKS END */
+
+/* Spawned children (we run ourselves) report on what they were given. */
+#define CHILD_OK 'Y'
+#define CHILD_BAD 'N'
+
+/* An fd we hold open, which no child should inherit. */
+#define LEAKFD 20
+
+/* We're the "subdaemon": our msg fd is stdin, the extra fd is 3, and
+ * nothing else of our parent's should have leaked through. */
+static int child_main(void)
+{
+	char result = CHILD_OK;
+
+	if (fcntl(STDIN_FILENO, F_GETFD) < 0 || fcntl(3, F_GETFD) < 0)
+		result = CHILD_BAD;
+	/* 4 was the exec-failure pipe (CLOEXEC). */
+	for (int fd = 4; fd <= LEAKFD; fd++) {
+		if (fcntl(fd, F_GETFD) >= 0)
+			result = CHILD_BAD;
+	}
+	if (write(3, &result, 1) != 1)
+		return 1;
+	return 0;
+}
+
+static pid_t spawn(const char *path, int *msgfd, ...)
+{
+	va_list ap;
+	pid_t pid;
+
+	va_start(ap, msgfd);
+	pid = subd(path, "test", NULL, msgfd, LOG_IO_OUT, &ap);
+	va_end(ap);
+	return pid;
+}
+
+/* Each child gets what it should, and nothing else. */
+static void spawn_children(const char *path, size_t num)
+{
+	pid_t pids[num];
+	int reports[num];
+
+	for (size_t i = 0; i < num; i++) {
+		int childfds[2], msgfd, *extrafd;
+
+		if (socketpair(AF_LOCAL, SOCK_STREAM, 0, childfds) != 0)
+			abort();
+		extrafd = tal_dup(tmpctx, int, &childfds[1]);
+		pids[i] = spawn(path, &msgfd, take(extrafd), NULL);
+		assert(pids[i] > 0);
+		close(msgfd);
+		reports[i] = childfds[0];
+	}
+
+	for (size_t i = 0; i < num; i++) {
+		char result;
+		int status;
+
+		assert(read(reports[i], &result, 1) == 1);
+		assert(result == CHILD_OK);
+		close(reports[i]);
+		assert(waitpid(pids[i], &status, 0) == pids[i]);
+		assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	int msgfd, leakfd;
+
+	/* subd() hands our children --log-io */
+	if (argc > 1)
+		return child_main();
+
+	common_setup(argv[0]);
+
+	/* This must not make it into any child. */
+	leakfd = fcntl(STDERR_FILENO, F_DUPFD, LEAKFD);
+	assert(leakfd == LEAKFD);
+
+	/* Exec failure is reported, not swallowed. */
+	errno = 0;
+	assert(spawn("/nonexistent/lightning_channeld", &msgfd, NULL) == -1);
+	assert(errno == ENOENT);
+
+	spawn_children(argv[0], 10);
+
+	close(leakfd);
+	common_shutdown();
+}
@@ -804,10 +804,18 @@ static const struct plugin_notification notifs[] = {
 	}
 };
 
+static const u64 peer_storage_types[] = {
+	WIRE_PEER_STORAGE,
+	WIRE_YOUR_PEER_STORAGE,
+};
+
 static const struct plugin_hook hooks[] = {
         {
                 "custommsg",
                 handle_your_peer_storage,
+		NULL, NULL,
+		peer_storage_types,
+		ARRAY_SIZE(peer_storage_types),
         },
 	{
 		"peer_connected",
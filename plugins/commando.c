@@ -776,10 +776,20 @@ static struct command_result *handle_custommsg(struct command *cmd,
 	return command_hook_success(cmd);
 }
 
+static const u64 commando_msg_types[] = {
+	COMMANDO_MSG_CMD_CONTINUES,
+	COMMANDO_MSG_CMD_TERM,
+	COMMANDO_MSG_REPLY_CONTINUES,
+	COMMANDO_MSG_REPLY_TERM,
+};
+
 static const struct plugin_hook hooks[] = {
 	{
 		"custommsg",
-		handle_custommsg
+		handle_custommsg,
+		NULL, NULL,
+		commando_msg_types,
+		ARRAY_SIZE(commando_msg_types),
 	},
 };
 
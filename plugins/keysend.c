@@ -595,10 +595,27 @@ static struct command_result *htlc_accepted_call(struct command *cmd,
 	return send_outreq(cmd->plugin, req);
 }
 
+/* We only care about HTLCs carrying a keysend preimage. */
+static const u64 keysend_filters[] = { PREIMAGE_TLV_TYPE };
+
 static const struct plugin_hook hooks[] = {
 	{
 		"htlc_accepted",
-		htlc_accepted_call
+		htlc_accepted_call,
+		NULL, NULL,
+		keysend_filters,
+		ARRAY_SIZE(keysend_filters),
+	},
+};
+
+static const struct plugin_notification notifs[] = {
+	{
+		"sendpay_success",
+		handle_sendpay_success,
+	},
+	{
+		"sendpay_failure",
+		handle_sendpay_failure,
 	},
 };
 
@@ -617,6 +634,8 @@ int main(int argc, char *argv[])
 	set_feature_bit(&features->bits[NODE_ANNOUNCE_FEATURE], KEYSEND_FEATUREBIT);
 
 	plugin_main(argv, init, PLUGIN_STATIC, true, features, commands,
-		    ARRAY_SIZE(commands), NULL, 0, hooks, ARRAY_SIZE(hooks),
+		    ARRAY_SIZE(commands),
+		    notifs, ARRAY_SIZE(notifs),
+		    hooks, ARRAY_SIZE(hooks),
 		    notification_topics, ARRAY_SIZE(notification_topics), NULL);
 }
@@ -1,5 +1,8 @@
 #include "config.h"
 #include <ccan/array_size/array_size.h>
+#include <ccan/crypto/siphash24/siphash24.h>
+#include <ccan/htable/htable_type.h>
+#include <ccan/ilog/ilog.h>
 #include <ccan/tal/str/str.h>
 #include <common/blindedpay.h>
 #include <common/dijkstra.h>
@@ -8,6 +11,7 @@
 #include <common/memleak.h>
 #include <common/pseudorand.h>
 #include <common/random_select.h>
+#include <common/sphinx.h>
 #include <common/type_to_string.h>
 #include <errno.h>
 #include <math.h>
@@ -17,6 +21,72 @@
 
 static struct gossmap *global_gossmap;
 
+static const struct short_channel_id_dir *
+channel_hint_scidd(const struct channel_hint *hint)
+{
+	return &hint->scid;
+}
+
+static size_t scidd_hash(const struct short_channel_id_dir *scidd)
+{
+	struct siphash24_ctx ctx;
+	siphash24_init(&ctx, siphash_seed());
+	siphash24_u64(&ctx, scidd->scid.u64);
+	siphash24_u8(&ctx, scidd->dir);
+	return siphash24_done(&ctx);
+}
+
+static bool channel_hint_eq(const struct channel_hint *hint,
+			    const struct short_channel_id_dir *scidd)
+{
+	return short_channel_id_eq(&hint->scid.scid, &scidd->scid)
+		&& hint->scid.dir == scidd->dir;
+}
+
+HTABLE_DEFINE_TYPE(struct channel_hint, channel_hint_scidd, scidd_hash,
+		   channel_hint_eq, channel_hint_map);
+
+HTABLE_DEFINE_TYPE(struct node_id, node_id_keyof, node_id_hash, node_id_eq,
+		   excluded_node_map);
+
+/* A part we've handed to sendonion: lightningd tells us how it went with a
+ * sendpay_success or sendpay_failure notification. */
+struct inflight_part {
+	struct sha256 payment_hash;
+	u64 groupid;
+	u32 partid;
+	struct payment *p;
+};
+
+static const struct inflight_part *
+inflight_part_keyof(const struct inflight_part *part)
+{
+	return part;
+}
+
+static size_t inflight_part_hash(const struct inflight_part *key)
+{
+	struct siphash24_ctx ctx;
+	siphash24_init(&ctx, siphash_seed());
+	siphash24_update(&ctx, &key->payment_hash, sizeof(key->payment_hash));
+	siphash24_u64(&ctx, key->groupid);
+	siphash24_u32(&ctx, key->partid);
+	return siphash24_done(&ctx);
+}
+
+static bool inflight_part_eq(const struct inflight_part *part,
+			     const struct inflight_part *key)
+{
+	return sha256_eq(&part->payment_hash, &key->payment_hash)
+		&& part->groupid == key->groupid
+		&& part->partid == key->partid;
+}
+
+HTABLE_DEFINE_TYPE(struct inflight_part, inflight_part_keyof,
+		   inflight_part_hash, inflight_part_eq, inflight_part_map);
+
+static struct inflight_part_map *inflight_parts;
+
 static void init_gossmap(struct plugin *plugin)
 {
 	size_t num_channel_updates_rejected;
@@ -101,8 +171,10 @@ struct payment *payment_new(tal_t *ctx, struct command *cmd,
 		p->partid = 0;
 		p->next_partid = 1;
 		p->plugin = cmd->plugin;
-		p->channel_hints = tal_arr(p, struct channel_hint, 0);
-		p->excluded_nodes = tal_arr(p, struct node_id, 0);
+		p->channel_hints = tal(p, struct channel_hint_map);
+		channel_hint_map_init(p->channel_hints);
+		p->excluded_nodes = tal(p, struct excluded_node_map);
+		excluded_node_map_init(p->excluded_nodes);
 		p->id = next_id++;
 		p->description = NULL;
 		/* Caller must set this.  */
@@ -327,74 +399,74 @@ static void channel_hints_update(struct payment *p,
 				 u16 *htlc_budget)
 {
 	struct payment *root = payment_root(p);
-	struct channel_hint newhint;
+	struct channel_hint *hint, *newhint;
+	struct short_channel_id_dir scidd;
 
 	/* If the channel is marked as enabled it must have an estimate. */
 	assert(!enabled || estimated_capacity != NULL);
 
 	/* Try and look for an existing hint: */
-	for (size_t i=0; i<tal_count(root->channel_hints); i++) {
-		struct channel_hint *hint = &root->channel_hints[i];
-		if (short_channel_id_eq(&hint->scid.scid, &scid) &&
-		    hint->scid.dir == direction) {
-			bool modified = false;
-			/* Prefer to disable a channel. */
-			if (!enabled && hint->enabled) {
-				hint->enabled = false;
-				modified = true;
-			}
-
-			/* Prefer the more conservative estimate. */
-			if (estimated_capacity != NULL &&
-			    amount_msat_greater(hint->estimated_capacity,
-						*estimated_capacity)) {
-				hint->estimated_capacity = *estimated_capacity;
-				modified = true;
-			}
-			if (htlc_budget != NULL) {
-				assert(hint->local);
-				hint->local->htlc_budget = *htlc_budget;
-				modified = true;
-			}
+	scidd.scid = scid;
+	scidd.dir = direction;
+	hint = channel_hint_map_get(root->channel_hints, &scidd);
+	if (hint) {
+		bool modified = false;
+		/* Prefer to disable a channel. */
+		if (!enabled && hint->enabled) {
+			hint->enabled = false;
+			modified = true;
+		}
 
-			if (modified)
-				paymod_log(p, LOG_DBG,
-					   "Updated a channel hint for %s: "
-					   "enabled %s, "
-					   "estimated capacity %s",
-					   type_to_string(tmpctx,
-						struct short_channel_id_dir,
-						&hint->scid),
-					   hint->enabled ? "true" : "false",
-					   type_to_string(tmpctx,
-						struct amount_msat,
-						&hint->estimated_capacity));
-			return;
+		/* Prefer the more conservative estimate. */
+		if (estimated_capacity != NULL &&
+		    amount_msat_greater(hint->estimated_capacity,
+					*estimated_capacity)) {
+			hint->estimated_capacity = *estimated_capacity;
+			modified = true;
 		}
+		if (htlc_budget != NULL) {
+			assert(hint->local);
+			hint->local->htlc_budget = *htlc_budget;
+			modified = true;
+		}
+
+		if (modified)
+			paymod_log(p, LOG_DBG,
+				   "Updated a channel hint for %s: "
+				   "enabled %s, "
+				   "estimated capacity %s",
+				   type_to_string(tmpctx,
+					struct short_channel_id_dir,
+					&hint->scid),
+				   hint->enabled ? "true" : "false",
+				   type_to_string(tmpctx,
+					struct amount_msat,
+					&hint->estimated_capacity));
+		return;
 	}
 
 	/* No hint found, create one. */
-	newhint.enabled = enabled;
-	newhint.scid.scid = scid;
-	newhint.scid.dir = direction;
+	newhint = tal(root->channel_hints, struct channel_hint);
+	newhint->enabled = enabled;
+	newhint->scid = scidd;
 	if (local) {
-		newhint.local = tal(root->channel_hints, struct local_hint);
+		newhint->local = tal(newhint, struct local_hint);
 		assert(htlc_budget);
-		newhint.local->htlc_budget = *htlc_budget;
+		newhint->local->htlc_budget = *htlc_budget;
 	} else
-		newhint.local = NULL;
+		newhint->local = NULL;
 	if (estimated_capacity != NULL)
-		newhint.estimated_capacity = *estimated_capacity;
+		newhint->estimated_capacity = *estimated_capacity;
 
-	tal_arr_expand(&root->channel_hints, newhint);
+	channel_hint_map_add(root->channel_hints, newhint);
 
 	paymod_log(
 	    p, LOG_DBG,
 	    "Added a channel hint for %s: enabled %s, estimated capacity %s",
-	    type_to_string(tmpctx, struct short_channel_id_dir, &newhint.scid),
-	    newhint.enabled ? "true" : "false",
+	    type_to_string(tmpctx, struct short_channel_id_dir, &newhint->scid),
+	    newhint->enabled ? "true" : "false",
 	    type_to_string(tmpctx, struct amount_msat,
-			   &newhint.estimated_capacity));
+			   &newhint->estimated_capacity));
 }
 
 static void payment_exclude_most_expensive(struct payment *p)
@@ -470,15 +542,11 @@ static struct channel_hint *payment_chanhints_get(struct payment *p,
 						  struct route_hop *h)
 {
 	struct payment *root = payment_root(p);
-	struct channel_hint *curhint;
-	for (size_t j = 0; j < tal_count(root->channel_hints); j++) {
-		curhint = &root->channel_hints[j];
-		if (short_channel_id_eq(&curhint->scid.scid, &h->scid) &&
-		    curhint->scid.dir == h->direction) {
-			return curhint;
-		}
-	}
-	return NULL;
+	struct short_channel_id_dir scidd;
+
+	scidd.scid = h->scid;
+	scidd.dir = h->direction;
+	return channel_hint_map_get(root->channel_hints, &scidd);
 }
 
 /* Given a route and a couple of channel hints, apply the route to the channel
@@ -595,11 +663,12 @@ payment_get_excluded_channels(const tal_t *ctx, struct payment *p)
 {
 	struct payment *root = payment_root(p);
 	struct channel_hint *hint;
+	struct channel_hint_map_iter it;
 	struct short_channel_id_dir *res =
 	    tal_arr(ctx, struct short_channel_id_dir, 0);
-	for (size_t i = 0; i < tal_count(root->channel_hints); i++) {
-		hint = &root->channel_hints[i];
-
+	for (hint = channel_hint_map_first(root->channel_hints, &it);
+	     hint;
+	     hint = channel_hint_map_next(root->channel_hints, &it)) {
 		if (!hint->enabled)
 			tal_arr_expand(&res, hint->scid);
 
@@ -615,42 +684,45 @@ payment_get_excluded_channels(const tal_t *ctx, struct payment *p)
 	return res;
 }
 
-static const struct node_id *payment_get_excluded_nodes(const tal_t *ctx,
-						  struct payment *p)
+static bool node_is_excluded(struct payment *p, const struct node_id *id)
 {
-	struct payment *root = payment_root(p);
-	return root->excluded_nodes;
+	return excluded_node_map_get(payment_root(p)->excluded_nodes, id)
+		!= NULL;
 }
 
-/* FIXME: This is slow! */
-static const struct channel_hint *find_hint(const struct channel_hint *hints,
-					    const struct short_channel_id *scid,
-					    int dir)
+/* Remember not to route through this node again. */
+static void payment_exclude_node(struct payment *p, const struct node_id *id)
 {
-	for (size_t i = 0; i < tal_count(hints); i++) {
-		if (short_channel_id_eq(scid, &hints[i].scid.scid)
-		    && dir == hints[i].scid.dir)
-			return &hints[i];
-	}
-	return NULL;
+	struct payment *root = payment_root(p);
+
+	if (node_is_excluded(root, id))
+		return;
+	excluded_node_map_add(root->excluded_nodes,
+			      tal_dup(root->excluded_nodes, struct node_id, id));
 }
 
-/* FIXME: This is slow! */
 static bool dst_is_excluded(const struct gossmap *gossmap,
 			    const struct gossmap_chan *c,
 			    int dir,
-			    const struct node_id *nodes)
+			    struct payment *p)
 {
 	struct node_id dstid;
+	size_t num_excluded;
 
 	/* Premature optimization */
-	if (!tal_count(nodes))
+	num_excluded = excluded_node_map_count(payment_root(p)->excluded_nodes)
+		+ tal_count(p->temp_exclusion);
+	if (!num_excluded)
 		return false;
 
 	gossmap_node_get_id(gossmap, gossmap_nth_node(gossmap, c, !dir),
 			    &dstid);
-	for (size_t i = 0; i < tal_count(nodes); i++) {
-		if (node_id_eq(&dstid, &nodes[i]))
+	if (node_is_excluded(p, &dstid))
+		return true;
+
+	/* This is just the current routehint, so it's short. */
+	for (size_t i = 0; i < tal_count(p->temp_exclusion); i++) {
+		if (node_id_eq(&dstid, &p->temp_exclusion[i]))
 			return true;
 	}
 	return false;
@@ -662,17 +734,15 @@ static bool payment_route_check(const struct gossmap *gossmap,
 				struct amount_msat amount,
 				struct payment *p)
 {
-	struct short_channel_id scid;
+	struct short_channel_id_dir scidd;
 	const struct channel_hint *hint;
 
-	if (dst_is_excluded(gossmap, c, dir, payment_root(p)->excluded_nodes))
-		return false;
-
-	if (dst_is_excluded(gossmap, c, dir, p->temp_exclusion))
+	if (dst_is_excluded(gossmap, c, dir, p))
 		return false;
 
-	scid = gossmap_chan_scid(gossmap, c);
-	hint = find_hint(payment_root(p)->channel_hints, &scid, dir);
+	scidd.scid = gossmap_chan_scid(gossmap, c);
+	scidd.dir = dir;
+	hint = channel_hint_map_get(payment_root(p)->channel_hints, &scidd);
 	if (!hint)
 		return true;
 
@@ -759,6 +829,231 @@ static u64 route_score(u32 distance,
 	return costs;
 }
 
+/* Exchanges, LSPs and the like pay the same destinations over and over:
+ * remember the route we found last time, per destination and amount
+ * magnitude, and try it before running dijkstra again. */
+#define ROUTE_CACHE_MAX 1024
+
+struct route_cache_key {
+	struct node_id dst;
+	/* ilog64 of the amount */
+	u8 amount_bucket;
+};
+
+struct cached_hop {
+	struct short_channel_id_dir scidd;
+	/* The channel_update we found it with: if that changes, we search
+	 * again. */
+	u32 base_fee, proportional_fee, delay;
+};
+
+struct cached_route {
+	/* In route_cache_lru, most recently used first. */
+	struct list_node list;
+	struct route_cache_key key;
+	/* What else route() was asked for */
+	double riskfactor;
+	size_t max_hops;
+	struct cached_hop *hops;
+};
+
+static const struct route_cache_key *
+cached_route_keyof(const struct cached_route *r)
+{
+	return &r->key;
+}
+
+static size_t route_cache_key_hash(const struct route_cache_key *key)
+{
+	struct siphash24_ctx ctx;
+	siphash24_init(&ctx, siphash_seed());
+	siphash24_update(&ctx, key->dst.k, sizeof(key->dst.k));
+	siphash24_u8(&ctx, key->amount_bucket);
+	return siphash24_done(&ctx);
+}
+
+static bool cached_route_eq(const struct cached_route *r,
+			    const struct route_cache_key *key)
+{
+	return node_id_eq(&r->key.dst, &key->dst)
+		&& r->key.amount_bucket == key->amount_bucket;
+}
+
+HTABLE_DEFINE_TYPE(struct cached_route, cached_route_keyof,
+		   route_cache_key_hash, cached_route_eq, route_cache_map);
+
+static struct route_cache_map *route_cache;
+static struct list_head route_cache_lru;
+static size_t route_cache_num, route_cache_max = ROUTE_CACHE_MAX;
+
+static void route_cache_key_init(struct route_cache_key *key,
+				 const struct gossmap *gossmap,
+				 const struct gossmap_node *dst,
+				 struct amount_msat amount)
+{
+	gossmap_node_get_id(gossmap, dst, &key->dst);
+	key->amount_bucket = ilog64(amount.millisatoshis); /* Raw: bucket */
+}
+
+static void route_cache_del(struct cached_route *r)
+{
+	route_cache_map_del(route_cache, r);
+	list_del_from(&route_cache_lru, &r->list);
+	route_cache_num--;
+	tal_free(r);
+}
+
+/* A failure on this channel means no other payment should use it
+ * blindly, either. */
+static void route_cache_forget_chan(const struct short_channel_id *scid,
+				    int dir)
+{
+	struct cached_route *r, *next;
+
+	if (!route_cache)
+		return;
+
+	list_for_each_safe(&route_cache_lru, r, next, list) {
+		for (size_t i = 0; i < tal_count(r->hops); i++) {
+			if (short_channel_id_eq(&r->hops[i].scidd.scid, scid)
+			    && r->hops[i].scidd.dir == dir) {
+				route_cache_del(r);
+				break;
+			}
+		}
+	}
+}
+
+static void route_cache_add(const struct gossmap *gossmap,
+			    const struct gossmap_node *dst,
+			    struct amount_msat amount,
+			    double riskfactor,
+			    size_t max_hops,
+			    const struct route_hop *route)
+{
+	struct route_cache_key key;
+	struct cached_route *r;
+
+	if (route_cache_max == 0)
+		return;
+
+	if (!route_cache) {
+		route_cache = notleak_with_children(tal(NULL,
+							struct route_cache_map));
+		route_cache_map_init(route_cache);
+		list_head_init(&route_cache_lru);
+	}
+
+	route_cache_key_init(&key, gossmap, dst, amount);
+	r = route_cache_map_get(route_cache, &key);
+	if (r)
+		route_cache_del(r);
+
+	r = tal(route_cache, struct cached_route);
+	r->key = key;
+	r->riskfactor = riskfactor;
+	r->max_hops = max_hops;
+	r->hops = tal_arr(r, struct cached_hop, tal_count(route));
+	for (size_t i = 0; i < tal_count(route); i++) {
+		const struct gossmap_chan *c;
+		const struct half_chan *h;
+
+		c = gossmap_find_chan(gossmap, &route[i].scid);
+		h = &c->half[route[i].direction];
+		r->hops[i].scidd.scid = route[i].scid;
+		r->hops[i].scidd.dir = route[i].direction;
+		r->hops[i].base_fee = h->base_fee;
+		r->hops[i].proportional_fee = h->proportional_fee;
+		r->hops[i].delay = h->delay;
+	}
+	route_cache_map_add(route_cache, r);
+	list_add(&route_cache_lru, &r->list);
+
+	route_cache_num++;
+	while (route_cache_num > route_cache_max)
+		route_cache_del(list_tail(&route_cache_lru,
+					  struct cached_route, list));
+}
+
+/* Rebuild the cached route for this amount, as route_from_dijkstra
+ * would, if every channel is unchanged and can still carry it. */
+static struct route_hop *route_cache_get(const tal_t *ctx,
+					 const struct gossmap *gossmap,
+					 const struct gossmap_node *src,
+					 const struct gossmap_node *dst,
+					 struct amount_msat amount,
+					 u32 final_delay,
+					 double riskfactor,
+					 size_t max_hops,
+					 struct payment *p)
+{
+	struct route_cache_key key;
+	struct cached_route *r;
+	struct route_hop *hops;
+	const struct gossmap_chan **chans;
+	u32 nodeidx;
+
+	if (!route_cache)
+		return NULL;
+
+	route_cache_key_init(&key, gossmap, dst, amount);
+	r = route_cache_map_get(route_cache, &key);
+	if (!r || r->riskfactor != riskfactor || r->max_hops != max_hops)
+		return NULL;
+
+	/* Is it still a path from src to dst, priced as it was? */
+	chans = tal_arr(tmpctx, const struct gossmap_chan *, tal_count(r->hops));
+	nodeidx = gossmap_node_idx(gossmap, src);
+	for (size_t i = 0; i < tal_count(r->hops); i++) {
+		const struct cached_hop *ch = &r->hops[i];
+		const struct half_chan *h;
+
+		chans[i] = gossmap_find_chan(gossmap, &ch->scidd.scid);
+		if (!chans[i] || !gossmap_chan_set(chans[i], ch->scidd.dir))
+			goto stale;
+		h = &chans[i]->half[ch->scidd.dir];
+		if (h->nodeidx != nodeidx
+		    || h->base_fee != ch->base_fee
+		    || h->proportional_fee != ch->proportional_fee
+		    || h->delay != ch->delay)
+			goto stale;
+		nodeidx = chans[i]->half[!ch->scidd.dir].nodeidx;
+	}
+	if (nodeidx != gossmap_node_idx(gossmap, dst))
+		goto stale;
+
+	hops = tal_arr(ctx, struct route_hop, tal_count(r->hops));
+	for (size_t i = tal_count(hops); i-- > 0;) {
+		const struct half_chan *h = &chans[i]->half[r->hops[i].scidd.dir];
+
+		/* Not stale, but no good for this payment. */
+		if (!payment_route_can_carry(gossmap, chans[i],
+					     r->hops[i].scidd.dir, amount, p))
+			return tal_free(hops);
+
+		hops[i].scid = r->hops[i].scidd.scid;
+		hops[i].direction = r->hops[i].scidd.dir;
+		gossmap_node_get_id(gossmap,
+				    gossmap_nth_node(gossmap, chans[i],
+						     !hops[i].direction),
+				    &hops[i].node_id);
+		hops[i].amount = amount;
+		hops[i].delay = final_delay;
+		if (!amount_msat_add_fee(&amount, h->base_fee,
+					 h->proportional_fee))
+			return tal_free(hops);
+		final_delay += h->delay;
+	}
+
+	list_del_from(&route_cache_lru, &r->list);
+	list_add(&route_cache_lru, &r->list);
+	return hops;
+
+stale:
+	route_cache_del(r);
+	return NULL;
+}
+
 static struct route_hop *route(const tal_t *ctx,
 			       struct gossmap *gossmap,
 			       const struct gossmap_node *src,
@@ -778,6 +1073,11 @@ static struct route_hop *route(const tal_t *ctx,
 			  struct amount_msat,
 			  struct payment *);
 
+	r = route_cache_get(ctx, gossmap, src, dst, amount, final_delay,
+			    riskfactor, max_hops, p);
+	if (r)
+		return r;
+
 	can_carry = payment_route_can_carry;
 	dij = dijkstra(tmpctx, gossmap, dst, amount, riskfactor,
 		       can_carry, route_score, p);
@@ -817,6 +1117,9 @@ static struct route_hop *route(const tal_t *ctx,
 		}
 	}
 
+	/* A route over disabled channels won't pass route_cache_get() */
+	if (can_carry == payment_route_can_carry)
+		route_cache_add(gossmap, dst, amount, riskfactor, max_hops, r);
 	return r;
 }
 
@@ -1302,6 +1605,7 @@ handle_intermediate_failure(struct command *cmd,
 		channel_hints_update(root, errchan->scid,
 				     errchan->direction, false, false, NULL,
 				     NULL);
+		route_cache_forget_chan(&errchan->scid, errchan->direction);
 		break;
 
 	case WIRE_TEMPORARY_CHANNEL_FAILURE: {
@@ -1319,6 +1623,7 @@ handle_intermediate_failure(struct command *cmd,
 		channel_hints_update(root, errchan->scid,
 				     errchan->direction, true, false,
 				     &estimated, NULL);
+		route_cache_forget_chan(&errchan->scid, errchan->direction);
 		goto error;
 	}
 
@@ -1335,7 +1640,7 @@ handle_intermediate_failure(struct command *cmd,
 	case WIRE_INVALID_ONION_PAYLOAD:
 	case WIRE_INVALID_REALM:
 	case WIRE_INVALID_ONION_BLINDING:
-		tal_arr_expand(&root->excluded_nodes, *errnode);
+		payment_exclude_node(root, errnode);
 		goto error;
 
 	case WIRE_AMOUNT_BELOW_MINIMUM:
@@ -1462,7 +1767,7 @@ payment_addgossip_success(struct command *cmd, const char *buffer,
 
 	if (!assign_blame(p, &errnode, &errchan)) {
 		paymod_log(p, LOG_UNUSUAL,
-			   "No erring_index set in `waitsendpay` result: %.*s",
+			   "No erring_index set in sendpay result: %.*s",
 			   json_tok_full_len(toks),
 			   json_tok_full(buffer, toks));
 		/* FIXME: Pick a random channel to fail? */
@@ -1492,8 +1797,8 @@ payment_addgossip_failure(struct command *cmd, const char *buffer,
 }
 
 static struct command_result *
-payment_waitsendpay_finished(struct command *cmd, const char *buffer,
-			     const jsmntok_t *toks, struct payment *p)
+payment_sendpay_finished(struct command *cmd, const char *buffer,
+			 const jsmntok_t *toks, struct payment *p)
 {
 	u8 *update;
 
@@ -1504,7 +1809,7 @@ payment_waitsendpay_finished(struct command *cmd, const char *buffer,
 
 	if (p->result == NULL) {
 		paymod_log(p, LOG_UNUSUAL,
-			   "Unable to parse `waitsendpay` result: %.*s",
+			   "Unable to parse sendpay result: %.*s",
 			   json_tok_full_len(toks),
 			   json_tok_full(buffer, toks));
 		payment_set_step(p, PAYMENT_STEP_FAILED);
@@ -1541,38 +1846,144 @@ payment_waitsendpay_finished(struct command *cmd, const char *buffer,
 	return payment_addgossip_success(cmd, NULL, NULL, p);
 }
 
+static void destroy_inflight_part(struct inflight_part *part)
+{
+	inflight_part_map_del(inflight_parts, part);
+}
+
+static struct inflight_part *inflight_part_find(const struct sha256 *payment_hash,
+						u64 groupid, u32 partid)
+{
+	struct inflight_part key;
+
+	if (!inflight_parts)
+		return NULL;
+	key.payment_hash = *payment_hash;
+	key.groupid = groupid;
+	key.partid = partid;
+	return inflight_part_map_get(inflight_parts, &key);
+}
+
+/* Register before we send, since the notification can beat the reply. */
+static void inflight_part_add(struct payment *p)
+{
+	struct inflight_part *part = tal(p, struct inflight_part);
+
+	if (!inflight_parts) {
+		inflight_parts = notleak_with_children(tal(NULL,
+							   struct inflight_part_map));
+		inflight_part_map_init(inflight_parts);
+	}
+
+	part->payment_hash = *p->payment_hash;
+	part->groupid = p->groupid;
+	part->partid = p->partid;
+	part->p = p;
+	inflight_part_map_add(inflight_parts, part);
+	tal_add_destructor(part, destroy_inflight_part);
+}
+
+static struct command_result *sendpay_notification(struct command *cmd,
+						   const char *buf,
+						   const jsmntok_t *params,
+						   const char *name)
+{
+	const jsmntok_t *obj, *fields, *hashtok, *groupidtok, *partidtok;
+	struct inflight_part *part;
+	struct sha256 payment_hash;
+	u64 groupid;
+	u32 partid;
+	struct payment *p;
+
+	obj = json_get_member(buf, params, name);
+	if (!obj)
+		return notification_handled(cmd);
+
+	/* Failures put the payment fields under "data" */
+	fields = json_get_member(buf, obj, "data");
+	if (!fields)
+		fields = obj;
+
+	hashtok = json_get_member(buf, fields, "payment_hash");
+	groupidtok = json_get_member(buf, fields, "groupid");
+	partidtok = json_get_member(buf, fields, "partid");
+	if (!hashtok || !json_to_sha256(buf, hashtok, &payment_hash)
+	    || !groupidtok || !json_to_u64(buf, groupidtok, &groupid))
+		return notification_handled(cmd);
+
+	/* If the partid is 0 it's omitted */
+	if (!partidtok)
+		partid = 0;
+	else if (!json_to_u32(buf, partidtok, &partid))
+		return notification_handled(cmd);
+
+	/* Probably not one of ours. */
+	part = inflight_part_find(&payment_hash, groupid, partid);
+	if (!part)
+		return notification_handled(cmd);
+
+	p = part->p;
+	tal_free(part);
+	payment_sendpay_finished(NULL, buf, obj, p);
+	return notification_handled(cmd);
+}
+
+struct command_result *handle_sendpay_success(struct command *cmd,
+					      const char *buf,
+					      const jsmntok_t *params)
+{
+	return sendpay_notification(cmd, buf, params, "sendpay_success");
+}
+
+struct command_result *handle_sendpay_failure(struct command *cmd,
+					      const char *buf,
+					      const jsmntok_t *params)
+{
+	return sendpay_notification(cmd, buf, params, "sendpay_failure");
+}
+
+/* The result usually comes later, as a notification. */
 static struct command_result *payment_sendonion_success(struct command *cmd,
-							  const char *buffer,
-							  const jsmntok_t *toks,
-							  struct payment *p)
+							const char *buffer,
+							const jsmntok_t *toks,
+							struct payment *p)
 {
-	struct out_req *req;
-	req = jsonrpc_request_start(p->plugin, NULL, "waitsendpay",
-				    payment_waitsendpay_finished,
-				    payment_waitsendpay_finished, p);
-	json_add_sha256(req->js, "payment_hash", p->payment_hash);
-	json_add_num(req->js, "partid", p->partid);
-	json_add_u64(req->js, "groupid", p->groupid);
-	send_outreq(p->plugin, req);
+	const jsmntok_t *statustok = json_get_member(buffer, toks, "status");
+	struct inflight_part *part;
 
-	return command_still_pending(cmd);
+	/* If it had already succeeded, lightningd just says so: there won't
+	 * be a notification for this one. */
+	if (!statustok || !json_tok_streq(buffer, statustok, "complete"))
+		return command_still_pending(cmd);
+
+	/* Don't finish it twice. */
+	part = inflight_part_find(p->payment_hash, p->groupid, p->partid);
+	if (!part)
+		return command_still_pending(cmd);
+	tal_free(part);
+	return payment_sendpay_finished(cmd, buffer, toks, p);
 }
 
-static struct command_result *payment_createonion_success(struct command *cmd,
-							  const char *buffer,
-							  const jsmntok_t *toks,
-							  struct payment *p)
+static struct command_result *payment_sendonion_failure(struct command *cmd,
+							const char *buffer,
+							const jsmntok_t *toks,
+							struct payment *p)
+{
+	/* There won't be a notification for this one */
+	tal_free(inflight_part_find(p->payment_hash, p->groupid, p->partid));
+	return payment_rpc_failure(cmd, buffer, toks, p);
+}
+
+static void payment_send_createdonion(struct payment *p)
 {
 	struct out_req *req;
 	struct route_hop *first = &p->route[0];
 	struct secret *secrets;
 	struct payment *root = payment_root(p);
 
-	p->createonion_response = json_to_createonion_response(p, buffer, toks);
-
 	req = jsonrpc_request_start(p->plugin, NULL, "sendonion",
 				    payment_sendonion_success,
-				    payment_rpc_failure, p);
+				    payment_sendonion_failure, p);
 	json_add_hex_talarr(req->js, "onion", p->createonion_response->onion);
 
 	json_object_start(req->js, "first_hop");
@@ -1613,8 +2024,8 @@ static struct command_result *payment_createonion_success(struct command *cmd,
 	if (p->local_invreq_id)
 		json_add_sha256(req->js, "localinvreqid", p->local_invreq_id);
 
+	inflight_part_add(p);
 	send_outreq(p->plugin, req);
-	return command_still_pending(cmd);
 }
 
 /* Temporary serialization method for the tlv_payload.data until we rework the
@@ -1725,7 +2136,7 @@ static void payment_compute_onion_payloads(struct payment *p)
 		return payment_continue(p);
 	}
 
-	/* Now compute the payload we're about to pass to `createonion` */
+	/* Now compute the payload we're about to build the onion from */
 	cr = p->createonion_request = tal(p, struct createonion_request);
 	cr->assocdata = tal_arr(cr, u8, 0);
 	towire_sha256(&cr->assocdata, p->payment_hash);
@@ -1774,44 +2185,60 @@ static void payment_compute_onion_payloads(struct payment *p)
 	p->routetxt = tal_steal(p, routetxt);
 
 	/* Now allow all the modifiers to mess with the payloads, before we
-	 * serialize via a call to createonion in the next step. */
+	 * build the onion in the next step. */
 	payment_continue(p);
 }
 
 static void payment_sendonion(struct payment *p)
 {
-	struct out_req *req;
-	u8 *payload, *tlv;
-	req = jsonrpc_request_start(p->plugin, NULL, "createonion",
-				    payment_createonion_success,
-				    payment_rpc_failure, p);
+	struct createonion_request *cr = p->createonion_request;
+	struct sphinx_path *sp;
+	struct onionpacket *packet;
+	struct secret *shared_secrets;
+	u8 *tlv;
+
+	/* This is what `createonion` does, but it saves us a round trip
+	 * (and hex-encoding everything twice) for every attempt. */
+	if (cr->session_key)
+		sp = sphinx_path_new_with_key(tmpctx, cr->assocdata,
+					      cr->session_key);
+	else
+		sp = sphinx_path_new(tmpctx, cr->assocdata);
 
-	json_array_start(req->js, "hops");
-	for (size_t i = 0; i < tal_count(p->createonion_request->hops); i++) {
-		json_object_start(req->js, NULL);
-		struct createonion_hop *hop = &p->createonion_request->hops[i];
-		json_add_node_id(req->js, "pubkey", &hop->pubkey);
+	for (size_t i = 0; i < tal_count(cr->hops); i++) {
+		struct createonion_hop *hop = &cr->hops[i];
+		struct pubkey pubkey;
 
-		tlv = tal_arr(tmpctx, u8, 0);
+		if (!pubkey_from_node_id(&pubkey, &hop->pubkey)) {
+			payment_fail(p, "Invalid node_id %s in onion",
+				     type_to_string(tmpctx, struct node_id,
+						    &hop->pubkey));
+			return;
+		}
+		tlv = tal_arr(NULL, u8, 0);
 		towire_tlvstream_raw(&tlv, hop->tlv_payload->fields);
-		payload = tal_arr(tmpctx, u8, 0);
-		towire_bigsize(&payload, tal_bytelen(tlv));
-		towire(&payload, tlv, tal_bytelen(tlv));
-		json_add_hex_talarr(req->js, "payload", payload);
-		tal_free(tlv);
-		tal_free(payload);
-		json_object_end(req->js);
+		sphinx_add_hop(sp, &pubkey, take(tlv));
 	}
-	json_array_end(req->js);
 
-	json_add_hex_talarr(req->js, "assocdata",
-			    p->createonion_request->assocdata);
+	if (sphinx_path_payloads_size(sp) > ROUTING_INFO_SIZE) {
+		payment_fail(p, "Payloads exceed maximum onion packet size.");
+		return;
+	}
 
-	if (p->createonion_request->session_key)
-		json_add_secret(req->js, "sessionkey",
-				p->createonion_request->session_key);
+	packet = create_onionpacket(tmpctx, sp, ROUTING_INFO_SIZE,
+				    &shared_secrets);
+	if (!packet) {
+		payment_fail(p, "Could not create onion packet");
+		return;
+	}
 
-	send_outreq(p->plugin, req);
+	p->createonion_response = tal(p, struct createonion_response);
+	p->createonion_response->onion
+		= serialize_onionpacket(p->createonion_response, packet);
+	p->createonion_response->shared_secrets
+		= tal_steal(p->createonion_response, shared_secrets);
+
+	payment_send_createdonion(p);
 }
 
 /* Mutual recursion. */
@@ -2352,8 +2779,8 @@ REGISTER_PAYMENT_MODIFIER(retry, struct retry_mod_data *, retry_data_init,
 			  retry_step_cb);
 
 static struct command_result *
-local_channel_hints_listpeerchannels(struct command *cmd, const char *buffer,
-				     const jsmntok_t *toks, struct payment *p)
+local_channel_hints_listchannelbalances(struct command *cmd, const char *buffer,
+					const jsmntok_t *toks, struct payment *p)
 {
 	struct listpeers_channel **chans;
 
@@ -2397,15 +2824,16 @@ static void local_channel_hints_cb(void *d UNUSED, struct payment *p)
 	struct out_req *req;
 	/* If we are not the root we don't look up the channel balances since
 	 * it is unlikely that the capacities have changed much since the root
-	 * payment looked at them. We also only call `listpeers` when the
-	 * payment is in state PAYMENT_STEP_INITIALIZED, right before calling
-	 * `getroute`. */
+	 * payment looked at them. We also only call `listchannelbalances`
+	 * when the payment is in state PAYMENT_STEP_INITIALIZED, right before
+	 * calling `getroute`.  We only need the balances, so this is much
+	 * cheaper than `listpeerchannels`, which also lists every HTLC. */
 	if (p->parent != NULL || p->step != PAYMENT_STEP_INITIALIZED)
 		return payment_continue(p);
 
-	req = jsonrpc_request_start(p->plugin, NULL, "listpeerchannels",
-				    local_channel_hints_listpeerchannels,
-				    local_channel_hints_listpeerchannels, p);
+	req = jsonrpc_request_start(p->plugin, NULL, "listchannelbalances",
+				    local_channel_hints_listchannelbalances,
+				    local_channel_hints_listchannelbalances, p);
 	send_outreq(p->plugin, req);
 }
 
@@ -2526,19 +2954,17 @@ static bool route_msatoshi(struct amount_msat *total,
 static bool routehint_excluded(struct payment *p,
 			       const struct route_info *routehint)
 {
-	const struct node_id *nodes = payment_get_excluded_nodes(tmpctx, p);
 	const struct short_channel_id_dir *chans =
 	    payment_get_excluded_channels(tmpctx, p);
-	const struct channel_hint *hints = payment_root(p)->channel_hints;
+	struct channel_hint_map *hints = payment_root(p)->channel_hints;
 
 	/* Note that we ignore direction here: in theory, we could have
 	 * found that one direction of a channel is unavailable, but they
 	 * are suggesting we use it the other way.  Very unlikely though! */
 	for (size_t i = 0; i < tal_count(routehint); i++) {
 		const struct route_info *r = &routehint[i];
-		for (size_t j = 0; j < tal_count(nodes); j++)
-			if (node_id_eq(&r->pubkey, &nodes[j]))
-			    return true;
+		if (node_is_excluded(p, &r->pubkey))
+			return true;
 
 		for (size_t j = 0; j < tal_count(chans); j++)
 			if (short_channel_id_eq(&chans[j].scid, &r->short_channel_id))
@@ -2569,13 +2995,19 @@ static bool routehint_excluded(struct payment *p,
 		 * know the exact capacity we need to send via this
 		 * channel, which is greater than the destination.
 		 */
-		for (size_t j = 0; j < tal_count(hints); j++) {
-			if (!short_channel_id_eq(&hints[j].scid.scid, &r->short_channel_id))
+		for (int dir = 0; dir < 2; dir++) {
+			struct short_channel_id_dir scidd;
+			const struct channel_hint *hint;
+
+			scidd.scid = r->short_channel_id;
+			scidd.dir = dir;
+			hint = channel_hint_map_get(hints, &scidd);
+			if (!hint)
 				continue;
 			/* We exclude on equality because we set the estimate
 			 * to the smallest failed attempt.  */
 			if (amount_msat_greater_eq(needed_capacity,
-						   hints[j].estimated_capacity))
+						   hint->estimated_capacity))
 				return true;
 		}
 	}
@@ -3217,14 +3649,7 @@ static void direct_pay_override(struct payment *p) {
 
 	/* If we have a channel we need to make sure that it still has
 	 * sufficient capacity. Look it up in the channel_hints. */
-	for (size_t i=0; i<tal_count(root->channel_hints); i++) {
-		struct short_channel_id_dir *cur = &root->channel_hints[i].scid;
-		if (short_channel_id_eq(&cur->scid, &d->chan->scid) &&
-		    cur->dir == d->chan->dir) {
-			hint = &root->channel_hints[i];
-			break;
-		}
-	}
+	hint = channel_hint_map_get(root->channel_hints, d->chan);
 
 	if (hint && hint->enabled &&
 	    amount_msat_greater(hint->estimated_capacity, p->amount)) {
@@ -3467,9 +3892,11 @@ static u32 payment_max_htlcs(const struct payment *p)
 {
 	const struct payment *root;
 	struct channel_hint *h;
+	struct channel_hint_map_iter it;
 	u32 res = 0;
-	for (size_t i = 0; i < tal_count(p->channel_hints); i++) {
-		h = &p->channel_hints[i];
+	for (h = channel_hint_map_first(p->channel_hints, &it);
+	     h;
+	     h = channel_hint_map_next(p->channel_hints, &it)) {
 		if (h->local && h->enabled)
 			res += h->local->htlc_budget;
 	}
@@ -3993,7 +4420,7 @@ static void route_exclusions_step_cb(struct route_exclusions_data *d,
 				return;
 			}
 
-			tal_arr_expand(&p->excluded_nodes, e->u.node_id);
+			payment_exclude_node(p, &e->u.node_id);
 		}
 	}
 	payment_continue(p);
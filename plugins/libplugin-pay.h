@@ -13,7 +13,7 @@ struct legacy_payload {
 	u32 outgoing_cltv;
 };
 
-/* struct holding the information necessary to call createonion */
+/* struct holding the information necessary to create the onion */
 struct createonion_hop {
 	struct node_id pubkey;
 	struct tlv_payload *tlv_payload;
@@ -252,10 +252,11 @@ struct payment {
 	struct route_info **routes;
 	const u8 *features;
 
-	/* tal_arr of channel_hints we incrementally learn while performing
-	 * payment attempts. */
-	struct channel_hint *channel_hints;
-	struct node_id *excluded_nodes;
+	/* channel_hints we incrementally learn while performing payment
+	 * attempts, and nodes we learned to avoid.  These are consulted for
+	 * every edge the route search looks at, hence hash tables. */
+	struct channel_hint_map *channel_hints;
+	struct excluded_node_map *excluded_nodes;
 
 	/* Optional temporarily excluded channels/nodes (i.e. this routehint) */
 	struct node_id *temp_exclusion;
@@ -454,6 +455,9 @@ REGISTER_PAYMENT_MODIFIER_HEADER(route_exclusions, struct route_exclusions_data)
 REGISTER_PAYMENT_MODIFIER_HEADER(check_preapproveinvoice, void);
 
 
+/* Every plugin using payment_new() must subscribe to the `sendpay_success`
+ * and `sendpay_failure` notifications using handle_sendpay_success() and
+ * handle_sendpay_failure() below: otherwise its payments never finish. */
 struct payment *payment_new(tal_t *ctx, struct command *cmd,
 			    struct payment *parent,
 			    struct payment_modifier **mods);
@@ -487,4 +491,15 @@ struct payment_tree_result payment_collect_result(struct payment *p);
 /* For special effects, like inspecting your own routes. */
 struct gossmap *get_gossmap(struct plugin *plugin);
 
+/* Plugins using this must subscribe to the `sendpay_success` and
+ * `sendpay_failure` notifications with these: that's how we learn the
+ * outcome of each part we send (unless sendonion tells us it was already
+ * complete), so without them payments stay pending forever. */
+struct command_result *handle_sendpay_success(struct command *cmd,
+					      const char *buf,
+					      const jsmntok_t *params);
+struct command_result *handle_sendpay_failure(struct command *cmd,
+					      const char *buf,
+					      const jsmntok_t *params);
+
 #endif /* LIGHTNING_PLUGINS_LIBPLUGIN_PAY_H */
@@ -975,6 +975,13 @@ handle_getmanifest(struct command *getmanifest_cmd,
 						p->hook_subs[i].after[j]);
 			json_array_end(params);
 		}
+		if (p->hook_subs[i].filters) {
+			json_array_start(params, "filters");
+			for (size_t j = 0; j < p->hook_subs[i].num_filters; j++)
+				json_add_u64(params, NULL,
+					     p->hook_subs[i].filters[j]);
+			json_array_end(params);
+		}
 		json_object_end(params);
 	}
 	json_array_end(params);
@@ -2020,7 +2027,15 @@ static struct listpeers_channel *json_to_listpeers_channel(const tal_t *ctx,
 	json_to_msat(buffer, tmsattok, &chan->total_msat);
 	json_to_msat(buffer, smsattok, &chan->spendable_msat);
 	json_to_u16(buffer, max_htlcs, &chan->max_accepted_htlcs);
-	chan->num_htlcs = htlcstok->size;
+	/* listchannelbalances only counts them */
+	if (htlcstok)
+		chan->num_htlcs = htlcstok->size;
+	else {
+		u32 num_htlcs;
+		json_to_u32(buffer, json_get_member(buffer, tok, "num_htlcs"),
+			    &num_htlcs);
+		chan->num_htlcs = num_htlcs;
+	}
 
 	return chan;
 }
@@ -2046,38 +2061,6 @@ struct listpeers_channel **json_to_listpeers_channels(const tal_t *ctx,
 	return chans;
 }
 
-struct createonion_response *json_to_createonion_response(const tal_t *ctx,
-							  const char *buffer,
-							  const jsmntok_t *toks)
-{
-	size_t i;
-	struct createonion_response *resp;
-	const jsmntok_t *oniontok = json_get_member(buffer, toks, "onion");
-	const jsmntok_t *secretstok = json_get_member(buffer, toks, "shared_secrets");
-	const jsmntok_t *cursectok;
-
-	if (oniontok == NULL || secretstok == NULL)
-		return NULL;
-
-	resp = tal(ctx, struct createonion_response);
-
-	if (oniontok->type != JSMN_STRING)
-		goto fail;
-
-	resp->onion = json_tok_bin_from_hex(resp, buffer, oniontok);
-	resp->shared_secrets = tal_arr(resp, struct secret, secretstok->size);
-
-	json_for_each_arr(i, cursectok, secretstok) {
-		if (cursectok->type != JSMN_STRING)
-			goto fail;
-		json_to_secret(buffer, cursectok, &resp->shared_secrets[i]);
-	}
-	return resp;
-
-fail:
-	return tal_free(resp);
-}
-
 static bool json_to_route_hop_inplace(struct route_hop *dst, const char *buffer,
 				      const jsmntok_t *toks)
 {
@@ -103,6 +103,10 @@ struct plugin_hook {
 	                                 const jsmntok_t *params);
 	/* If non-NULL, these are NULL-terminated arrays of deps */
 	const char **before, **after;
+	/* If non-NULL, only call for these (hook-specific) values, e.g.
+	 * custommsg types or htlc_accepted onion TLV types. */
+	const u64 *filters;
+	size_t num_filters;
 };
 
 /* Return the feature set of the current lightning node */
@@ -468,7 +472,8 @@ struct listpeers_channel {
 	/* TODO Add fields as we need them. */
 };
 
-/* Returns an array of listpeers_channel from listpeerchannels * */
+/* Returns an array of listpeers_channel from listpeerchannels or
+ * listchannelbalances */
 struct listpeers_channel **json_to_listpeers_channels(const tal_t *ctx,
 						      const char *buffer,
 						      const jsmntok_t *tok);
@@ -478,10 +483,6 @@ struct createonion_response {
 	struct secret *shared_secrets;
 };
 
-struct createonion_response *json_to_createonion_response(const tal_t *ctx,
-							  const char *buffer,
-							  const jsmntok_t *toks);
-
 struct route_hop *json_to_route(const tal_t *ctx, const char *buffer,
 				const jsmntok_t *toks);
 
@@ -1258,6 +1258,17 @@ static const struct plugin_command commands[] = {
 	},
 };
 
+static const struct plugin_notification notifs[] = {
+	{
+		"sendpay_success",
+		handle_sendpay_success,
+	},
+	{
+		"sendpay_failure",
+		handle_sendpay_failure,
+	},
+};
+
 static const char *notification_topics[] = {
 	"pay_success",
 	"pay_failure",
@@ -1267,7 +1278,8 @@ int main(int argc, char *argv[])
 {
 	setup_locale();
 	plugin_main(argv, init, PLUGIN_RESTARTABLE, true, NULL, commands,
-		    ARRAY_SIZE(commands), NULL, 0, NULL, 0,
+		    ARRAY_SIZE(commands),
+		    notifs, ARRAY_SIZE(notifs), NULL, 0,
 		    notification_topics, ARRAY_SIZE(notification_topics),
 		    plugin_option("disable-mpp", "flag",
 				  "Disable multi-part payments.",
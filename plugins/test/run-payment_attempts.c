@@ -0,0 +1,396 @@
+#include "config.h"
+#include "../libplugin-pay.c"
+#include <bitcoin/chainparams.h>
+#include <ccan/cast/cast.h>
+#include <ccan/json_out/json_out.h>
+#include <ccan/time/time.h>
+#include <common/json_parse_simple.h>
+#include <common/setup.h>
+#include <common/utils.h>
+#include <stdio.h>
+
+/* AUTOGENERATED MOCKS START */
+/* Generated stub for blinded_onion_hops */
+u8 **blinded_onion_hops(const tal_t *ctx UNNEEDED,
+			struct amount_msat final_amount UNNEEDED,
+			u32 final_cltv UNNEEDED,
+			struct amount_msat total_amount UNNEEDED,
+			const struct blinded_path *path UNNEEDED)
+{ fprintf(stderr, "blinded_onion_hops called!\n"); abort(); }
+/* Generated stub for command_finished */
+struct command_result *command_finished(struct command *cmd UNNEEDED, struct json_stream *response UNNEEDED)
+{ fprintf(stderr, "command_finished called!\n"); abort(); }
+/* Generated stub for feature_offered */
+bool feature_offered(const u8 *features UNNEEDED, size_t f UNNEEDED)
+{ fprintf(stderr, "feature_offered called!\n"); abort(); }
+/* Generated stub for json_to_listpeers_channels */
+struct listpeers_channel **json_to_listpeers_channels(const tal_t *ctx UNNEEDED,
+						      const char *buffer UNNEEDED,
+						      const jsmntok_t *tok UNNEEDED)
+{ fprintf(stderr, "json_to_listpeers_channels called!\n"); abort(); }
+/* Generated stub for jsonrpc_stream_fail */
+struct json_stream *jsonrpc_stream_fail(struct command *cmd UNNEEDED,
+					int code UNNEEDED,
+					const char *err UNNEEDED)
+{ fprintf(stderr, "jsonrpc_stream_fail called!\n"); abort(); }
+/* Generated stub for jsonrpc_stream_success */
+struct json_stream *jsonrpc_stream_success(struct command *cmd UNNEEDED)
+{ fprintf(stderr, "jsonrpc_stream_success called!\n"); abort(); }
+/* Generated stub for plugin_err */
+void  plugin_err(struct plugin *p UNNEEDED, const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "plugin_err called!\n"); abort(); }
+/* Generated stub for plugin_notification_end */
+void plugin_notification_end(struct plugin *plugin UNNEEDED,
+			     struct json_stream *stream TAKES UNNEEDED)
+{ fprintf(stderr, "plugin_notification_end called!\n"); abort(); }
+/* Generated stub for plugin_notification_start */
+struct json_stream *plugin_notification_start(struct plugin *plugins UNNEEDED,
+					      const char *method UNNEEDED)
+{ fprintf(stderr, "plugin_notification_start called!\n"); abort(); }
+/* Generated stub for random_select */
+bool random_select(double weight UNNEEDED, double *tot_weight UNNEEDED)
+{ fprintf(stderr, "random_select called!\n"); abort(); }
+/* AUTOGENERATED MOCKS END */
+
+/* This is private to libplugin */
+struct command_result {
+	char c;
+};
+static struct command_result pending, complete;
+
+/* Our fake lightningd: requests are queued, and answered once the plugin
+ * has sent everything it wants to, just as a real one would interleave. */
+static struct out_req **queued;
+static size_t num_requests;
+static bool fail_sendonion, already_complete;
+
+struct command_result *command_still_pending(struct command *cmd)
+{
+	return &pending;
+}
+
+struct command_result *notification_handled(struct command *cmd)
+{
+	tal_free(cmd);
+	return &complete;
+}
+
+const char *json_id_prefix(const tal_t *ctx, const struct command *cmd)
+{
+	return "";
+}
+
+void *notleak_(void *ptr, bool plus_children)
+{
+	return ptr;
+}
+
+void plugin_log(struct plugin *p, enum log_level l, const char *fmt, ...)
+{
+}
+
+struct out_req *
+jsonrpc_request_start_(struct plugin *plugin, struct command *cmd,
+		       const char *method,
+		       const char *id_prefix,
+		       struct command_result *(*cb)(struct command *command,
+						    const char *buf,
+						    const jsmntok_t *result,
+						    void *arg),
+		       struct command_result *(*errcb)(struct command *command,
+						       const char *buf,
+						       const jsmntok_t *result,
+						       void *arg),
+		       void *arg)
+{
+	struct out_req *out = tal(NULL, struct out_req);
+
+	out->id = tal_fmt(out, "%s%s#%zu", id_prefix, method, num_requests);
+	out->cmd = cmd;
+	out->cb = cb;
+	out->errcb = errcb;
+	out->arg = arg;
+	out->js = new_json_stream(out, cmd, NULL);
+	json_object_start(out->js, NULL);
+	json_add_string(out->js, "jsonrpc", "2.0");
+	json_add_string(out->js, "method", method);
+	json_add_string(out->js, "id", out->id);
+	json_object_start(out->js, "params");
+	return out;
+}
+
+struct command_result *send_outreq(struct plugin *plugin,
+				   const struct out_req *req)
+{
+	/* The params, then the request itself */
+	json_object_end(req->js);
+	json_object_end(req->js);
+	tal_arr_expand(&queued, cast_const(struct out_req *, req));
+	num_requests++;
+	return &pending;
+}
+
+static const jsmntok_t *parse(const char *buf)
+{
+	const jsmntok_t *toks = json_parse_simple(tmpctx, buf, strlen(buf));
+	assert(toks);
+	return toks;
+}
+
+/* A completed payment, as in the notification or a sendonion reply */
+static const char *success_json(const struct sha256 *payment_hash,
+				u64 groupid, u32 partid,
+				struct amount_msat amount,
+				const struct preimage *preimage)
+{
+	/* lightningd omits partid 0 */
+	return tal_fmt(tmpctx, "{\"id\":%zu,"
+		       "\"payment_hash\":\"%s\","
+		       "\"groupid\":%"PRIu64",%s"
+		       "\"amount_sent_msat\":%"PRIu64","
+		       "\"status\":\"complete\","
+		       "\"payment_preimage\":\"%s\"}",
+		       num_requests,
+		       type_to_string(tmpctx, struct sha256, payment_hash),
+		       groupid,
+		       partid ? tal_fmt(tmpctx, "\"partid\":%u,", partid) : "",
+		       amount.millisatoshis, /* Raw: test JSON */
+		       type_to_string(tmpctx, struct preimage, preimage));
+}
+
+static void notify_success(const struct sha256 *payment_hash,
+			   u64 groupid, u32 partid,
+			   struct amount_msat amount,
+			   const struct preimage *preimage)
+{
+	const char *buf;
+
+	buf = tal_fmt(tmpctx, "{\"sendpay_success\":%s}",
+		      success_json(payment_hash, groupid, partid, amount,
+				   preimage));
+	handle_sendpay_success(tal(NULL, struct command), buf, parse(buf));
+}
+
+/* Check the sendonion request and answer it. */
+static void answer(struct out_req *req, const struct preimage *preimage)
+{
+	struct payment *p = req->arg;
+	const char *buf;
+	const jsmntok_t *toks, *params, *tok;
+	struct sha256 payment_hash;
+	u64 groupid;
+	u32 partid;
+	u8 *onion;
+	size_t len;
+
+	buf = json_out_contents(req->js->jout, &len);
+	toks = json_parse_simple(tmpctx, buf, len);
+	assert(toks);
+	assert(json_tok_streq(buf, json_get_member(buf, toks, "method"),
+			      "sendonion"));
+
+	params = json_get_member(buf, toks, "params");
+	onion = json_tok_bin_from_hex(tmpctx, buf,
+				      json_get_member(buf, params, "onion"));
+	assert(tal_bytelen(onion) == TOTAL_PACKET_SIZE(ROUTING_INFO_SIZE));
+	tok = json_get_member(buf, params, "shared_secrets");
+	assert(tok->size == tal_count(p->route));
+	assert(json_to_sha256(buf, json_get_member(buf, params, "payment_hash"),
+			      &payment_hash));
+	assert(json_to_u64(buf, json_get_member(buf, params, "groupid"),
+			   &groupid));
+	assert(json_to_u32(buf, json_get_member(buf, params, "partid"),
+			   &partid));
+	assert(sha256_eq(&payment_hash, p->payment_hash));
+	assert(groupid == p->groupid);
+	assert(partid == p->partid);
+
+	if (fail_sendonion) {
+		buf = "{\"code\":204,\"message\":\"First peer not ready\"}";
+		req->errcb(NULL, buf, parse(buf), req->arg);
+		return;
+	}
+
+	/* Already paid: lightningd says so, and doesn't notify. */
+	if (already_complete) {
+		buf = success_json(&payment_hash, groupid, partid, p->amount,
+				   preimage);
+		req->cb(NULL, buf, parse(buf), req->arg);
+		return;
+	}
+
+	/* The notification can arrive before or after the response. */
+	if (partid % 2)
+		notify_success(&payment_hash, groupid, partid, p->amount,
+			       preimage);
+	buf = "{\"status\":\"pending\"}";
+	req->cb(NULL, buf, parse(buf), req->arg);
+	if (!(partid % 2))
+		notify_success(&payment_hash, groupid, partid, p->amount,
+			       preimage);
+}
+
+static void answer_all(const struct preimage *preimage)
+{
+	for (size_t i = 0; i < tal_count(queued); i++) {
+		answer(queued[i], preimage);
+		tal_free(queued[i]);
+	}
+	tal_resize(&queued, 0);
+	clean_tmpctx();
+}
+
+static void node_id_from_privkey(const struct privkey *p, struct node_id *id)
+{
+	struct pubkey k;
+	pubkey_from_privkey(p, &k);
+	node_id_from_pubkey(id, &k);
+}
+
+#define NUM_NODES 20
+
+static struct payment *new_split_payment(tal_t *ctx,
+					 struct payment_modifier **mods,
+					 const struct node_id *ids,
+					 const struct sha256 *payment_hash,
+					 u64 groupid,
+					 size_t num_parts)
+{
+	struct payment *root;
+
+	root = payment_new(ctx, talz(ctx, struct command), NULL, mods);
+	/* We never finish the command, we just watch the parts */
+	root->cmd = NULL;
+	root->payment_hash = tal_dup(root, struct sha256, payment_hash);
+	root->destination = tal_dup(root, struct node_id, &ids[NUM_NODES-1]);
+	root->payment_secret = talz(root, struct secret);
+	root->payment_metadata = NULL;
+	root->blindedpath = NULL;
+	root->invstring = "lnbcrt1fakeinvoice";
+	root->amount = amount_msat(num_parts * 10000000);
+	root->start_constraints = talz(root, struct payment_constraints);
+	root->deadline = timeabs_add(time_now(), time_from_sec(60));
+	root->min_final_cltv_expiry = 18;
+	root->routes = NULL;
+	root->features = NULL;
+	root->groupid = groupid;
+	root->start_block = 1000;
+	payment_set_step(root, PAYMENT_STEP_SPLIT);
+
+	for (size_t i = 0; i < num_parts; i++) {
+		struct payment *c = payment_new(root, NULL, root, mods);
+		/* 3 to 5 hops, ending at the destination */
+		size_t hops = 3 + i % 3;
+
+		c->amount = amount_msat(10000000);
+		c->start_block = root->start_block;
+		c->route = tal_arr(c, struct route_hop, hops);
+		for (size_t h = 0; h < hops; h++) {
+			struct route_hop *hop = &c->route[h];
+			size_t n = (h == hops - 1) ? NUM_NODES - 1
+				: (i + h) % (NUM_NODES - 1);
+
+			if (!mk_short_channel_id(&hop->scid, n + 1, i, h))
+				abort();
+			hop->direction = h % 2;
+			hop->node_id = ids[n];
+			hop->amount = c->amount;
+			hop->delay = 18 + (hops - 1 - h) * 6;
+		}
+	}
+	return root;
+}
+
+static void send_parts(struct payment *root)
+{
+	for (size_t i = 0; i < tal_count(root->children); i++) {
+		payment_set_step(root->children[i], PAYMENT_STEP_GOT_ROUTE);
+		payment_continue(root->children[i]);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	struct node_id ids[NUM_NODES];
+	struct payment_modifier **mods;
+	struct payment *root;
+	struct preimage preimage;
+	struct sha256 payment_hash;
+	size_t num_parts = 10, rounds = 2, attempts = 0;
+	const char *buf;
+	/* We clean tmpctx as we go, so these can't live there. */
+	tal_t *ctx;
+
+	common_setup(argv[0]);
+	chainparams = chainparams_for_network("regtest");
+	ctx = tal(NULL, char);
+	queued = tal_arr(ctx, struct out_req *, 0);
+
+	for (size_t i = 0; i < NUM_NODES; i++) {
+		struct privkey tmp;
+		memset(&tmp, i+1, sizeof(tmp));
+		node_id_from_privkey(&tmp, &ids[i]);
+	}
+	mods = tal_arrz(ctx, struct payment_modifier *, 1);
+	memset(&preimage, 7, sizeof(preimage));
+	sha256(&payment_hash, &preimage, sizeof(preimage));
+
+	/* An MPP payment: each part costs one request, and its result
+	 * arrives as a notification. */
+	for (size_t r = 0; r < rounds; r++) {
+		root = new_split_payment(ctx, mods, ids, &payment_hash, r + 1,
+					 num_parts);
+		send_parts(root);
+		assert(tal_count(queued) == num_parts);
+		assert(inflight_part_map_count(inflight_parts) == num_parts);
+		attempts += num_parts;
+
+		/* Notifications for someone else's payment are ignored. */
+		buf = "{\"sendpay_success\":{\"id\":1,"
+			"\"payment_hash\":\"0000000000000000000000000000000000000000000000000000000000000000\","
+			"\"groupid\":1,\"partid\":1,\"amount_sent_msat\":1,"
+			"\"status\":\"complete\"}}";
+		handle_sendpay_success(tal(NULL, struct command), buf,
+				       parse(buf));
+		assert(inflight_part_map_count(inflight_parts) == num_parts);
+
+		answer_all(&preimage);
+		assert(inflight_part_map_count(inflight_parts) == 0);
+		for (size_t i = 0; i < num_parts; i++) {
+			assert(root->children[i]->step == PAYMENT_STEP_SUCCESS);
+			assert(root->children[i]->result->payment_preimage);
+		}
+		assert(payment_is_finished(root));
+		assert(payment_is_success(root));
+		tal_free(root);
+	}
+	assert(num_requests == attempts);
+
+	/* If sendonion fails outright, there's no notification to wait for. */
+	root = new_split_payment(ctx, mods, ids, &payment_hash, rounds + 1, 1);
+	send_parts(root);
+	fail_sendonion = true;
+	answer_all(&preimage);
+	assert(inflight_part_map_count(inflight_parts) == 0);
+	assert(root->children[0]->step == PAYMENT_STEP_FAILED);
+	tal_free(root);
+	fail_sendonion = false;
+
+	/* If it was already paid, the sendonion reply is all we get. */
+	root = new_split_payment(ctx, mods, ids, &payment_hash, rounds + 2, 2);
+	send_parts(root);
+	already_complete = true;
+	answer_all(&preimage);
+	assert(inflight_part_map_count(inflight_parts) == 0);
+	for (size_t i = 0; i < 2; i++) {
+		assert(root->children[i]->step == PAYMENT_STEP_SUCCESS);
+		assert(root->children[i]->result->payment_preimage);
+	}
+	assert(payment_is_success(root));
+	tal_free(root);
+
+	tal_free(inflight_parts);
+	tal_free(ctx);
+	common_shutdown();
+	return 0;
+}
@@ -0,0 +1,577 @@
+#include "config.h"
+#include "../libplugin-pay.c"
+#include <bitcoin/chainparams.h>
+#include <common/gossip_store.h>
+#include <common/setup.h>
+#include <common/utils.h>
+#include <stdio.h>
+#include <unistd.h>
+
+/* AUTOGENERATED MOCKS START */
+/* Generated stub for blinded_onion_hops */
+u8 **blinded_onion_hops(const tal_t *ctx UNNEEDED,
+			struct amount_msat final_amount UNNEEDED,
+			u32 final_cltv UNNEEDED,
+			struct amount_msat total_amount UNNEEDED,
+			const struct blinded_path *path UNNEEDED)
+{ fprintf(stderr, "blinded_onion_hops called!\n"); abort(); }
+/* Generated stub for command_finished */
+struct command_result *command_finished(struct command *cmd UNNEEDED, struct json_stream *response UNNEEDED)
+{ fprintf(stderr, "command_finished called!\n"); abort(); }
+/* Generated stub for command_still_pending */
+struct command_result *command_still_pending(struct command *cmd UNNEEDED)
+{ fprintf(stderr, "command_still_pending called!\n"); abort(); }
+/* Generated stub for create_onionpacket */
+struct onionpacket *create_onionpacket(
+	const tal_t * ctx UNNEEDED,
+	struct sphinx_path *sp UNNEEDED,
+	size_t fixed_size UNNEEDED,
+	struct secret **path_secrets
+	UNNEEDED)
+{ fprintf(stderr, "create_onionpacket called!\n"); abort(); }
+/* Generated stub for feature_offered */
+bool feature_offered(const u8 *features UNNEEDED, size_t f UNNEEDED)
+{ fprintf(stderr, "feature_offered called!\n"); abort(); }
+/* Generated stub for fromwire_bigsize */
+bigsize_t fromwire_bigsize(const u8 **cursor UNNEEDED, size_t *max UNNEEDED)
+{ fprintf(stderr, "fromwire_bigsize called!\n"); abort(); }
+/* Generated stub for fromwire_channel_id */
+bool fromwire_channel_id(const u8 **cursor UNNEEDED, size_t *max UNNEEDED,
+			 struct channel_id *channel_id UNNEEDED)
+{ fprintf(stderr, "fromwire_channel_id called!\n"); abort(); }
+/* Generated stub for json_add_amount_msat */
+void json_add_amount_msat(struct json_stream *result UNNEEDED,
+			  const char *msatfieldname UNNEEDED,
+			  struct amount_msat msat)
+
+{ fprintf(stderr, "json_add_amount_msat called!\n"); abort(); }
+/* Generated stub for json_add_hex_talarr */
+void json_add_hex_talarr(struct json_stream *result UNNEEDED,
+			 const char *fieldname UNNEEDED,
+			 const tal_t *data UNNEEDED)
+{ fprintf(stderr, "json_add_hex_talarr called!\n"); abort(); }
+/* Generated stub for json_add_invstring */
+void json_add_invstring(struct json_stream *result UNNEEDED, const char *invstring UNNEEDED)
+{ fprintf(stderr, "json_add_invstring called!\n"); abort(); }
+/* Generated stub for json_add_node_id */
+void json_add_node_id(struct json_stream *response UNNEEDED,
+				const char *fieldname UNNEEDED,
+				const struct node_id *id UNNEEDED)
+{ fprintf(stderr, "json_add_node_id called!\n"); abort(); }
+/* Generated stub for json_add_num */
+void json_add_num(struct json_stream *result UNNEEDED, const char *fieldname UNNEEDED,
+		  unsigned int value UNNEEDED)
+{ fprintf(stderr, "json_add_num called!\n"); abort(); }
+/* Generated stub for json_add_preimage */
+void json_add_preimage(struct json_stream *result UNNEEDED, const char *fieldname UNNEEDED,
+		     const struct preimage *preimage UNNEEDED)
+{ fprintf(stderr, "json_add_preimage called!\n"); abort(); }
+/* Generated stub for json_add_secret */
+void json_add_secret(struct json_stream *response UNNEEDED,
+		     const char *fieldname UNNEEDED,
+		     const struct secret *secret UNNEEDED)
+{ fprintf(stderr, "json_add_secret called!\n"); abort(); }
+/* Generated stub for json_add_sha256 */
+void json_add_sha256(struct json_stream *result UNNEEDED, const char *fieldname UNNEEDED,
+		     const struct sha256 *hash UNNEEDED)
+{ fprintf(stderr, "json_add_sha256 called!\n"); abort(); }
+/* Generated stub for json_add_short_channel_id */
+void json_add_short_channel_id(struct json_stream *response UNNEEDED,
+			       const char *fieldname UNNEEDED,
+			       const struct short_channel_id *id UNNEEDED)
+{ fprintf(stderr, "json_add_short_channel_id called!\n"); abort(); }
+/* Generated stub for json_add_string */
+void json_add_string(struct json_stream *js UNNEEDED,
+		     const char *fieldname UNNEEDED,
+		     const char *str TAKES UNNEEDED)
+{ fprintf(stderr, "json_add_string called!\n"); abort(); }
+/* Generated stub for json_add_timeabs */
+void json_add_timeabs(struct json_stream *result UNNEEDED, const char *fieldname UNNEEDED,
+		      struct timeabs t UNNEEDED)
+{ fprintf(stderr, "json_add_timeabs called!\n"); abort(); }
+/* Generated stub for json_add_u32 */
+void json_add_u32(struct json_stream *result UNNEEDED, const char *fieldname UNNEEDED,
+		  uint32_t value UNNEEDED)
+{ fprintf(stderr, "json_add_u32 called!\n"); abort(); }
+/* Generated stub for json_add_u64 */
+void json_add_u64(struct json_stream *result UNNEEDED, const char *fieldname UNNEEDED,
+		  uint64_t value UNNEEDED)
+{ fprintf(stderr, "json_add_u64 called!\n"); abort(); }
+/* Generated stub for json_array_end */
+void json_array_end(struct json_stream *js UNNEEDED)
+{ fprintf(stderr, "json_array_end called!\n"); abort(); }
+/* Generated stub for json_array_start */
+void json_array_start(struct json_stream *js UNNEEDED, const char *fieldname UNNEEDED)
+{ fprintf(stderr, "json_array_start called!\n"); abort(); }
+/* Generated stub for json_get_member */
+const jsmntok_t *json_get_member(const char *buffer UNNEEDED, const jsmntok_t tok[] UNNEEDED,
+				 const char *label UNNEEDED)
+{ fprintf(stderr, "json_get_member called!\n"); abort(); }
+/* Generated stub for json_id_prefix */
+const char *json_id_prefix(const tal_t *ctx UNNEEDED, const struct command *cmd UNNEEDED)
+{ fprintf(stderr, "json_id_prefix called!\n"); abort(); }
+/* Generated stub for json_next */
+const jsmntok_t *json_next(const jsmntok_t *tok UNNEEDED)
+{ fprintf(stderr, "json_next called!\n"); abort(); }
+/* Generated stub for json_object_end */
+void json_object_end(struct json_stream *js UNNEEDED)
+{ fprintf(stderr, "json_object_end called!\n"); abort(); }
+/* Generated stub for json_object_start */
+void json_object_start(struct json_stream *ks UNNEEDED, const char *fieldname UNNEEDED)
+{ fprintf(stderr, "json_object_start called!\n"); abort(); }
+/* Generated stub for json_strdup */
+char *json_strdup(const tal_t *ctx UNNEEDED, const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED)
+{ fprintf(stderr, "json_strdup called!\n"); abort(); }
+/* Generated stub for json_to_int */
+bool json_to_int(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED, int *num UNNEEDED)
+{ fprintf(stderr, "json_to_int called!\n"); abort(); }
+/* Generated stub for json_to_listpeers_channels */
+struct listpeers_channel **json_to_listpeers_channels(const tal_t *ctx UNNEEDED,
+						      const char *buffer UNNEEDED,
+						      const jsmntok_t *tok UNNEEDED)
+{ fprintf(stderr, "json_to_listpeers_channels called!\n"); abort(); }
+/* Generated stub for json_to_msat */
+bool json_to_msat(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+		  struct amount_msat *msat UNNEEDED)
+{ fprintf(stderr, "json_to_msat called!\n"); abort(); }
+/* Generated stub for json_to_node_id */
+bool json_to_node_id(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+			       struct node_id *id UNNEEDED)
+{ fprintf(stderr, "json_to_node_id called!\n"); abort(); }
+/* Generated stub for json_to_number */
+bool json_to_number(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+		    unsigned int *num UNNEEDED)
+{ fprintf(stderr, "json_to_number called!\n"); abort(); }
+/* Generated stub for json_to_preimage */
+bool json_to_preimage(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED, struct preimage *preimage UNNEEDED)
+{ fprintf(stderr, "json_to_preimage called!\n"); abort(); }
+/* Generated stub for json_to_sat */
+bool json_to_sat(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+		 struct amount_sat *sat UNNEEDED)
+{ fprintf(stderr, "json_to_sat called!\n"); abort(); }
+/* Generated stub for json_to_sha256 */
+bool json_to_sha256(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED, struct sha256 *dest UNNEEDED)
+{ fprintf(stderr, "json_to_sha256 called!\n"); abort(); }
+/* Generated stub for json_to_short_channel_id */
+bool json_to_short_channel_id(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+			      struct short_channel_id *scid UNNEEDED)
+{ fprintf(stderr, "json_to_short_channel_id called!\n"); abort(); }
+/* Generated stub for json_to_u16 */
+bool json_to_u16(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+                 uint16_t *num UNNEEDED)
+{ fprintf(stderr, "json_to_u16 called!\n"); abort(); }
+/* Generated stub for json_to_u32 */
+bool json_to_u32(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED, u32 *num UNNEEDED)
+{ fprintf(stderr, "json_to_u32 called!\n"); abort(); }
+/* Generated stub for json_to_u64 */
+bool json_to_u64(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED, u64 *num UNNEEDED)
+{ fprintf(stderr, "json_to_u64 called!\n"); abort(); }
+/* Generated stub for json_tok_bin_from_hex */
+u8 *json_tok_bin_from_hex(const tal_t *ctx UNNEEDED, const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED)
+{ fprintf(stderr, "json_tok_bin_from_hex called!\n"); abort(); }
+/* Generated stub for json_tok_full */
+const char *json_tok_full(const char *buffer UNNEEDED, const jsmntok_t *t UNNEEDED)
+{ fprintf(stderr, "json_tok_full called!\n"); abort(); }
+/* Generated stub for json_tok_full_len */
+int json_tok_full_len(const jsmntok_t *t UNNEEDED)
+{ fprintf(stderr, "json_tok_full_len called!\n"); abort(); }
+/* Generated stub for json_tok_streq */
+bool json_tok_streq(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED, const char *str UNNEEDED)
+{ fprintf(stderr, "json_tok_streq called!\n"); abort(); }
+/* Generated stub for jsonrpc_request_start_ */
+struct out_req *jsonrpc_request_start_(struct plugin *plugin UNNEEDED,
+				       struct command *cmd UNNEEDED,
+				       const char *method UNNEEDED,
+				       const char *id_prefix UNNEEDED,
+				       struct command_result *(*cb)(struct command *command UNNEEDED,
+								    const char *buf UNNEEDED,
+								    const jsmntok_t *result UNNEEDED,
+								    void *arg) UNNEEDED,
+				       struct command_result *(*errcb)(struct command *command UNNEEDED,
+								       const char *buf UNNEEDED,
+								       const jsmntok_t *result UNNEEDED,
+								       void *arg) UNNEEDED,
+				       void *arg UNNEEDED)
+{ fprintf(stderr, "jsonrpc_request_start_ called!\n"); abort(); }
+/* Generated stub for jsonrpc_stream_fail */
+struct json_stream *jsonrpc_stream_fail(struct command *cmd UNNEEDED,
+					int code UNNEEDED,
+					const char *err UNNEEDED)
+{ fprintf(stderr, "jsonrpc_stream_fail called!\n"); abort(); }
+/* Generated stub for jsonrpc_stream_success */
+struct json_stream *jsonrpc_stream_success(struct command *cmd UNNEEDED)
+{ fprintf(stderr, "jsonrpc_stream_success called!\n"); abort(); }
+/* Generated stub for notification_handled */
+struct command_result *notification_handled(struct command *cmd UNNEEDED)
+{ fprintf(stderr, "notification_handled called!\n"); abort(); }
+/* Generated stub for plugin_err */
+void  plugin_err(struct plugin *p UNNEEDED, const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "plugin_err called!\n"); abort(); }
+/* Generated stub for plugin_log */
+void plugin_log(struct plugin *p UNNEEDED, enum log_level l UNNEEDED, const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "plugin_log called!\n"); abort(); }
+/* Generated stub for plugin_notification_end */
+void plugin_notification_end(struct plugin *plugin UNNEEDED,
+			     struct json_stream *stream TAKES UNNEEDED)
+{ fprintf(stderr, "plugin_notification_end called!\n"); abort(); }
+/* Generated stub for plugin_notification_start */
+struct json_stream *plugin_notification_start(struct plugin *plugins UNNEEDED,
+					      const char *method UNNEEDED)
+{ fprintf(stderr, "plugin_notification_start called!\n"); abort(); }
+/* Generated stub for random_select */
+bool random_select(double weight UNNEEDED, double *tot_weight UNNEEDED)
+{ fprintf(stderr, "random_select called!\n"); abort(); }
+/* Generated stub for send_outreq */
+struct command_result *send_outreq(struct plugin *plugin UNNEEDED,
+				   const struct out_req *req UNNEEDED)
+{ fprintf(stderr, "send_outreq called!\n"); abort(); }
+/* Generated stub for serialize_onionpacket */
+u8 *serialize_onionpacket(
+	const tal_t *ctx UNNEEDED,
+	const struct onionpacket *packet UNNEEDED)
+{ fprintf(stderr, "serialize_onionpacket called!\n"); abort(); }
+/* Generated stub for sphinx_add_hop */
+void sphinx_add_hop(struct sphinx_path *path UNNEEDED, const struct pubkey *pubkey UNNEEDED,
+		    const u8 *payload TAKES UNNEEDED)
+{ fprintf(stderr, "sphinx_add_hop called!\n"); abort(); }
+/* Generated stub for sphinx_path_new */
+struct sphinx_path *sphinx_path_new(const tal_t *ctx UNNEEDED,
+				    const u8 *associated_data UNNEEDED)
+{ fprintf(stderr, "sphinx_path_new called!\n"); abort(); }
+/* Generated stub for sphinx_path_new_with_key */
+struct sphinx_path *sphinx_path_new_with_key(const tal_t *ctx UNNEEDED,
+					     const u8 *associated_data UNNEEDED,
+					     const struct secret *session_key UNNEEDED)
+{ fprintf(stderr, "sphinx_path_new_with_key called!\n"); abort(); }
+/* Generated stub for sphinx_path_payloads_size */
+size_t sphinx_path_payloads_size(const struct sphinx_path *path UNNEEDED)
+{ fprintf(stderr, "sphinx_path_payloads_size called!\n"); abort(); }
+/* Generated stub for towire_bigsize */
+void towire_bigsize(u8 **pptr UNNEEDED, const bigsize_t val UNNEEDED)
+{ fprintf(stderr, "towire_bigsize called!\n"); abort(); }
+/* Generated stub for towire_channel_id */
+void towire_channel_id(u8 **pptr UNNEEDED, const struct channel_id *channel_id UNNEEDED)
+{ fprintf(stderr, "towire_channel_id called!\n"); abort(); }
+/* AUTOGENERATED MOCKS END */
+
+/* route() keeps a route cache */
+void *notleak_(void *ptr, bool plus_children UNNEEDED)
+{
+	return ptr;
+}
+
+#ifndef SUPERVERBOSE
+#define SUPERVERBOSE(...)
+#endif
+
+static void write_to_store(int store_fd, const u8 *msg)
+{
+	struct gossip_hdr hdr;
+
+	hdr.flags = cpu_to_be16(0);
+	hdr.len = cpu_to_be16(tal_count(msg));
+	/* We don't actually check these! */
+	hdr.crc = 0;
+	hdr.timestamp = 0;
+	assert(write(store_fd, &hdr, sizeof(hdr)) == sizeof(hdr));
+	assert(write(store_fd, msg, tal_count(msg)) == tal_count(msg));
+}
+
+static void update_connection(int store_fd,
+			      const struct node_id *from,
+			      const struct node_id *to,
+			      const struct short_channel_id *scid,
+			      struct amount_msat min,
+			      struct amount_msat max,
+			      u32 base_fee, s32 proportional_fee,
+			      u32 delay,
+			      bool disable)
+{
+	secp256k1_ecdsa_signature dummy_sig;
+	u8 *msg;
+
+	/* So valgrind doesn't complain */
+	memset(&dummy_sig, 0, sizeof(dummy_sig));
+
+	msg = towire_channel_update(tmpctx,
+				    &dummy_sig,
+				    &chainparams->genesis_blockhash,
+				    scid, 0,
+				    ROUTING_OPT_HTLC_MAX_MSAT,
+				    node_id_idx(from, to)
+				    + (disable ? ROUTING_FLAGS_DISABLED : 0),
+				    delay,
+				    min,
+				    base_fee,
+				    proportional_fee,
+				    max);
+
+	write_to_store(store_fd, msg);
+}
+
+static void add_connection(int store_fd,
+			   const struct node_id *from,
+			   const struct node_id *to,
+			   const struct short_channel_id *scid,
+			   struct amount_msat min,
+			   struct amount_msat max,
+			   u32 base_fee, s32 proportional_fee,
+			   u32 delay)
+{
+	secp256k1_ecdsa_signature dummy_sig;
+	struct secret not_a_secret;
+	struct pubkey dummy_key;
+	u8 *msg;
+	const struct node_id *ids[2];
+
+	/* So valgrind doesn't complain */
+	memset(&dummy_sig, 0, sizeof(dummy_sig));
+	memset(&not_a_secret, 1, sizeof(not_a_secret));
+	pubkey_from_secret(&not_a_secret, &dummy_key);
+
+	if (node_id_cmp(from, to) > 0) {
+		ids[0] = to;
+		ids[1] = from;
+	} else {
+		ids[0] = from;
+		ids[1] = to;
+	}
+	msg = towire_channel_announcement(tmpctx, &dummy_sig, &dummy_sig,
+					  &dummy_sig, &dummy_sig,
+					  /* features */ NULL,
+					  &chainparams->genesis_blockhash,
+					  scid,
+					  ids[0], ids[1],
+					  &dummy_key, &dummy_key);
+	write_to_store(store_fd, msg);
+
+	update_connection(store_fd, from, to, scid, min, max,
+			  base_fee, proportional_fee,
+			  delay, false);
+}
+
+static void node_id_from_privkey(const struct privkey *p, struct node_id *id)
+{
+	struct pubkey k;
+	pubkey_from_privkey(p, &k);
+	node_id_from_pubkey(id, &k);
+}
+
+static void node_id_from_index(size_t i, struct node_id *id)
+{
+	struct privkey tmp;
+
+	memset(&tmp, 0, sizeof(tmp));
+	tmp.secret.data[0] = 1;
+	memcpy(tmp.secret.data + 1, &i, sizeof(i));
+	node_id_from_privkey(&tmp, id);
+}
+
+/* Zipf(1): destination k (from 1) is paid with weight 1/k. */
+static size_t zipf_pick(const double *cdf, size_t n)
+{
+	double r = pseudorand_double() * cdf[n-1];
+	size_t lo = 0, hi = n - 1;
+
+	while (lo < hi) {
+		size_t mid = (lo + hi) / 2;
+		if (cdf[mid] < r)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+static void check_route(const struct route_hop *r,
+			const struct node_id *dst,
+			struct amount_msat amount, u32 final_cltv)
+{
+	size_t n = tal_count(r);
+
+	assert(n > 0);
+	assert(node_id_eq(&r[n-1].node_id, dst));
+	assert(amount_msat_eq(r[n-1].amount, amount));
+	assert(r[n-1].delay == final_cltv);
+	for (size_t i = 0; i + 1 < n; i++) {
+		assert(amount_msat_greater_eq(r[i].amount, r[i+1].amount));
+		assert(r[i].delay >= r[i+1].delay);
+	}
+}
+
+static bool same_path(const struct route_hop *a, const struct route_hop *b)
+{
+	if (tal_count(a) != tal_count(b))
+		return false;
+	for (size_t i = 0; i < tal_count(a); i++) {
+		if (!short_channel_id_eq(&a[i].scid, &b[i].scid)
+		    || a[i].direction != b[i].direction)
+			return false;
+	}
+	return true;
+}
+
+/* Replays the payments, returning the routes. */
+static struct route_hop **replay(const tal_t *ctx,
+				 struct payment *p,
+				 const struct node_id *ids,
+				 const size_t *dests,
+				 const struct amount_msat *amounts,
+				 size_t num_payments)
+{
+	struct route_hop **routes = tal_arr(ctx, struct route_hop *,
+					    num_payments);
+	const struct gossmap_node *src;
+
+	src = gossmap_find_node(global_gossmap, &ids[0]);
+	for (size_t i = 0; i < num_payments; i++) {
+		const struct gossmap_node *dst;
+		struct route_hop *r;
+		const char *errmsg;
+
+		dst = gossmap_find_node(global_gossmap, &ids[dests[i]]);
+		r = route(tmpctx, global_gossmap, src, dst, amounts[i], 18,
+			  10.0 / 1000000.0, ROUTING_MAX_HOPS, p, &errmsg);
+		check_route(r, &ids[dests[i]], amounts[i], 18);
+		routes[i] = tal_steal(routes, r);
+	}
+	return routes;
+}
+
+/* A canned network: a ring (so everyone's reachable) plus random
+ * channels with random fees.  Node 0 is us. */
+int main(int argc, char *argv[])
+{
+	struct node_id *ids;
+	int store_fd;
+	struct payment *p;
+	struct payment_modifier **mods;
+	char gossip_version = 10;
+	char *gossipfilename;
+	size_t num_nodes = 50, num_dests = 5, num_payments = 200, *dests;
+	struct amount_msat *amounts;
+	struct short_channel_id scid;
+	struct route_hop **uncached, **cached;
+	size_t num_same;
+	double *cdf;
+	const struct gossmap_node *src, *dst;
+	struct cached_route *cr;
+	struct route_cache_key key;
+	struct route_hop *r;
+	const char *errmsg;
+
+	common_setup(argv[0]);
+	chainparams = chainparams_for_network("regtest");
+
+	store_fd = tmpdir_mkstemp(tmpctx, "run-route_cache.XXXXXX", &gossipfilename);
+	assert(write(store_fd, &gossip_version, sizeof(gossip_version))
+	       == sizeof(gossip_version));
+	global_gossmap = gossmap_load(tmpctx, gossipfilename, NULL);
+
+	ids = tal_arr(tmpctx, struct node_id, num_nodes);
+	for (size_t i = 0; i < num_nodes; i++)
+		node_id_from_index(i, &ids[i]);
+
+	mods = tal_arrz(tmpctx, struct payment_modifier *, 1);
+	p = payment_new(mods, tal(tmpctx, struct command), NULL, mods);
+
+	for (size_t i = 0; i < num_nodes; i++) {
+		if (!mk_short_channel_id(&scid, i + 1, 0, 0))
+			abort();
+		add_connection(store_fd, &ids[i], &ids[(i + 1) % num_nodes],
+			       &scid,
+			       AMOUNT_MSAT(0), AMOUNT_MSAT(1000000 * 1000),
+			       1000, 1000, 6);
+		for (size_t j = 1; j < 4; j++) {
+			size_t peer = pseudorand(num_nodes);
+			if (peer == i)
+				continue;
+			if (!mk_short_channel_id(&scid, i + 1, j, 0))
+				abort();
+			add_connection(store_fd, &ids[i], &ids[peer], &scid,
+				       AMOUNT_MSAT(0),
+				       AMOUNT_MSAT(1000000 * 1000),
+				       pseudorand(1000), pseudorand(1000),
+				       6 + pseudorand(140));
+		}
+	}
+	assert(gossmap_refresh(global_gossmap, NULL));
+
+	/* Destinations are nodes 1..num_dests, most popular first. */
+	cdf = tal_arr(tmpctx, double, num_dests);
+	for (size_t k = 0; k < num_dests; k++)
+		cdf[k] = (k ? cdf[k-1] : 0) + 1.0 / (k + 1);
+
+	dests = tal_arr(tmpctx, size_t, num_payments);
+	amounts = tal_arr(tmpctx, struct amount_msat, num_payments);
+	for (size_t i = 0; i < num_payments; i++) {
+		dests[i] = 1 + zipf_pick(cdf, num_dests);
+		amounts[i] = amount_msat(50000 + pseudorand(450000));
+	}
+
+	route_cache_max = 0;
+	uncached = replay(tmpctx, p, ids, dests, amounts, num_payments);
+	assert(!route_cache);
+
+	/* Cached routes may take a path found for another amount in the same
+	 * bucket, but where the path is the same, so is the pricing. */
+	route_cache_max = ROUTE_CACHE_MAX;
+	cached = replay(tmpctx, p, ids, dests, amounts, num_payments);
+	assert(route_cache_num > 0);
+	assert(route_cache_num <= route_cache_max);
+	num_same = 0;
+	for (size_t i = 0; i < num_payments; i++) {
+		if (!same_path(cached[i], uncached[i]))
+			continue;
+		for (size_t h = 0; h < tal_count(cached[i]); h++) {
+			assert(amount_msat_eq(cached[i][h].amount,
+					      uncached[i][h].amount));
+			assert(cached[i][h].delay == uncached[i][h].delay);
+		}
+		num_same++;
+	}
+	assert(num_same > 0);
+
+	/* Shrinking the cache throws away the least recently used, once
+	 * we add more (these amounts are all in a new bucket). */
+	for (size_t i = 0; i < 100; i++)
+		amounts[i] = amount_msat(5000000 + pseudorand(1000000));
+	route_cache_max = 10;
+	replay(tmpctx, p, ids, dests, amounts, 100);
+	assert(route_cache_num == route_cache_max);
+
+	/* Now the most popular destination is definitely cached. */
+	src = gossmap_find_node(global_gossmap, &ids[0]);
+	dst = gossmap_find_node(global_gossmap, &ids[1]);
+	r = route(tmpctx, global_gossmap, src, dst, AMOUNT_MSAT(100000), 18,
+		  10.0 / 1000000.0, ROUTING_MAX_HOPS, p, &errmsg);
+	cr = list_top(&route_cache_lru, struct cached_route, list);
+	assert(node_id_eq(&cr->key.dst, &ids[1]));
+	assert(tal_count(cr->hops) == tal_count(r));
+	key = cr->key;
+
+	/* A failure on one of its channels forgets it. */
+	route_cache_forget_chan(&r[0].scid, r[0].direction);
+	assert(!route_cache_map_get(route_cache, &key));
+
+	/* So does a new channel_update on it. */
+	r = route(tmpctx, global_gossmap, src, dst, AMOUNT_MSAT(100000), 18,
+		  10.0 / 1000000.0, ROUTING_MAX_HOPS, p, &errmsg);
+	cr = list_top(&route_cache_lru, struct cached_route, list);
+	assert(node_id_eq(&cr->key.dst, &ids[1]));
+	update_connection(store_fd, &ids[0], &r[0].node_id, &r[0].scid,
+			  AMOUNT_MSAT(0), AMOUNT_MSAT(1000000 * 1000),
+			  cr->hops[0].base_fee + 1,
+			  cr->hops[0].proportional_fee,
+			  cr->hops[0].delay, false);
+	assert(gossmap_refresh(global_gossmap, NULL));
+	src = gossmap_find_node(global_gossmap, &ids[0]);
+	dst = gossmap_find_node(global_gossmap, &ids[1]);
+	assert(!route_cache_get(tmpctx, global_gossmap, src, dst,
+				AMOUNT_MSAT(100000), 18, 10.0 / 1000000.0,
+				ROUTING_MAX_HOPS, p));
+	assert(!route_cache_map_get(route_cache, &key));
+
+	common_shutdown();
+	return 0;
+}
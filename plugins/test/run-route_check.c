@@ -0,0 +1,490 @@
+#include "config.h"
+#include "../libplugin-pay.c"
+#include <bitcoin/chainparams.h>
+#include <common/gossip_store.h>
+#include <common/setup.h>
+#include <common/utils.h>
+#include <stdio.h>
+#include <unistd.h>
+
+/* AUTOGENERATED MOCKS START */
+/* Generated stub for blinded_onion_hops */
+u8 **blinded_onion_hops(const tal_t *ctx UNNEEDED,
+			struct amount_msat final_amount UNNEEDED,
+			u32 final_cltv UNNEEDED,
+			struct amount_msat total_amount UNNEEDED,
+			const struct blinded_path *path UNNEEDED)
+{ fprintf(stderr, "blinded_onion_hops called!\n"); abort(); }
+/* Generated stub for command_finished */
+struct command_result *command_finished(struct command *cmd UNNEEDED, struct json_stream *response UNNEEDED)
+{ fprintf(stderr, "command_finished called!\n"); abort(); }
+/* Generated stub for command_still_pending */
+struct command_result *command_still_pending(struct command *cmd UNNEEDED)
+{ fprintf(stderr, "command_still_pending called!\n"); abort(); }
+/* Generated stub for create_onionpacket */
+struct onionpacket *create_onionpacket(
+	const tal_t * ctx UNNEEDED,
+	struct sphinx_path *sp UNNEEDED,
+	size_t fixed_size UNNEEDED,
+	struct secret **path_secrets
+	UNNEEDED)
+{ fprintf(stderr, "create_onionpacket called!\n"); abort(); }
+/* Generated stub for feature_offered */
+bool feature_offered(const u8 *features UNNEEDED, size_t f UNNEEDED)
+{ fprintf(stderr, "feature_offered called!\n"); abort(); }
+/* Generated stub for fromwire_bigsize */
+bigsize_t fromwire_bigsize(const u8 **cursor UNNEEDED, size_t *max UNNEEDED)
+{ fprintf(stderr, "fromwire_bigsize called!\n"); abort(); }
+/* Generated stub for fromwire_channel_id */
+bool fromwire_channel_id(const u8 **cursor UNNEEDED, size_t *max UNNEEDED,
+			 struct channel_id *channel_id UNNEEDED)
+{ fprintf(stderr, "fromwire_channel_id called!\n"); abort(); }
+/* Generated stub for json_add_amount_msat */
+void json_add_amount_msat(struct json_stream *result UNNEEDED,
+			  const char *msatfieldname UNNEEDED,
+			  struct amount_msat msat)
+
+{ fprintf(stderr, "json_add_amount_msat called!\n"); abort(); }
+/* Generated stub for json_add_hex_talarr */
+void json_add_hex_talarr(struct json_stream *result UNNEEDED,
+			 const char *fieldname UNNEEDED,
+			 const tal_t *data UNNEEDED)
+{ fprintf(stderr, "json_add_hex_talarr called!\n"); abort(); }
+/* Generated stub for json_add_invstring */
+void json_add_invstring(struct json_stream *result UNNEEDED, const char *invstring UNNEEDED)
+{ fprintf(stderr, "json_add_invstring called!\n"); abort(); }
+/* Generated stub for json_add_node_id */
+void json_add_node_id(struct json_stream *response UNNEEDED,
+				const char *fieldname UNNEEDED,
+				const struct node_id *id UNNEEDED)
+{ fprintf(stderr, "json_add_node_id called!\n"); abort(); }
+/* Generated stub for json_add_num */
+void json_add_num(struct json_stream *result UNNEEDED, const char *fieldname UNNEEDED,
+		  unsigned int value UNNEEDED)
+{ fprintf(stderr, "json_add_num called!\n"); abort(); }
+/* Generated stub for json_add_preimage */
+void json_add_preimage(struct json_stream *result UNNEEDED, const char *fieldname UNNEEDED,
+		     const struct preimage *preimage UNNEEDED)
+{ fprintf(stderr, "json_add_preimage called!\n"); abort(); }
+/* Generated stub for json_add_secret */
+void json_add_secret(struct json_stream *response UNNEEDED,
+		     const char *fieldname UNNEEDED,
+		     const struct secret *secret UNNEEDED)
+{ fprintf(stderr, "json_add_secret called!\n"); abort(); }
+/* Generated stub for json_add_sha256 */
+void json_add_sha256(struct json_stream *result UNNEEDED, const char *fieldname UNNEEDED,
+		     const struct sha256 *hash UNNEEDED)
+{ fprintf(stderr, "json_add_sha256 called!\n"); abort(); }
+/* Generated stub for json_add_short_channel_id */
+void json_add_short_channel_id(struct json_stream *response UNNEEDED,
+			       const char *fieldname UNNEEDED,
+			       const struct short_channel_id *id UNNEEDED)
+{ fprintf(stderr, "json_add_short_channel_id called!\n"); abort(); }
+/* Generated stub for json_add_string */
+void json_add_string(struct json_stream *js UNNEEDED,
+		     const char *fieldname UNNEEDED,
+		     const char *str TAKES UNNEEDED)
+{ fprintf(stderr, "json_add_string called!\n"); abort(); }
+/* Generated stub for json_add_timeabs */
+void json_add_timeabs(struct json_stream *result UNNEEDED, const char *fieldname UNNEEDED,
+		      struct timeabs t UNNEEDED)
+{ fprintf(stderr, "json_add_timeabs called!\n"); abort(); }
+/* Generated stub for json_add_u32 */
+void json_add_u32(struct json_stream *result UNNEEDED, const char *fieldname UNNEEDED,
+		  uint32_t value UNNEEDED)
+{ fprintf(stderr, "json_add_u32 called!\n"); abort(); }
+/* Generated stub for json_add_u64 */
+void json_add_u64(struct json_stream *result UNNEEDED, const char *fieldname UNNEEDED,
+		  uint64_t value UNNEEDED)
+{ fprintf(stderr, "json_add_u64 called!\n"); abort(); }
+/* Generated stub for json_array_end */
+void json_array_end(struct json_stream *js UNNEEDED)
+{ fprintf(stderr, "json_array_end called!\n"); abort(); }
+/* Generated stub for json_array_start */
+void json_array_start(struct json_stream *js UNNEEDED, const char *fieldname UNNEEDED)
+{ fprintf(stderr, "json_array_start called!\n"); abort(); }
+/* Generated stub for json_get_member */
+const jsmntok_t *json_get_member(const char *buffer UNNEEDED, const jsmntok_t tok[] UNNEEDED,
+				 const char *label UNNEEDED)
+{ fprintf(stderr, "json_get_member called!\n"); abort(); }
+/* Generated stub for json_id_prefix */
+const char *json_id_prefix(const tal_t *ctx UNNEEDED, const struct command *cmd UNNEEDED)
+{ fprintf(stderr, "json_id_prefix called!\n"); abort(); }
+/* Generated stub for json_next */
+const jsmntok_t *json_next(const jsmntok_t *tok UNNEEDED)
+{ fprintf(stderr, "json_next called!\n"); abort(); }
+/* Generated stub for json_object_end */
+void json_object_end(struct json_stream *js UNNEEDED)
+{ fprintf(stderr, "json_object_end called!\n"); abort(); }
+/* Generated stub for json_object_start */
+void json_object_start(struct json_stream *ks UNNEEDED, const char *fieldname UNNEEDED)
+{ fprintf(stderr, "json_object_start called!\n"); abort(); }
+/* Generated stub for json_strdup */
+char *json_strdup(const tal_t *ctx UNNEEDED, const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED)
+{ fprintf(stderr, "json_strdup called!\n"); abort(); }
+/* Generated stub for json_to_int */
+bool json_to_int(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED, int *num UNNEEDED)
+{ fprintf(stderr, "json_to_int called!\n"); abort(); }
+/* Generated stub for json_to_listpeers_channels */
+struct listpeers_channel **json_to_listpeers_channels(const tal_t *ctx UNNEEDED,
+						      const char *buffer UNNEEDED,
+						      const jsmntok_t *tok UNNEEDED)
+{ fprintf(stderr, "json_to_listpeers_channels called!\n"); abort(); }
+/* Generated stub for json_to_msat */
+bool json_to_msat(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+		  struct amount_msat *msat UNNEEDED)
+{ fprintf(stderr, "json_to_msat called!\n"); abort(); }
+/* Generated stub for json_to_node_id */
+bool json_to_node_id(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+			       struct node_id *id UNNEEDED)
+{ fprintf(stderr, "json_to_node_id called!\n"); abort(); }
+/* Generated stub for json_to_number */
+bool json_to_number(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+		    unsigned int *num UNNEEDED)
+{ fprintf(stderr, "json_to_number called!\n"); abort(); }
+/* Generated stub for json_to_preimage */
+bool json_to_preimage(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED, struct preimage *preimage UNNEEDED)
+{ fprintf(stderr, "json_to_preimage called!\n"); abort(); }
+/* Generated stub for json_to_sat */
+bool json_to_sat(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+		 struct amount_sat *sat UNNEEDED)
+{ fprintf(stderr, "json_to_sat called!\n"); abort(); }
+/* Generated stub for json_to_sha256 */
+bool json_to_sha256(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED, struct sha256 *dest UNNEEDED)
+{ fprintf(stderr, "json_to_sha256 called!\n"); abort(); }
+/* Generated stub for json_to_short_channel_id */
+bool json_to_short_channel_id(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+			      struct short_channel_id *scid UNNEEDED)
+{ fprintf(stderr, "json_to_short_channel_id called!\n"); abort(); }
+/* Generated stub for json_to_u16 */
+bool json_to_u16(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+                 uint16_t *num UNNEEDED)
+{ fprintf(stderr, "json_to_u16 called!\n"); abort(); }
+/* Generated stub for json_to_u32 */
+bool json_to_u32(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED, u32 *num UNNEEDED)
+{ fprintf(stderr, "json_to_u32 called!\n"); abort(); }
+/* Generated stub for json_to_u64 */
+bool json_to_u64(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED, u64 *num UNNEEDED)
+{ fprintf(stderr, "json_to_u64 called!\n"); abort(); }
+/* Generated stub for json_tok_bin_from_hex */
+u8 *json_tok_bin_from_hex(const tal_t *ctx UNNEEDED, const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED)
+{ fprintf(stderr, "json_tok_bin_from_hex called!\n"); abort(); }
+/* Generated stub for json_tok_full */
+const char *json_tok_full(const char *buffer UNNEEDED, const jsmntok_t *t UNNEEDED)
+{ fprintf(stderr, "json_tok_full called!\n"); abort(); }
+/* Generated stub for json_tok_full_len */
+int json_tok_full_len(const jsmntok_t *t UNNEEDED)
+{ fprintf(stderr, "json_tok_full_len called!\n"); abort(); }
+/* Generated stub for json_tok_streq */
+bool json_tok_streq(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED, const char *str UNNEEDED)
+{ fprintf(stderr, "json_tok_streq called!\n"); abort(); }
+/* Generated stub for jsonrpc_request_start_ */
+struct out_req *jsonrpc_request_start_(struct plugin *plugin UNNEEDED,
+				       struct command *cmd UNNEEDED,
+				       const char *method UNNEEDED,
+				       const char *id_prefix UNNEEDED,
+				       struct command_result *(*cb)(struct command *command UNNEEDED,
+								    const char *buf UNNEEDED,
+								    const jsmntok_t *result UNNEEDED,
+								    void *arg) UNNEEDED,
+				       struct command_result *(*errcb)(struct command *command UNNEEDED,
+								       const char *buf UNNEEDED,
+								       const jsmntok_t *result UNNEEDED,
+								       void *arg) UNNEEDED,
+				       void *arg UNNEEDED)
+{ fprintf(stderr, "jsonrpc_request_start_ called!\n"); abort(); }
+/* Generated stub for jsonrpc_stream_fail */
+struct json_stream *jsonrpc_stream_fail(struct command *cmd UNNEEDED,
+					int code UNNEEDED,
+					const char *err UNNEEDED)
+{ fprintf(stderr, "jsonrpc_stream_fail called!\n"); abort(); }
+/* Generated stub for jsonrpc_stream_success */
+struct json_stream *jsonrpc_stream_success(struct command *cmd UNNEEDED)
+{ fprintf(stderr, "jsonrpc_stream_success called!\n"); abort(); }
+/* Generated stub for notification_handled */
+struct command_result *notification_handled(struct command *cmd UNNEEDED)
+{ fprintf(stderr, "notification_handled called!\n"); abort(); }
+/* Generated stub for notleak_ */
+void *notleak_(void *ptr UNNEEDED, bool plus_children UNNEEDED)
+{ fprintf(stderr, "notleak_ called!\n"); abort(); }
+/* Generated stub for plugin_err */
+void  plugin_err(struct plugin *p UNNEEDED, const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "plugin_err called!\n"); abort(); }
+/* Generated stub for plugin_log */
+void plugin_log(struct plugin *p UNNEEDED, enum log_level l UNNEEDED, const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "plugin_log called!\n"); abort(); }
+/* Generated stub for plugin_notification_end */
+void plugin_notification_end(struct plugin *plugin UNNEEDED,
+			     struct json_stream *stream TAKES UNNEEDED)
+{ fprintf(stderr, "plugin_notification_end called!\n"); abort(); }
+/* Generated stub for plugin_notification_start */
+struct json_stream *plugin_notification_start(struct plugin *plugins UNNEEDED,
+					      const char *method UNNEEDED)
+{ fprintf(stderr, "plugin_notification_start called!\n"); abort(); }
+/* Generated stub for random_select */
+bool random_select(double weight UNNEEDED, double *tot_weight UNNEEDED)
+{ fprintf(stderr, "random_select called!\n"); abort(); }
+/* Generated stub for send_outreq */
+struct command_result *send_outreq(struct plugin *plugin UNNEEDED,
+				   const struct out_req *req UNNEEDED)
+{ fprintf(stderr, "send_outreq called!\n"); abort(); }
+/* Generated stub for serialize_onionpacket */
+u8 *serialize_onionpacket(
+	const tal_t *ctx UNNEEDED,
+	const struct onionpacket *packet UNNEEDED)
+{ fprintf(stderr, "serialize_onionpacket called!\n"); abort(); }
+/* Generated stub for sphinx_add_hop */
+void sphinx_add_hop(struct sphinx_path *path UNNEEDED, const struct pubkey *pubkey UNNEEDED,
+		    const u8 *payload TAKES UNNEEDED)
+{ fprintf(stderr, "sphinx_add_hop called!\n"); abort(); }
+/* Generated stub for sphinx_path_new */
+struct sphinx_path *sphinx_path_new(const tal_t *ctx UNNEEDED,
+				    const u8 *associated_data UNNEEDED)
+{ fprintf(stderr, "sphinx_path_new called!\n"); abort(); }
+/* Generated stub for sphinx_path_new_with_key */
+struct sphinx_path *sphinx_path_new_with_key(const tal_t *ctx UNNEEDED,
+					     const u8 *associated_data UNNEEDED,
+					     const struct secret *session_key UNNEEDED)
+{ fprintf(stderr, "sphinx_path_new_with_key called!\n"); abort(); }
+/* Generated stub for sphinx_path_payloads_size */
+size_t sphinx_path_payloads_size(const struct sphinx_path *path UNNEEDED)
+{ fprintf(stderr, "sphinx_path_payloads_size called!\n"); abort(); }
+/* Generated stub for towire_bigsize */
+void towire_bigsize(u8 **pptr UNNEEDED, const bigsize_t val UNNEEDED)
+{ fprintf(stderr, "towire_bigsize called!\n"); abort(); }
+/* Generated stub for towire_channel_id */
+void towire_channel_id(u8 **pptr UNNEEDED, const struct channel_id *channel_id UNNEEDED)
+{ fprintf(stderr, "towire_channel_id called!\n"); abort(); }
+/* AUTOGENERATED MOCKS END */
+
+/* A few hundred channels, and the kind of hint and exclusion sets a hard
+ * MPP payment ends up with. */
+#define NUM_NODES 200
+#define NUM_HINTS 2000
+#define NUM_EXCLUDED 1000
+
+static void write_to_store(int store_fd, const u8 *msg)
+{
+	struct gossip_hdr hdr;
+
+	hdr.flags = cpu_to_be16(0);
+	hdr.len = cpu_to_be16(tal_count(msg));
+	/* We don't actually check these! */
+	hdr.crc = 0;
+	hdr.timestamp = 0;
+	assert(write(store_fd, &hdr, sizeof(hdr)) == sizeof(hdr));
+	assert(write(store_fd, msg, tal_count(msg)) == tal_count(msg));
+}
+
+static void add_connection(int store_fd,
+			   const struct node_id *from,
+			   const struct node_id *to,
+			   const struct short_channel_id *scid)
+{
+	secp256k1_ecdsa_signature dummy_sig;
+	struct secret not_a_secret;
+	struct pubkey dummy_key;
+	const struct node_id *ids[2];
+
+	/* So valgrind doesn't complain */
+	memset(&dummy_sig, 0, sizeof(dummy_sig));
+	memset(&not_a_secret, 1, sizeof(not_a_secret));
+	pubkey_from_secret(&not_a_secret, &dummy_key);
+
+	if (node_id_cmp(from, to) > 0) {
+		ids[0] = to;
+		ids[1] = from;
+	} else {
+		ids[0] = from;
+		ids[1] = to;
+	}
+	write_to_store(store_fd,
+		       towire_channel_announcement(tmpctx, &dummy_sig, &dummy_sig,
+						   &dummy_sig, &dummy_sig,
+						   /* features */ NULL,
+						   &chainparams->genesis_blockhash,
+						   scid,
+						   ids[0], ids[1],
+						   &dummy_key, &dummy_key));
+
+	for (int dir = 0; dir < 2; dir++)
+		write_to_store(store_fd,
+			       towire_channel_update(tmpctx,
+						     &dummy_sig,
+						     &chainparams->genesis_blockhash,
+						     scid, 0,
+						     ROUTING_OPT_HTLC_MAX_MSAT,
+						     dir, 0,
+						     AMOUNT_MSAT(0),
+						     0, 0,
+						     AMOUNT_MSAT(1000000 * 1000)));
+}
+
+static void node_id_from_privkey(const struct privkey *p, struct node_id *id)
+{
+	struct pubkey k;
+	pubkey_from_privkey(p, &k);
+	node_id_from_pubkey(id, &k);
+}
+
+/* channel_hints_update() logs, so we add them directly. */
+static void add_hint(struct payment *p,
+		     const struct short_channel_id *scid, int dir,
+		     bool enabled, struct amount_msat capacity)
+{
+	struct channel_hint *hint = tal(p->channel_hints, struct channel_hint);
+
+	hint->scid.scid = *scid;
+	hint->scid.dir = dir;
+	hint->enabled = enabled;
+	hint->estimated_capacity = capacity;
+	hint->local = NULL;
+	channel_hint_map_add(p->channel_hints, hint);
+}
+
+/* What payment_route_check did before it had hash tables: a linear scan
+ * of every hint and every excluded node. */
+static bool linear_route_check(const struct gossmap *gossmap,
+			       const struct gossmap_chan *c,
+			       int dir,
+			       struct amount_msat amount,
+			       const struct channel_hint *hints,
+			       const struct node_id *excluded)
+{
+	struct short_channel_id scid;
+	struct node_id dstid;
+
+	gossmap_node_get_id(gossmap, gossmap_nth_node(gossmap, c, !dir),
+			    &dstid);
+	for (size_t i = 0; i < tal_count(excluded); i++) {
+		if (node_id_eq(&dstid, &excluded[i]))
+			return false;
+	}
+
+	scid = gossmap_chan_scid(gossmap, c);
+	for (size_t i = 0; i < tal_count(hints); i++) {
+		if (!short_channel_id_eq(&scid, &hints[i].scid.scid)
+		    || dir != hints[i].scid.dir)
+			continue;
+		if (!hints[i].enabled)
+			return false;
+		if (amount_msat_greater_eq(amount, hints[i].estimated_capacity))
+			return false;
+		return true;
+	}
+	return true;
+}
+
+int main(int argc, char *argv[])
+{
+	struct node_id ids[NUM_NODES];
+	struct channel_hint *hint_arr;
+	struct node_id *excluded_arr;
+	struct channel_hint_map_iter it;
+	struct channel_hint *h;
+	struct payment *p;
+	struct payment_modifier **mods;
+	char gossip_version = 10;
+	char *gossipfilename;
+	int store_fd;
+	size_t num_ok = 0, num_checks = 0;
+	const struct amount_msat amount = AMOUNT_MSAT(500000000);
+
+	common_setup(argv[0]);
+	chainparams = chainparams_for_network("regtest");
+	store_fd = tmpdir_mkstemp(tmpctx, "run-route_check.XXXXXX", &gossipfilename);
+	assert(write(store_fd, &gossip_version, sizeof(gossip_version))
+	       == sizeof(gossip_version));
+
+	global_gossmap = gossmap_load(tmpctx, gossipfilename, NULL);
+
+	for (size_t i = 0; i < NUM_NODES; i++) {
+		struct privkey tmp;
+		memset(&tmp, i+1, sizeof(tmp));
+		node_id_from_privkey(&tmp, &ids[i]);
+	}
+
+	/* Each node is connected to the next, and to one a little further. */
+	for (size_t i = 0; i < NUM_NODES; i++) {
+		struct short_channel_id scid;
+
+		if (!mk_short_channel_id(&scid, i + 1, 0, 0))
+			abort();
+		add_connection(store_fd, &ids[i], &ids[(i + 1) % NUM_NODES],
+			       &scid);
+		if (!mk_short_channel_id(&scid, i + 1, 1, 0))
+			abort();
+		add_connection(store_fd, &ids[i], &ids[(i + 7) % NUM_NODES],
+			       &scid);
+	}
+	assert(gossmap_refresh(global_gossmap, NULL));
+
+	mods = tal_arrz(tmpctx, struct payment_modifier *, 1);
+	p = payment_new(mods, tal(tmpctx, struct command), NULL, mods);
+
+	/* Mostly hints for channels we've never heard of (routehints, or
+	 * channels which have since closed), and some which we have. */
+	for (size_t i = 0; i < NUM_HINTS; i++) {
+		struct short_channel_id scid;
+		int dir = i % 2;
+
+		if (i % 10 == 0) {
+			if (!mk_short_channel_id(&scid, i / 10 % NUM_NODES + 1,
+						 i / 10 / NUM_NODES, 0))
+				abort();
+		} else if (!mk_short_channel_id(&scid, 1000000 + i, 0, 0))
+			abort();
+		add_hint(p, &scid, dir, i % 3 != 0,
+			 amount_msat_div(AMOUNT_MSAT(1000000000), 1 + i % 4));
+	}
+
+	/* A few real nodes, and lots we'll never see. */
+	for (size_t i = 0; i < NUM_EXCLUDED; i++) {
+		struct node_id id;
+
+		if (i % 100 == 0)
+			id = ids[i / 100 * 13 % NUM_NODES];
+		else
+			memset(&id, i, sizeof(id));
+		payment_exclude_node(p, &id);
+	}
+
+	/* Gather the old-style arrays for comparison. */
+	hint_arr = tal_arr(tmpctx, struct channel_hint, 0);
+	for (h = channel_hint_map_first(p->channel_hints, &it);
+	     h;
+	     h = channel_hint_map_next(p->channel_hints, &it))
+		tal_arr_expand(&hint_arr, *h);
+	excluded_arr = tal_arr(tmpctx, struct node_id, 0);
+	for (size_t i = 0; i < NUM_EXCLUDED; i++) {
+		struct node_id id;
+
+		if (i % 100 == 0)
+			id = ids[i / 100 * 13 % NUM_NODES];
+		else
+			memset(&id, i, sizeof(id));
+		if (!node_is_excluded(p, &id))
+			abort();
+		tal_arr_expand(&excluded_arr, id);
+	}
+
+	/* Both must agree on every edge */
+	for (struct gossmap_chan *c = gossmap_first_chan(global_gossmap);
+	     c;
+	     c = gossmap_next_chan(global_gossmap, c)) {
+		for (int dir = 0; dir < 2; dir++) {
+			bool ok = payment_route_check(global_gossmap, c, dir,
+						      amount, p);
+			assert(ok == linear_route_check(global_gossmap, c, dir,
+							amount, hint_arr,
+							excluded_arr));
+			num_ok += ok;
+			num_checks++;
+		}
+	}
+	/* Make sure we're actually testing something. */
+	assert(num_ok > 0 && num_ok < num_checks);
+
+	common_shutdown();
+	return 0;
+}
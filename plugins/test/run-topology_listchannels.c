@@ -0,0 +1,363 @@
+#include "config.h"
+int unused_main(int argc, char *argv[]);
+#define main unused_main
+#include "../topology.c"
+#undef main
+#include <bitcoin/chainparams.h>
+#include <ccan/json_out/json_out.h>
+#include <common/gossip_store.h>
+#include <common/json_parse_simple.h>
+#include <common/setup.h>
+#include <common/utils.h>
+#include <stdio.h>
+#include <unistd.h>
+
+/* AUTOGENERATED MOCKS START */
+/* Generated stub for command_fail */
+struct command_result *command_fail(struct command *cmd UNNEEDED, enum jsonrpc_errcode code UNNEEDED,
+				    const char *fmt UNNEEDED, ...)
+
+{ fprintf(stderr, "command_fail called!\n"); abort(); }
+/* Generated stub for command_finished */
+struct command_result *command_finished(struct command *cmd UNNEEDED, struct json_stream *response UNNEEDED)
+{ fprintf(stderr, "command_finished called!\n"); abort(); }
+/* Generated stub for command_param_failed */
+struct command_result *command_param_failed(void)
+{ fprintf(stderr, "command_param_failed called!\n"); abort(); }
+/* Generated stub for jsonrpc_request_sync */
+const jsmntok_t *jsonrpc_request_sync(const tal_t *ctx UNNEEDED, struct plugin *plugin UNNEEDED,
+				      const char *method UNNEEDED,
+				      const struct json_out *params TAKES UNNEEDED,
+				      const char **resp UNNEEDED)
+{ fprintf(stderr, "jsonrpc_request_sync called!\n"); abort(); }
+/* Generated stub for jsonrpc_stream_success */
+struct json_stream *jsonrpc_stream_success(struct command *cmd UNNEEDED)
+{ fprintf(stderr, "jsonrpc_stream_success called!\n"); abort(); }
+/* Generated stub for memleak_scan_htable */
+void memleak_scan_htable(struct htable *memtable UNNEEDED, const struct htable *ht UNNEEDED)
+{ fprintf(stderr, "memleak_scan_htable called!\n"); abort(); }
+/* Generated stub for memleak_scan_obj */
+void memleak_scan_obj(struct htable *memtable UNNEEDED, const void *obj UNNEEDED)
+{ fprintf(stderr, "memleak_scan_obj called!\n"); abort(); }
+/* Generated stub for notification_handled */
+struct command_result *notification_handled(struct command *cmd UNNEEDED)
+{ fprintf(stderr, "notification_handled called!\n"); abort(); }
+/* Generated stub for param */
+bool param(struct command *cmd UNNEEDED, const char *buffer UNNEEDED,
+	   const jsmntok_t params[] UNNEEDED, ...)
+{ fprintf(stderr, "param called!\n"); abort(); }
+/* Generated stub for param_millionths */
+struct command_result *param_millionths(struct command *cmd UNNEEDED, const char *name UNNEEDED,
+					const char *buffer UNNEEDED,
+					const jsmntok_t *tok UNNEEDED, uint64_t **num UNNEEDED)
+{ fprintf(stderr, "param_millionths called!\n"); abort(); }
+/* Generated stub for param_msat */
+struct command_result *param_msat(struct command *cmd UNNEEDED, const char *name UNNEEDED,
+				  const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+				  struct amount_msat **msat UNNEEDED)
+{ fprintf(stderr, "param_msat called!\n"); abort(); }
+/* Generated stub for param_node_id */
+struct command_result *param_node_id(struct command *cmd UNNEEDED,
+				     const char *name UNNEEDED,
+				     const char *buffer UNNEEDED,
+				     const jsmntok_t *tok UNNEEDED,
+				     struct node_id **id UNNEEDED)
+{ fprintf(stderr, "param_node_id called!\n"); abort(); }
+/* Generated stub for param_number */
+struct command_result *param_number(struct command *cmd UNNEEDED, const char *name UNNEEDED,
+				    const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+				    unsigned int **num UNNEEDED)
+{ fprintf(stderr, "param_number called!\n"); abort(); }
+/* Generated stub for param_route_exclusion_array */
+struct command_result *param_route_exclusion_array(struct command *cmd UNNEEDED, const char *name UNNEEDED,
+					const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+					struct route_exclusion ***res UNNEEDED)
+{ fprintf(stderr, "param_route_exclusion_array called!\n"); abort(); }
+/* Generated stub for param_short_channel_id */
+struct command_result *param_short_channel_id(struct command *cmd UNNEEDED,
+					      const char *name UNNEEDED,
+					      const char *buffer UNNEEDED,
+					      const jsmntok_t *tok UNNEEDED,
+					      struct short_channel_id **scid UNNEEDED)
+{ fprintf(stderr, "param_short_channel_id called!\n"); abort(); }
+/* Generated stub for param_u32 */
+struct command_result *param_u32(struct command *cmd UNNEEDED, const char *name UNNEEDED,
+				 const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
+				 uint32_t **num UNNEEDED)
+{ fprintf(stderr, "param_u32 called!\n"); abort(); }
+/* Generated stub for plugin_err */
+void plugin_err(struct plugin *p UNNEEDED, const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "plugin_err called!\n"); abort(); }
+/* Generated stub for plugin_log */
+void plugin_log(struct plugin *p UNNEEDED, enum log_level l UNNEEDED, const char *fmt UNNEEDED, ...)
+{ fprintf(stderr, "plugin_log called!\n"); abort(); }
+/* Generated stub for plugin_main */
+void plugin_main(char *argv[] UNNEEDED,
+					const char *(*init)(struct plugin *p UNNEEDED,
+							    const char *buf UNNEEDED,
+							    const jsmntok_t *) UNNEEDED,
+					const enum plugin_restartability restartability UNNEEDED,
+					bool init_rpc UNNEEDED,
+					struct feature_set *features STEALS UNNEEDED,
+					const struct plugin_command *commands TAKES UNNEEDED,
+					size_t num_commands UNNEEDED,
+					const struct plugin_notification *notif_subs TAKES UNNEEDED,
+					size_t num_notif_subs UNNEEDED,
+					const struct plugin_hook *hook_subs TAKES UNNEEDED,
+					size_t num_hook_subs UNNEEDED,
+					const char **notif_topics TAKES UNNEEDED,
+					size_t num_notif_topics UNNEEDED,
+					...)
+{ fprintf(stderr, "plugin_main called!\n"); abort(); }
+/* Generated stub for plugin_notify_message */
+void plugin_notify_message(struct command *cmd UNNEEDED,
+			   enum log_level level UNNEEDED,
+			   const char *fmt UNNEEDED, ...)
+
+{ fprintf(stderr, "plugin_notify_message called!\n"); abort(); }
+/* Generated stub for plugin_set_memleak_handler */
+void plugin_set_memleak_handler(struct plugin *plugin UNNEEDED,
+				void (*mark_mem)(struct plugin *plugin UNNEEDED,
+						 struct htable *memtable))
+{ fprintf(stderr, "plugin_set_memleak_handler called!\n"); abort(); }
+/* Generated stub for rpc_scan */
+void rpc_scan(struct plugin *plugin UNNEEDED,
+	      const char *method UNNEEDED,
+	      const struct json_out *params TAKES UNNEEDED,
+	      const char *guide UNNEEDED,
+	      ...)
+{ fprintf(stderr, "rpc_scan called!\n"); abort(); }
+/* AUTOGENERATED MOCKS END */
+
+/* A small node: 20 channels, in a 200 channel network. */
+static u32 num_local = 20, num_chans = 200, num_nodes = 50;
+static struct pubkey dummy_key;
+
+static void write_to_store(int store_fd, const u8 *msg)
+{
+	struct gossip_hdr hdr;
+
+	hdr.flags = cpu_to_be16(0);
+	hdr.len = cpu_to_be16(tal_count(msg));
+	/* We don't actually check these! */
+	hdr.crc = 0;
+	hdr.timestamp = 0;
+	assert(write(store_fd, &hdr, sizeof(hdr)) == sizeof(hdr));
+	assert(write(store_fd, msg, tal_count(msg)) == tal_count(msg));
+}
+
+static void add_update(int store_fd,
+		       const struct short_channel_id *scid,
+		       int dir, u32 timestamp)
+{
+	secp256k1_ecdsa_signature dummy_sig;
+
+	/* So valgrind doesn't complain */
+	memset(&dummy_sig, 0, sizeof(dummy_sig));
+	write_to_store(store_fd,
+		       towire_channel_update(tmpctx,
+					     &dummy_sig,
+					     &chainparams->genesis_blockhash,
+					     scid, timestamp,
+					     ROUTING_OPT_HTLC_MAX_MSAT,
+					     dir,
+					     6,
+					     AMOUNT_MSAT(0),
+					     1000, 10,
+					     AMOUNT_MSAT(1000000 * 1000)));
+}
+
+static void add_channel(int store_fd,
+			const struct node_id *a,
+			const struct node_id *b,
+			const struct short_channel_id *scid,
+			u32 timestamp)
+{
+	secp256k1_ecdsa_signature dummy_sig;
+	const struct node_id *ids[2];
+
+	/* So valgrind doesn't complain */
+	memset(&dummy_sig, 0, sizeof(dummy_sig));
+
+	if (node_id_cmp(a, b) > 0) {
+		ids[0] = b;
+		ids[1] = a;
+	} else {
+		ids[0] = a;
+		ids[1] = b;
+	}
+	write_to_store(store_fd,
+		       towire_channel_announcement(tmpctx, &dummy_sig,
+						   &dummy_sig,
+						   &dummy_sig, &dummy_sig,
+						   /* features */ NULL,
+						   &chainparams->genesis_blockhash,
+						   scid,
+						   ids[0], ids[1],
+						   &dummy_key, &dummy_key));
+	add_update(store_fd, scid, 0, timestamp);
+	add_update(store_fd, scid, 1, timestamp);
+}
+
+static void make_node_id(struct node_id *id, u32 n)
+{
+	memset(id, 0, sizeof(*id));
+	id->k[0] = 0x02;
+	id->k[1] = n >> 24;
+	id->k[2] = n >> 16;
+	id->k[3] = n >> 8;
+	id->k[4] = n;
+}
+
+/* Returns the parsed result, with *num_entries set */
+static const jsmntok_t *listchannels(const char **buf,
+				     const struct listchannels_opts *opts,
+				     size_t *num_entries)
+{
+	struct json_stream *js = new_json_stream(tmpctx, NULL, NULL);
+	const jsmntok_t *toks;
+	size_t len;
+
+	json_object_start(js, NULL);
+	json_add_listchannels(js, get_gossmap(), opts);
+	json_object_end(js);
+
+	*buf = json_out_contents(js->jout, &len);
+	toks = json_parse_simple(tmpctx, *buf, len);
+	assert(toks);
+	*num_entries = json_get_member(*buf, toks, "channels")->size;
+	return toks;
+}
+
+int main(int argc, char *argv[])
+{
+	int store_fd;
+	char gossip_version = 10;
+	char *gossipfilename;
+	/* We clean tmpctx as we go, so these can't live there. */
+	const tal_t *ctx;
+	struct listchannels_opts *opts;
+	struct secret not_a_secret;
+	struct short_channel_id scid;
+	const char *buf;
+	const jsmntok_t *toks;
+	size_t num, total;
+
+	common_setup(argv[0]);
+	chainparams = chainparams_for_network("regtest");
+
+	memset(&not_a_secret, 1, sizeof(not_a_secret));
+	pubkey_from_secret(&not_a_secret, &dummy_key);
+
+	ctx = tal(NULL, char);
+	store_fd = tmpdir_mkstemp(ctx, "run-topology_listchannels.XXXXXX",
+				  &gossipfilename);
+	assert(write(store_fd, &gossip_version, sizeof(gossip_version))
+	       == sizeof(gossip_version));
+
+	make_node_id(&local_id, 0);
+	local_peers = tal(ctx, struct local_peer_map);
+	local_peer_map_init(local_peers);
+
+	/* Our channels come first, then random ones; timestamps increase
+	 * so half are "since" the middle one. */
+	for (u32 i = 0; i < num_chans; i++) {
+		struct node_id a, b;
+
+		if (!mk_short_channel_id(&scid, 100000 + i / 100, i % 100, 0))
+			abort();
+		if (i < num_local) {
+			a = local_id;
+			make_node_id(&b, i + 1);
+		} else {
+			u32 n1 = pseudorand(num_nodes) + 1, n2;
+			do {
+				n2 = pseudorand(num_nodes) + 1;
+			} while (n2 == n1);
+			make_node_id(&a, n1);
+			make_node_id(&b, n2);
+		}
+		add_channel(store_fd, &a, &b, &scid, 1000 + i);
+		clean_tmpctx();
+	}
+
+	global_gossmap = gossmap_load(ctx, gossipfilename, NULL);
+	assert(global_gossmap);
+
+	/* Every second peer is connected, every fourth also has a normal
+	 * channel: we forget the rest. */
+	for (u32 i = 0; i < num_local; i++) {
+		struct node_id peer;
+		struct local_peer *lp;
+		struct channel_id cid;
+
+		make_node_id(&peer, i + 1);
+		lp = get_local_peer(&peer);
+		lp->connected = (i % 2 == 0);
+		memset(&cid, 0, sizeof(cid));
+		memcpy(&cid, &i, sizeof(i));
+		local_channel_normal(lp, &cid, i % 4 == 0);
+		/* Setting it twice changes nothing */
+		local_channel_normal(lp, &cid, i % 4 == 0);
+		assert(tal_count(lp->normal) == (i % 4 == 0));
+		maybe_forget_local_peer(lp);
+	}
+	assert(local_peer_map_count(local_peers) == num_local / 2);
+
+	/* A local channel is active iff peer is connected and normal */
+	opts = talz(ctx, struct listchannels_opts);
+	for (u32 i = 0; i < 4; i++) {
+		const jsmntok_t *chan;
+		bool active;
+
+		if (!mk_short_channel_id(&scid, 100000, i, 0))
+			abort();
+		opts->scid = &scid;
+		toks = listchannels(&buf, opts, &num);
+		assert(num == 2);
+		chan = json_get_arr(json_get_member(buf, toks, "channels"), 0);
+		assert(json_to_bool(buf, json_get_member(buf, chan, "active"),
+				    &active));
+		assert(active == (i % 4 == 0));
+		clean_tmpctx();
+	}
+
+	opts->scid = NULL;
+	opts->source = &local_id;
+	listchannels(&buf, opts, &num);
+	assert(num == num_local);
+	clean_tmpctx();
+
+	/* Page through everything. */
+	opts->source = NULL;
+	opts->limit = tal(opts, u32);
+	opts->start = tal(opts, u32);
+	*opts->limit = 30;
+	*opts->start = 0;
+	total = 0;
+	for (;;) {
+		const jsmntok_t *nexttok;
+
+		toks = listchannels(&buf, opts, &num);
+		total += num;
+		nexttok = json_get_member(buf, toks, "next_start");
+		if (!nexttok)
+			break;
+		assert(num == *opts->limit * 2);
+		assert(json_to_u32(buf, nexttok, opts->start));
+		clean_tmpctx();
+	}
+	assert(total == num_chans * 2);
+
+	/* Only the newer half */
+	opts->since = tal(opts, u32);
+	*opts->since = 1000 + num_chans / 2;
+	opts->limit = opts->start = NULL;
+	listchannels(&buf, opts, &num);
+	assert(num == num_chans);
+
+	unlink(gossipfilename);
+	tal_free(ctx);
+	common_shutdown();
+	return 0;
+}
@@ -192,16 +192,90 @@ static struct command_result *json_getroute(struct command *cmd,
 	return command_finished(cmd, js);
 }
 
-HTABLE_DEFINE_TYPE(struct node_id, node_id_keyof, node_id_hash, node_id_eq,
-		   node_map);
+/* Our peers, as far as listchannels cares. */
+struct local_peer {
+	struct node_id id;
+	bool connected;
+	/* Channels with them which are in CHANNELD_NORMAL */
+	struct channel_id *normal;
+};
+
+static const struct node_id *local_peer_keyof(const struct local_peer *lp)
+{
+	return &lp->id;
+}
+
+static bool local_peer_eq_id(const struct local_peer *lp,
+			     const struct node_id *id)
+{
+	return node_id_eq(&lp->id, id);
+}
+
+HTABLE_DEFINE_TYPE(struct local_peer, local_peer_keyof, node_id_hash,
+		   local_peer_eq_id, local_peer_map);
+
+/* Kept up-to-date by notifications, so listchannels doesn't have to
+ * ask lightningd every time. */
+static struct local_peer_map *local_peers;
+
+static struct local_peer *get_local_peer(const struct node_id *id)
+{
+	struct local_peer *lp = local_peer_map_get(local_peers, id);
+
+	if (!lp) {
+		lp = tal(local_peers, struct local_peer);
+		lp->id = *id;
+		lp->connected = false;
+		lp->normal = tal_arr(lp, struct channel_id, 0);
+		local_peer_map_add(local_peers, lp);
+	}
+	return lp;
+}
+
+/* Once it's neither connected nor has usable channels, forget it. */
+static void maybe_forget_local_peer(struct local_peer *lp)
+{
+	if (lp->connected || tal_count(lp->normal))
+		return;
+	local_peer_map_del(local_peers, lp);
+	tal_free(lp);
+}
+
+/* These can be called twice for the same change if it races with
+ * our initial listpeerchannels, so they're idempotent. */
+static void local_channel_normal(struct local_peer *lp,
+				 const struct channel_id *cid, bool normal)
+{
+	for (size_t i = 0; i < tal_count(lp->normal); i++) {
+		if (!channel_id_eq(&lp->normal[i], cid))
+			continue;
+		if (!normal)
+			tal_arr_remove(&lp->normal, i);
+		return;
+	}
+	if (normal)
+		tal_arr_expand(&lp->normal, *cid);
+}
+
+/* Local channels are not "active" unless peer is connected, and we
+ * have a channel in CHANNELD_NORMAL.  We record which local channels
+ * are valid; we could record which are invalid, but our testsuite has
+ * some weirdness where it has local channels in the store it knows
+ * nothing about. */
+static bool local_peer_active(const struct node_id *id)
+{
+	const struct local_peer *lp = local_peer_map_get(local_peers, id);
+
+	return lp && lp->connected && tal_count(lp->normal);
+}
 
 /* To avoid multiple fetches, we represent directions as a bitmap
  * so we can do two at once. */
 static void json_add_halfchan(struct json_stream *response,
 			      struct gossmap *gossmap,
-			      const struct node_map *connected,
 			      const struct gossmap_chan *c,
-			      int dirbits)
+			      int dirbits,
+			      u32 since)
 {
 	struct short_channel_id scid;
 	struct node_id node_id[2];
@@ -209,6 +283,30 @@ static void json_add_halfchan(struct json_stream *response,
 	struct amount_sat capacity;
 	bool local_disable;
 
+	/* Filter out directions we don't want before doing any real work */
+	for (int dir = 0; dir < 2; dir++) {
+		u32 timestamp;
+
+		if (!((1 << dir) & dirbits))
+			continue;
+
+		if (!gossmap_chan_set(c, dir)) {
+			dirbits &= ~(1 << dir);
+			continue;
+		}
+
+		if (since) {
+			gossmap_chan_get_update_details(gossmap, c, dir,
+							&timestamp,
+							NULL, NULL, NULL,
+							NULL, NULL, NULL);
+			if (timestamp < since)
+				dirbits &= ~(1 << dir);
+		}
+	}
+	if (!dirbits)
+		return;
+
 	/* These are channel (not per-direction) properties */
 	chanfeatures = gossmap_chan_get_features(tmpctx, gossmap, c);
 	scid = gossmap_chan_scid(gossmap, c);
@@ -220,11 +318,10 @@ static void json_add_halfchan(struct json_stream *response,
 	if (!gossmap_chan_get_capacity(gossmap, c, &capacity))
 		capacity = AMOUNT_SAT(0);
 
-	/* Local channels are not "active" unless peer is connected. */
 	if (node_id_eq(&node_id[0], &local_id))
-		local_disable = !node_map_get(connected, &node_id[1]);
+		local_disable = !local_peer_active(&node_id[1]);
 	else if (node_id_eq(&node_id[1], &local_id))
-		local_disable = !node_map_get(connected, &node_id[0]);
+		local_disable = !local_peer_active(&node_id[0]);
 	else
 		local_disable = false;
 
@@ -237,9 +334,6 @@ static void json_add_halfchan(struct json_stream *response,
 		if (!((1 << dir) & dirbits))
 			continue;
 
-		if (!gossmap_chan_set(c, dir))
-			continue;
-
 		json_object_start(response, NULL);
 		json_add_node_id(response, "source", &node_id[dir]);
 		json_add_node_id(response, "destination", &node_id[!dir]);
@@ -280,72 +374,26 @@ struct listchannels_opts {
 	struct node_id *source;
 	struct node_id *destination;
 	struct short_channel_id *scid;
+	u32 *since;
+	u32 *start;
+	u32 *limit;
 };
 
-/* We record which local channels are valid; we could record which are
- * invalid, but our testsuite has some weirdness where it has local
- * channels in the store it knows nothing about. */
-static struct node_map *local_connected(const tal_t *ctx,
-					const char *buf,
-					const jsmntok_t *result)
-{
-	size_t i;
-	const jsmntok_t *channel, *channels = json_get_member(buf, result, "channels");
-	struct node_map *connected = tal(ctx, struct node_map);
-
-	node_map_init(connected);
-	tal_add_destructor(connected, node_map_clear);
-
-	json_for_each_arr(i, channel, channels) {
-		struct node_id id;
-		bool is_connected, normal_chan;
-		const char *err;
-
-		err = json_scan(tmpctx, buf, channel,
-				"{peer_id:%,peer_connected:%}",
-				JSON_SCAN(json_to_node_id, &id),
-				JSON_SCAN(json_to_bool, &is_connected));
-		if (err)
-			plugin_err(plugin, "Bad listpeerchannels response (%s): %.*s",
-				   err,
-				   json_tok_full_len(result),
-				   json_tok_full(buf, result));
-
-		if (!is_connected)
-			continue;
-
-		/* Must also have a channel in CHANNELD_NORMAL */
-		normal_chan = json_tok_streq(buf,
-				   json_get_member(buf, channel, "state"),
-					     "CHANNELD_NORMAL");
-
-		if (normal_chan)
-			node_map_add(connected,
-				     tal_dup(connected, struct node_id, &id));
-	}
-
-	return connected;
-}
-
-/* We want to combine local knowledge to we know which are actually inactive! */
-static struct command_result *listpeerchannels_done(struct command *cmd,
-					     const char *buf,
-					     const jsmntok_t *result,
-					     struct listchannels_opts *opts)
+/* Adds the "channels" array (and "next_start", if we hit the limit) */
+static void json_add_listchannels(struct json_stream *js,
+				  struct gossmap *gossmap,
+				  const struct listchannels_opts *opts)
 {
-	struct node_map *connected;
 	struct gossmap_chan *c;
-	struct json_stream *js;
-	struct gossmap *gossmap = get_gossmap();
+	u32 since = opts->since ? *opts->since : 0;
+	bool more = false;
+	u32 idx = 0;
 
-	connected = local_connected(opts, buf, result);
-
-	js = jsonrpc_stream_success(cmd);
 	json_array_start(js, "channels");
 	if (opts->scid) {
 		c = gossmap_find_chan(gossmap, opts->scid);
 		if (c)
-			json_add_halfchan(js, gossmap, connected, c, 3);
+			json_add_halfchan(js, gossmap, c, 3, since);
 	} else if (opts->source) {
 		struct gossmap_node *src;
 
@@ -354,8 +402,8 @@ static struct command_result *listpeerchannels_done(struct command *cmd,
 			for (size_t i = 0; i < src->num_chans; i++) {
 				int dir;
 				c = gossmap_nth_chan(gossmap, src, i, &dir);
-				json_add_halfchan(js, gossmap, connected,
-						  c, 1 << dir);
+				json_add_halfchan(js, gossmap,
+						  c, 1 << dir, since);
 			}
 		}
 	} else if (opts->destination) {
@@ -366,21 +414,33 @@ static struct command_result *listpeerchannels_done(struct command *cmd,
 			for (size_t i = 0; i < dst->num_chans; i++) {
 				int dir;
 				c = gossmap_nth_chan(gossmap, dst, i, &dir);
-				json_add_halfchan(js, gossmap, connected,
-						  c, 1 << !dir);
+				json_add_halfchan(js, gossmap,
+						  c, 1 << !dir, since);
 			}
 		}
 	} else {
-		for (c = gossmap_first_chan(gossmap);
-		     c;
-		     c = gossmap_next_chan(gossmap, c)) {
-			json_add_halfchan(js, gossmap, connected, c, 3);
+		u32 num = 0;
+
+		/* Channel indexes are stable until channels are removed, so
+		 * a caller can page through with start and limit. */
+		for (idx = opts->start ? *opts->start : 0;
+		     idx < gossmap_max_chan_idx(gossmap);
+		     idx++) {
+			c = gossmap_chan_byidx(gossmap, idx);
+			if (!c)
+				continue;
+			if (opts->limit && num == *opts->limit) {
+				more = true;
+				break;
+			}
+			json_add_halfchan(js, gossmap, c, 3, since);
+			num++;
 		}
 	}
-
 	json_array_end(js);
 
-	return command_finished(cmd, js);
+	if (more)
+		json_add_u32(js, "next_start", idx);
 }
 
 static struct command_result *json_listchannels(struct command *cmd,
@@ -388,13 +448,16 @@ static struct command_result *json_listchannels(struct command *cmd,
 						const jsmntok_t *params)
 {
 	struct listchannels_opts *opts = tal(cmd, struct listchannels_opts);
-	struct out_req *req;
+	struct json_stream *js;
 
 	if (!param(cmd, buffer, params,
 		   p_opt("short_channel_id", param_short_channel_id,
 			 &opts->scid),
 		   p_opt("source", param_node_id, &opts->source),
 		   p_opt("destination", param_node_id, &opts->destination),
+		   p_opt("since", param_u32, &opts->since),
+		   p_opt("start", param_u32, &opts->start),
+		   p_opt("limit", param_u32, &opts->limit),
 		   NULL))
 		return command_param_failed();
 
@@ -403,9 +466,20 @@ static struct command_result *json_listchannels(struct command *cmd,
 				    "Can only specify one of "
 				    "`short_channel_id`, "
 				    "`source` or `destination`");
-	req = jsonrpc_request_start(cmd->plugin, cmd, "listpeerchannels",
-				    listpeerchannels_done, forward_error, opts);
-	return send_outreq(cmd->plugin, req);
+
+	if ((opts->start || opts->limit)
+	    && (opts->scid || opts->source || opts->destination))
+		return command_fail(cmd, JSONRPC2_INVALID_PARAMS,
+				    "Can only specify `start` and `limit` "
+				    "when listing all channels");
+
+	if (opts->limit && *opts->limit == 0)
+		return command_fail(cmd, JSONRPC2_INVALID_PARAMS,
+				    "`limit` must be non-zero");
+
+	js = jsonrpc_stream_success(cmd);
+	json_add_listchannels(js, get_gossmap(), opts);
+	return command_finished(cmd, js);
 }
 
 static void json_add_node(struct json_stream *js,
@@ -599,10 +673,138 @@ done:
 	return command_finished(cmd, js);
 }
 
+static struct command_result *json_connect(struct command *cmd,
+					   const char *buf,
+					   const jsmntok_t *params)
+{
+	struct node_id id;
+	const char *err;
+
+	err = json_scan(tmpctx, buf, params,
+			"{id:%}",
+			JSON_SCAN(json_to_node_id, &id));
+	if (err)
+		plugin_err(cmd->plugin,
+			   "`connect` notification payload did not"
+			   " scan %s: %.*s",
+			   err, json_tok_full_len(params),
+			   json_tok_full(buf, params));
+
+	get_local_peer(&id)->connected = true;
+	return notification_handled(cmd);
+}
+
+static struct command_result *json_disconnect(struct command *cmd,
+					      const char *buf,
+					      const jsmntok_t *params)
+{
+	struct node_id id;
+	struct local_peer *lp;
+	const char *err;
+
+	err = json_scan(tmpctx, buf, params,
+			"{id:%}",
+			JSON_SCAN(json_to_node_id, &id));
+	if (err)
+		plugin_err(cmd->plugin,
+			   "`disconnect` notification payload did not"
+			   " scan %s: %.*s",
+			   err, json_tok_full_len(params),
+			   json_tok_full(buf, params));
+
+	lp = local_peer_map_get(local_peers, &id);
+	if (lp) {
+		lp->connected = false;
+		maybe_forget_local_peer(lp);
+	}
+	return notification_handled(cmd);
+}
+
+static struct command_result *json_channel_state_changed(struct command *cmd,
+							 const char *buf,
+							 const jsmntok_t *params)
+{
+	struct node_id id;
+	struct channel_id cid;
+	struct local_peer *lp;
+	const jsmntok_t *statetok;
+	const char *err;
+
+	err = json_scan(tmpctx, buf, params,
+			"{channel_state_changed:"
+			"{peer_id:%,channel_id:%}}",
+			JSON_SCAN(json_to_node_id, &id),
+			JSON_SCAN(json_to_channel_id, &cid));
+	if (err)
+		plugin_err(cmd->plugin,
+			   "`channel_state_changed` notification payload did"
+			   " not scan %s: %.*s",
+			   err, json_tok_full_len(params),
+			   json_tok_full(buf, params));
+
+	statetok = json_get_member(buf,
+				   json_get_member(buf, params,
+						   "channel_state_changed"),
+				   "new_state");
+	lp = get_local_peer(&id);
+	local_channel_normal(lp, &cid,
+			     json_tok_streq(buf, statetok, "CHANNELD_NORMAL"));
+	maybe_forget_local_peer(lp);
+	return notification_handled(cmd);
+}
+
+/* After this, notifications keep local_peers up-to-date. */
+static void init_local_peers(struct plugin *p)
+{
+	const jsmntok_t *result, *channels, *channel;
+	const char *buf;
+	size_t i;
+
+	local_peers = tal(p, struct local_peer_map);
+	local_peer_map_init(local_peers);
+
+	result = jsonrpc_request_sync(tmpctx, p, "listpeerchannels",
+				      take(json_out_obj(NULL, NULL, NULL)),
+				      &buf);
+	channels = json_get_member(buf, result, "channels");
+	json_for_each_arr(i, channel, channels) {
+		struct node_id id;
+		struct channel_id cid;
+		bool is_connected;
+		struct local_peer *lp;
+		const char *err;
+
+		err = json_scan(tmpctx, buf, channel,
+				"{peer_id:%,peer_connected:%}",
+				JSON_SCAN(json_to_node_id, &id),
+				JSON_SCAN(json_to_bool, &is_connected));
+		if (err)
+			plugin_err(p, "Bad listpeerchannels response (%s): %.*s",
+				   err,
+				   json_tok_full_len(result),
+				   json_tok_full(buf, result));
+
+		lp = get_local_peer(&id);
+		lp->connected = is_connected;
+
+		/* Must also have a channel in CHANNELD_NORMAL */
+		if (json_tok_streq(buf,
+				   json_get_member(buf, channel, "state"),
+				   "CHANNELD_NORMAL")
+		    && json_to_channel_id(buf,
+					  json_get_member(buf, channel,
+							  "channel_id"),
+					  &cid))
+			local_channel_normal(lp, &cid, true);
+		maybe_forget_local_peer(lp);
+	}
+}
+
 #if DEVELOPER
 static void memleak_mark(struct plugin *p, struct htable *memtable)
 {
 	memleak_scan_obj(memtable, global_gossmap);
+	memleak_scan_htable(memtable, &local_peers->raw);
 }
 #endif
 
@@ -615,6 +817,7 @@ static const char *init(struct plugin *p,
 	rpc_scan(p, "getinfo",
 		 take(json_out_obj(NULL, NULL, NULL)),
 		 "{id:%}", JSON_SCAN(json_to_node_id, &local_id));
+	init_local_peers(p);
 
 	global_gossmap = gossmap_load(NULL,
 				      GOSSIP_STORE_FILENAME,
@@ -651,7 +854,8 @@ static const struct plugin_command commands[] = {
 		"channels",
 		"List all known channels in the network",
 		"Show channels for {short_channel_id}, {source} or {destination} "
-		"(or all known channels, if not specified)",
+		"(or all known channels, if not specified, from {start} up to "
+		"{limit} channels), only those updated {since} a timestamp",
 		json_listchannels,
 	},
 	{
@@ -670,9 +874,24 @@ static const struct plugin_command commands[] = {
 	},
 };
 
+static const struct plugin_notification notifs[] = {
+	{
+		"connect",
+		json_connect,
+	},
+	{
+		"disconnect",
+		json_disconnect,
+	},
+	{
+		"channel_state_changed",
+		json_channel_state_changed,
+	},
+};
+
 int main(int argc, char *argv[])
 {
 	setup_locale();
 	plugin_main(argv, init, PLUGIN_STATIC, true, NULL, commands, ARRAY_SIZE(commands),
-	            NULL, 0, NULL, 0, NULL, 0, NULL);
+	            notifs, ARRAY_SIZE(notifs), NULL, 0, NULL, 0, NULL);
 }
@@ -52,6 +52,37 @@ def test_single_hop(node_factory, executor):
     print("Done. %d payments performed in %f seconds (%f payments per second)" % (num_payments, diff, num_payments / diff))
 
 
+def test_forward_throughput(node_factory, executor):
+    """Concurrent payments through l2, with the default plugins loaded"""
+    l1, l2, l3 = node_factory.line_graph(3, fundamount=10**7,
+                                         wait_for_announce=True)
+
+    print("Collecting invoices")
+    fs = []
+    invoices = []
+    for i in tqdm(range(num_payments)):
+        inv = l3.rpc.invoice(1000, 'invoice-%d' % (i), 'desc')
+        invoices.append((inv['payment_hash'], inv['payment_secret']))
+
+    route = l1.rpc.getroute(l3.info['id'], 1000, 1)['route']
+    print("Sending payments")
+    start_time = time()
+
+    def do_pay(i, s):
+        p = l1.rpc.sendpay(route, i, payment_secret=s)
+        r = l1.rpc.waitsendpay(p['payment_hash'])
+        return r
+
+    for i, s in invoices:
+        fs.append(executor.submit(do_pay, i, s))
+
+    for f in tqdm(futures.as_completed(fs), total=len(fs)):
+        f.result()
+
+    diff = time() - start_time
+    print("Done. %d payments forwarded in %f seconds (%f payments per second)" % (num_payments, diff, num_payments / diff))
+
+
 def test_single_payment(node_factory, benchmark):
     l1, l2 = node_factory.line_graph(2)
 
@@ -3735,6 +3735,42 @@ def test_onchain_rexmit_tx(node_factory, bitcoind):
     wait_for(lambda: len(bitcoind.rpc.getrawmempool()) == 1)
 
 
+def test_rebroadcast_stops_on_conflict(node_factory, bitcoind):
+    """Don't keep rebroadcasting a tx once its inputs are spent by another"""
+    l1, l2 = node_factory.line_graph(2)
+
+    sent = []
+
+    def counting_sendrawtx(r):
+        sent.append(r['params'][0])
+        return {'id': r['id'], 'result': {}}
+
+    l1.daemon.rpcproxy.mock_rpc('sendrawtransaction', counting_sendrawtx)
+
+    l2.stop()
+    l1.rpc.close(l2.info['id'], unilateraltimeout=1)
+    wait_for(lambda: len(sent) >= 1)
+    l1_commit = sent[0]
+
+    # Every block, we try again.
+    bitcoind.generate_block(1)
+    wait_for(lambda: sent.count(l1_commit) >= 2)
+
+    # l2 comes back, gets told about the close, and drops its own
+    # commitment tx, which does get mined.
+    l2.start()
+    l2.rpc.connect(l1.info['id'], 'localhost', l1.port)
+    l2.daemon.wait_for_log(' to AWAITING_UNILATERAL')
+    bitcoind.generate_block(1, wait_for_mempool=1)
+    l1.daemon.wait_for_log('Outgoing tx .* conflicts with .* in block')
+
+    # Now l1 knows its commitment tx can never be mined.
+    num = sent.count(l1_commit)
+    bitcoind.generate_block(3)
+    sync_blockheight(bitcoind, [l1])
+    assert sent.count(l1_commit) == num
+
+
 @unittest.skipIf(TEST_NETWORK != 'regtest', 'elementsd anchors unsupported')
 @pytest.mark.developer("needs dev_disconnect")
 def test_closing_anchorspend_htlc_tx_rbf(node_factory, bitcoind):
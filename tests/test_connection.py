@@ -956,6 +956,75 @@ def test_reconnect_receiver_fulfill(node_factory):
     assert only_one(l2.rpc.listinvoices('testpayment2')['invoices'])['status'] == 'paid'
 
 
+def early_preimage_nodes(node_factory):
+    """l1->l2->l3, where l3 disconnects after sending update_fulfill_htlc,
+    before the commitment_signed which commits to it"""
+    # The first commitment_signed is for the HTLC add.
+    disconnects = ['=WIRE_COMMITMENT_SIGNED', '-WIRE_COMMITMENT_SIGNED']
+    if EXPERIMENTAL_DUAL_FUND:
+        disconnects = ['=WIRE_COMMITMENT_SIGNED'] + disconnects
+
+    # Feerates identical so we don't get gratuitous commit to update them
+    opts = {'may_reconnect': True,
+            'dev-no-reconnect': None,
+            'feerates': (7500, 7500, 7500, 7500)}
+    return node_factory.line_graph(3, opts=[opts, opts,
+                                            {**opts, 'disconnect': disconnects}],
+                                   wait_for_announce=True)
+
+
+@pytest.mark.developer("needs dev-disconnect")
+def test_forward_early_preimage(node_factory):
+    l1, l2, l3 = early_preimage_nodes(node_factory)
+
+    # l2 fulfills upstream before l3's commitment_signed: otherwise this
+    # would hang, as nobody reconnects.
+    inv = l3.rpc.invoice(100000000, 'test_forward_early_preimage', 'desc')
+    l1.rpc.pay(inv['bolt11'])
+    l3.daemon.wait_for_log('dev_disconnect: -WIRE_COMMITMENT_SIGNED')
+    l2.daemon.wait_for_log('Got preimage for HTLC 0 early')
+    htlc = only_one(only_one(l2.rpc.listpeerchannels(l3.info['id'])['channels'])['htlcs'])
+    assert htlc['state'] == 'RCVD_REMOVE_HTLC'
+
+    # l2 gave channeld the HTLC without the preimage, so l3's resent
+    # fulfill is accepted, and lightningd ignores it.
+    l2.rpc.connect(l3.info['id'], 'localhost', l3.port)
+    wait_for(lambda: only_one(l2.rpc.listpeerchannels(l3.info['id'])['channels'])['htlcs'] == [])
+    assert len([l for l in l2.daemon.logs if 'Got preimage for HTLC' in l]) == 1
+    assert only_one(l3.rpc.listinvoices('test_forward_early_preimage')['invoices'])['status'] == 'paid'
+
+    # Channel balances still agree, so we can pay again.
+    inv = l3.rpc.invoice(100000000, 'test_forward_early_preimage2', 'desc')
+    l1.rpc.pay(inv['bolt11'])
+    wait_for(lambda: only_one(l2.rpc.listpeerchannels(l3.info['id'])['channels'])['htlcs'] == [])
+    assert only_one(l2.rpc.listpeerchannels(l3.info['id'])['channels'])['state'] == 'CHANNELD_NORMAL'
+
+
+@unittest.skipIf(os.getenv('TEST_DB_PROVIDER', 'sqlite3') != 'sqlite3',
+                 "This test requires sqlite3")
+@pytest.mark.developer("needs dev-disconnect")
+def test_forward_fail_after_early_preimage(node_factory):
+    l1, l2, l3 = early_preimage_nodes(node_factory)
+
+    inv = l3.rpc.invoice(100000000, 'test_forward_fail_after_early_preimage', 'desc')
+    l1.rpc.pay(inv['bolt11'])
+    l3.daemon.wait_for_log('dev_disconnect: -WIRE_COMMITMENT_SIGNED')
+    l2.daemon.wait_for_log('Got preimage for HTLC 0 early')
+
+    # Make l3 fail the HTLC it fulfilled (with invalid_onion_hmac).
+    l3.stop()
+    del l3.daemon.opts['dev-disconnect']
+    l3.db_manip("UPDATE channel_htlcs SET payment_key=NULL, malformed_onion={}"
+                " WHERE payment_hash=x'{}';".format(0xC005, inv['payment_hash']))
+    l3.start()
+
+    # l2 has already fulfilled upstream, so it goes onchain.
+    l2.rpc.connect(l3.info['id'], 'localhost', l3.port)
+    l2.daemon.wait_for_log('Peer permanent failure in CHANNELD_NORMAL: Peer failed HTLC 0 after fulfilling it')
+    wait_for(lambda: only_one(l2.rpc.listpeerchannels(l3.info['id'])['channels'])['state'] == 'AWAITING_UNILATERAL')
+    assert only_one(l1.rpc.listpays(inv['bolt11'])['pays'])['status'] == 'complete'
+
+
 @pytest.mark.developer
 @pytest.mark.openchannel('v1')
 @pytest.mark.openchannel('v2')
@@ -4430,6 +4499,40 @@ def test_peer_disconnected_reflected_in_channel_state(node_factory):
     wait_for(lambda: only_one(l1.rpc.listpeerchannels(l2.info['id'])['channels'])['peer_connected'] is False)
 
 
+
+def test_listchannelbalances(node_factory):
+    """listchannelbalances agrees with listpeerchannels, and `since`
+    only reports channels which changed."""
+    l1, l2 = node_factory.line_graph(2, opts={'may_reconnect': True})
+
+    def matches_listpeerchannels(bal):
+        chan = only_one(l1.rpc.listpeerchannels(l2.info['id'])['channels'])
+        return (bal['short_channel_id'] == chan['short_channel_id']
+                and bal['direction'] == chan['direction']
+                and bal['peer_connected'] == chan['peer_connected']
+                and bal['spendable_msat'] == chan['spendable_msat']
+                and bal['receivable_msat'] == chan['receivable_msat']
+                and bal['num_htlcs'] == len(chan['htlcs']))
+
+    balances = l1.rpc.listchannelbalances()
+    assert matches_listpeerchannels(only_one(balances['channels']))
+    assert only_one(balances['channels'])['generation'] <= balances['generation']
+
+    # Nothing changed, so nothing to report.
+    gen = balances['generation']
+    assert l1.rpc.listchannelbalances(gen) == {'generation': gen,
+                                               'channels': []}
+
+    l1.pay(l2, 100000)
+    wait_for(lambda: matches_listpeerchannels(only_one(l1.rpc.listchannelbalances(gen)['channels'])))
+    assert l1.rpc.listchannelbalances()['generation'] > gen
+
+    # Disconnection is a change, too.
+    gen = l1.rpc.listchannelbalances()['generation']
+    l2.stop()
+    wait_for(lambda: only_one(l1.rpc.listchannelbalances(gen)['channels'])['peer_connected'] is False)
+
+
 def test_peer_disconnected_has_featurebits(node_factory):
     """
     Make sure that if a node is restarted, it still remembers feature
@@ -445,6 +445,19 @@ def test_gossip_jsonrpc(node_factory):
     with pytest.raises(RpcError, match=r"Can only specify one of.*"):
         l1.rpc.listchannels(short_channel_id="1x1x1", source=l2.info['id'])
 
+    # Paging: there's only one channel, so no next_start.
+    page = l1.rpc.listchannels(limit=1)
+    assert len(page['channels']) == 2
+    assert 'next_start' not in page
+    assert l1.rpc.listchannels(start=1000)['channels'] == []
+    with pytest.raises(RpcError, match=r"Can only specify `start` and `limit`.*"):
+        l1.rpc.listchannels(source=l2.info['id'], limit=1)
+
+    # Filtering by update time.
+    latest = max(c['last_update'] for c in channels1 + channels2)
+    assert l1.rpc.listchannels(since=latest + 1)['channels'] == []
+    assert len(l1.rpc.listchannels(since=latest)['channels']) >= 1
+
     # Now proceed to funding-depth and do a full gossip round
     l1.bitcoin.generate_block(5)
     # Could happen in either order.
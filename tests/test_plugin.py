@@ -2410,6 +2410,23 @@ def test_hook_dep_stable(node_factory):
     l2.daemon.wait_for_log(r"dep_b.py: htlc_accepted called")
 
 
+def test_hook_filters(node_factory):
+    """keysend only wants final-hop HTLCs with a preimage"""
+    l1, l2, l3 = node_factory.line_graph(3, wait_for_announce=True)
+
+    # Neither a forward nor a normal payment bothers keysend.
+    inv = l3.rpc.invoice(1000, 'test_hook_filters', 'desc')['bolt11']
+    l1.rpc.pay(inv)
+    assert not l2.daemon.is_in_log('Calling htlc_accepted hook of plugin keysend')
+    assert not l3.daemon.is_in_log('Calling htlc_accepted hook of plugin keysend')
+
+    # But a keysend does.
+    l1.rpc.keysend(l3.info['id'], 1000)
+    l3.daemon.wait_for_log('Calling htlc_accepted hook of plugin keysend')
+    assert not l2.daemon.is_in_log('Calling htlc_accepted hook of plugin keysend')
+    assert len(l3.rpc.listinvoices()['invoices']) == 2
+
+
 def test_htlc_accepted_hook_failonion(node_factory):
     plugin = os.path.join(os.path.dirname(__file__), 'plugins/htlc_accepted-failonion.py')
     l1, l2 = node_factory.line_graph(2, opts=[{}, {'plugin': plugin}])
@@ -950,6 +950,30 @@ static struct migration dbmigrations[] = {
     {SQL("ALTER TABLE channels ADD channel_type BLOB DEFAULT NULL;"), NULL},
     {NULL, migrate_fill_in_channel_type},
     {SQL("ALTER TABLE peers ADD feature_bits BLOB DEFAULT NULL;"), NULL},
+    /* onchaind wants the HTLCs live at a given commitment number. */
+    {SQL("CREATE INDEX channel_htlcs_commit_idx"
+	 " ON channel_htlcs(channel_id, max_commit_num);"), NULL},
+    /* Long-resolved HTLCs: just what we need for onchaind and listhtlcs */
+    {SQL("CREATE TABLE channel_htlc_archive ("
+	 "  id BIGINT,"
+	 "  channel_id BIGINT REFERENCES channels(id) ON DELETE CASCADE,"
+	 "  channel_htlc_id BIGINT,"
+	 "  direction INTEGER,"
+	 "  msatoshi BIGINT,"
+	 "  cltv_expiry INTEGER,"
+	 "  payment_hash BLOB,"
+	 "  hstate INTEGER,"
+	 "  min_commit_num BIGINT,"
+	 "  max_commit_num BIGINT,"
+	 "  PRIMARY KEY (id)"
+	 ");"), NULL},
+    {SQL("CREATE INDEX channel_htlc_archive_commit_idx"
+	 " ON channel_htlc_archive(channel_id, max_commit_num);"), NULL},
+    /* BOLT12 recurrence looks up previous payments by label (which we
+     * store as the description), and listinvoices filters by offer. */
+    {SQL("CREATE INDEX payments_label_idx ON payments (description)"), NULL},
+    {SQL("CREATE INDEX invoices_local_offer_id_idx"
+	 " ON invoices (local_offer_id)"), NULL},
 };
 
 /**
@@ -76,7 +76,8 @@ trigger_invoice_waiter_expire_or_delete(struct invoices *invoices,
 }
 
 static struct invoice_details *wallet_stmt2invoice_details(const tal_t *ctx,
-							   struct db_stmt *stmt)
+							   struct db_stmt *stmt,
+							   bool has_invstring)
 {
 	struct invoice_details *dtl = tal(ctx, struct invoice_details);
 	dtl->state = db_col_int(stmt, "state");
@@ -100,7 +101,10 @@ static struct invoice_details *wallet_stmt2invoice_details(const tal_t *ctx,
 		db_col_ignore(stmt, "paid_timestamp");
 	}
 
-	dtl->invstring = db_col_strdup(dtl, stmt, "bolt11");
+	if (has_invstring)
+		dtl->invstring = db_col_strdup(dtl, stmt, "bolt11");
+	else
+		dtl->invstring = NULL;
 
 	if (!db_col_is_null(stmt, "description"))
 		dtl->description = db_col_strdup(dtl, stmt,
@@ -446,29 +450,89 @@ void invoices_delete_expired(struct invoices *invoices,
 }
 
 bool invoices_iterate(struct invoices *invoices,
-		      struct invoice_iterator *it)
+		      struct invoice_iterator *it,
+		      bool want_invstring,
+		      const struct sha256 *local_offer_id)
 {
 	struct db_stmt *stmt;
 
 	if (!it->p) {
-		stmt = db_prepare_v2(invoices->db, SQL("SELECT"
-						       "  state"
-						       ", payment_key"
-						       ", payment_hash"
-						       ", label"
-						       ", msatoshi"
-						       ", expiry_time"
-						       ", pay_index"
-						       ", msatoshi_received"
-						       ", paid_timestamp"
-						       ", bolt11"
-						       ", description"
-						       ", features"
-						       ", local_offer_id"
-						       " FROM invoices"
-						       " ORDER BY id;"));
+		/* Merchants can have millions of invoices: let the
+		 * local_offer_id index find the ones for one offer. */
+		if (local_offer_id) {
+			if (want_invstring)
+				stmt = db_prepare_v2(invoices->db, SQL("SELECT"
+								       "  state"
+								       ", payment_key"
+								       ", payment_hash"
+								       ", label"
+								       ", msatoshi"
+								       ", expiry_time"
+								       ", pay_index"
+								       ", msatoshi_received"
+								       ", paid_timestamp"
+								       ", bolt11"
+								       ", description"
+								       ", features"
+								       ", local_offer_id"
+								       " FROM invoices"
+								       " WHERE local_offer_id = ?"
+								       " ORDER BY id;"));
+			else
+				stmt = db_prepare_v2(invoices->db, SQL("SELECT"
+								       "  state"
+								       ", payment_key"
+								       ", payment_hash"
+								       ", label"
+								       ", msatoshi"
+								       ", expiry_time"
+								       ", pay_index"
+								       ", msatoshi_received"
+								       ", paid_timestamp"
+								       ", description"
+								       ", features"
+								       ", local_offer_id"
+								       " FROM invoices"
+								       " WHERE local_offer_id = ?"
+								       " ORDER BY id;"));
+			db_bind_sha256(stmt, 0, local_offer_id);
+		} else if (want_invstring)
+			stmt = db_prepare_v2(invoices->db, SQL("SELECT"
+							       "  state"
+							       ", payment_key"
+							       ", payment_hash"
+							       ", label"
+							       ", msatoshi"
+							       ", expiry_time"
+							       ", pay_index"
+							       ", msatoshi_received"
+							       ", paid_timestamp"
+							       ", bolt11"
+							       ", description"
+							       ", features"
+							       ", local_offer_id"
+							       " FROM invoices"
+							       " ORDER BY id;"));
+		else
+			/* Same, without the bulky bolt11 */
+			stmt = db_prepare_v2(invoices->db, SQL("SELECT"
+							       "  state"
+							       ", payment_key"
+							       ", payment_hash"
+							       ", label"
+							       ", msatoshi"
+							       ", expiry_time"
+							       ", pay_index"
+							       ", msatoshi_received"
+							       ", paid_timestamp"
+							       ", description"
+							       ", features"
+							       ", local_offer_id"
+							       " FROM invoices"
+							       " ORDER BY id;"));
 		db_query_prepared(stmt);
 		it->p = stmt;
+		it->invstring = want_invstring;
 	} else
 		stmt = it->p;
 
@@ -488,7 +552,8 @@ invoices_iterator_deref(const tal_t *ctx, struct invoices *invoices UNUSED,
 			const struct invoice_iterator *it)
 {
 	assert(it->p);
-	return wallet_stmt2invoice_details(ctx, (struct db_stmt*) it->p);
+	return wallet_stmt2invoice_details(ctx, (struct db_stmt*) it->p,
+					   it->invstring);
 }
 
 static s64 get_next_pay_index(struct db *db)
@@ -688,7 +753,7 @@ struct invoice_details *invoices_get_details(const tal_t *ctx,
 	res = db_step(stmt);
 	assert(res);
 
-	details = wallet_stmt2invoice_details(ctx, stmt);
+	details = wallet_stmt2invoice_details(ctx, stmt, true);
 	tal_free(stmt);
 	return details;
 }
@@ -134,18 +134,22 @@ void invoices_delete_expired(struct invoices *invoices,
  *
  * @invoices - the invoice handler.
  * @iterator - the iterator object to use.
+ * @want_invstring - if false, don't load invstring (it will be NULL).
+ * @local_offer_id - if non-NULL, only invoices for this offer.
  *
  * Return false at end-of-sequence, true if still iterating.
  * Usage:
  *
  *   struct invoice_iterator it;
  *   memset(&it, 0, sizeof(it))
- *   while (invoices_iterate(wallet, &it)) {
+ *   while (invoices_iterate(wallet, &it, true, NULL)) {
  *       ...
  *   }
  */
 bool invoices_iterate(struct invoices *invoices,
-		      struct invoice_iterator *it);
+		      struct invoice_iterator *it,
+		      bool want_invstring,
+		      const struct sha256 *local_offer_id);
 
 /**
  * wallet_invoice_iterator_deref - Read the details of the
@@ -157,6 +157,9 @@ bool fromwire_channeld_dev_memleak_reply(const void *p UNNEEDED, bool *leak UNNE
 /* Generated stub for fromwire_channeld_got_commitsig */
 bool fromwire_channeld_got_commitsig(const tal_t *ctx UNNEEDED, const void *p UNNEEDED, u64 *commitnum UNNEEDED, struct fee_states **fee_states UNNEEDED, struct height_states **blockheight_states UNNEEDED, struct bitcoin_signature *signature UNNEEDED, struct bitcoin_signature **htlc_signature UNNEEDED, struct added_htlc **added UNNEEDED, struct fulfilled_htlc **fulfilled UNNEEDED, struct failed_htlc ***failed UNNEEDED, struct changed_htlc **changed UNNEEDED, struct bitcoin_tx **tx UNNEEDED)
 { fprintf(stderr, "fromwire_channeld_got_commitsig called!\n"); abort(); }
+/* Generated stub for fromwire_channeld_got_preimage */
+bool fromwire_channeld_got_preimage(const void *p UNNEEDED, u64 *id UNNEEDED, struct preimage *preimage UNNEEDED)
+{ fprintf(stderr, "fromwire_channeld_got_preimage called!\n"); abort(); }
 /* Generated stub for fromwire_channeld_got_revoke */
 bool fromwire_channeld_got_revoke(const tal_t *ctx UNNEEDED, const void *p UNNEEDED, u64 *revokenum UNNEEDED, struct secret *per_commitment_secret UNNEEDED, struct pubkey *next_per_commit_point UNNEEDED, struct fee_states **fee_states UNNEEDED, struct height_states **blockheight_states UNNEEDED, struct changed_htlc **changed UNNEEDED, struct penalty_base **pbase UNNEEDED, struct bitcoin_tx **penalty_tx UNNEEDED)
 { fprintf(stderr, "fromwire_channeld_got_revoke called!\n"); abort(); }
@@ -282,7 +285,9 @@ struct invoice_details *invoices_get_details(const tal_t *ctx UNNEEDED,
 { fprintf(stderr, "invoices_get_details called!\n"); abort(); }
 /* Generated stub for invoices_iterate */
 bool invoices_iterate(struct invoices *invoices UNNEEDED,
-		      struct invoice_iterator *it UNNEEDED)
+		      struct invoice_iterator *it UNNEEDED,
+		      bool want_invstring UNNEEDED,
+		      const struct sha256 *local_offer_id UNNEEDED)
 { fprintf(stderr, "invoices_iterate called!\n"); abort(); }
 /* Generated stub for invoices_iterator_deref */
 const struct invoice_details *invoices_iterator_deref(
@@ -454,6 +459,9 @@ char *json_strdup(const tal_t *ctx UNNEEDED, const char *buffer UNNEEDED, const
 /* Generated stub for json_stream_success */
 struct json_stream *json_stream_success(struct command *cmd UNNEEDED)
 { fprintf(stderr, "json_stream_success called!\n"); abort(); }
+/* Generated stub for json_stream_wants */
+bool json_stream_wants(const struct json_stream *js UNNEEDED, const char *fieldname UNNEEDED)
+{ fprintf(stderr, "json_stream_wants called!\n"); abort(); }
 /* Generated stub for json_to_channel_id */
 bool json_to_channel_id(const char *buffer UNNEEDED, const jsmntok_t *tok UNNEEDED,
 			struct channel_id *cid UNNEEDED)
@@ -1863,6 +1871,10 @@ static bool test_htlc_crud(struct lightningd *ld, const tal_t *ctx)
 	chan->dbid = 1;
 	chan->peer = peer;
 	chan->next_index[LOCAL] = chan->next_index[REMOTE] = 1;
+	list_head_init(&chan->htlcs_in);
+	list_head_init(&chan->htlcs_out);
+	chan->num_htlcs_in = chan->num_htlcs_out = 0;
+	chan->htlcs_in_msat = chan->htlcs_out_msat = AMOUNT_MSAT(0);
 
 	memset(&in, 0, sizeof(in));
 	memset(&out, 0, sizeof(out));
@@ -1947,6 +1959,152 @@ static bool test_htlc_crud(struct lightningd *ld, const tal_t *ctx)
 	return true;
 }
 
+/* Stubs for a commitment: how many, and the first HTLC id. */
+static size_t count_stubs(struct wallet *w, struct channel *chan,
+			  u64 commit_num, u64 *usec, u64 *first_id)
+{
+	struct htlc_stub *stubs;
+	struct timemono start = time_mono();
+
+	db_begin_transaction(w->db);
+	stubs = wallet_htlc_stubs(tmpctx, w, chan, commit_num);
+	db_commit_transaction(w->db);
+	*usec = time_to_usec(timemono_since(start));
+
+	*first_id = tal_count(stubs) ? stubs[0].id : -1ULL;
+	for (size_t i = 1; i < tal_count(stubs); i++) {
+		if (stubs[i].id < *first_id)
+			*first_id = stubs[i].id;
+	}
+	return tal_count(stubs);
+}
+
+/* A busy channel accumulates millions of resolved HTLCs, but onchaind
+ * only wants the handful live at the commitment which hit the chain. */
+static bool test_htlc_history(struct lightningd *ld, const tal_t *ctx)
+{
+	struct db_stmt *stmt;
+	struct channel *chan = talz(ctx, struct channel);
+	struct wallet *w = create_test_wallet(ld, ctx);
+	struct short_channel_id scid;
+	struct sha256 payment_hash;
+	struct wallet_htlc_iter *iter;
+	int cltv_expiry;
+	enum side owner;
+	struct amount_msat msat;
+	enum htlc_state hstate;
+	size_t num = 1000, batch, moved, n;
+	u64 usec_new, usec_old, usec_after, first, expect;
+	const char *v;
+
+	/* BENCHMARK=1 makes it a busy channel. */
+	v = getenv("BENCHMARK");
+	if (v && atoi(v) == 1)
+		num = 2000000;
+	batch = num / 20;
+
+	CHECK(mk_short_channel_id(&scid, 1, 2, 3));
+	chan->dbid = 1;
+	chan->scid = &scid;
+
+	db_begin_transaction(w->db);
+	stmt = db_prepare_v2(w->db, SQL("INSERT INTO channels (id) VALUES (1);"));
+	db_exec_prepared_v2(take(stmt));
+
+	/* HTLC i was added in commitment i and gone by i+1 */
+	memset(&payment_hash, 'A', sizeof(payment_hash));
+	for (u64 i = 0; i < num + 3; i++) {
+		memcpy(&payment_hash, &i, sizeof(i));
+		stmt = db_prepare_v2(w->db,
+				     SQL("INSERT INTO channel_htlcs ("
+					 " channel_id"
+					 ", channel_htlc_id"
+					 ", direction"
+					 ", msatoshi"
+					 ", cltv_expiry"
+					 ", payment_hash"
+					 ", hstate"
+					 ", min_commit_num"
+					 ", max_commit_num"
+					 ") VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?);"));
+		db_bind_u64(stmt, 0, chan->dbid);
+		db_bind_u64(stmt, 1, i);
+		db_bind_int(stmt, 2, i % 2 ? DIRECTION_INCOMING : DIRECTION_OUTGOING);
+		db_bind_u64(stmt, 3, 1000);
+		db_bind_int(stmt, 4, 500);
+		db_bind_sha256(stmt, 5, &payment_hash);
+		/* ... except the last three, which are still live. */
+		if (i < num) {
+			db_bind_int(stmt, 6, i % 2 ? RCVD_REMOVE_ACK_REVOCATION
+				    : SENT_REMOVE_ACK_REVOCATION);
+			db_bind_u64(stmt, 7, i);
+			db_bind_u64(stmt, 8, i + 1);
+		} else {
+			db_bind_int(stmt, 6, RCVD_ADD_ACK_REVOCATION);
+			db_bind_u64(stmt, 7, num);
+			db_bind_null(stmt, 8);
+		}
+		db_exec_prepared_v2(take(stmt));
+	}
+	db_commit_transaction(w->db);
+	CHECK(!wallet_err);
+
+	/* The latest commitment: HTLC num-1, and the live ones. */
+	CHECK(count_stubs(w, chan, num, &usec_new, &first) == 4);
+	CHECK(first == num - 1);
+	/* An old, revoked one: HTLCs num/2-1 and num/2. */
+	CHECK(count_stubs(w, chan, num / 2, &usec_old, &first) == 2);
+	CHECK(first == num / 2 - 1);
+
+	/* Archive everything resolved before commitment num-100 */
+	moved = 0;
+	do {
+		db_begin_transaction(w->db);
+		n = wallet_htlcs_archive(w, chan, num - 100, batch);
+		db_commit_transaction(w->db);
+		moved += n;
+	} while (n == batch);
+	CHECK(!wallet_err);
+	CHECK(moved == num - 101);
+
+	/* Archived HTLCs are still there for onchaind... */
+	CHECK(count_stubs(w, chan, num, &usec_after, &first) == 4);
+	CHECK(first == num - 1);
+	CHECK(count_stubs(w, chan, num / 2, &usec_old, &first) == 2);
+	CHECK(first == num / 2 - 1);
+	CHECK(count_stubs(w, chan, 1, &usec_old, &first) == 2);
+	CHECK(first == 0);
+
+	/* ... and listhtlcs, in the same order. */
+	expect = 0;
+	db_begin_transaction(w->db);
+	for (iter = wallet_htlcs_first(ctx, w, chan, &scid, &first,
+				       &cltv_expiry, &owner, &msat,
+				       &payment_hash, &hstate);
+	     iter;
+	     iter = wallet_htlcs_next(w, iter, &scid, &first,
+				      &cltv_expiry, &owner, &msat,
+				      &payment_hash, &hstate)) {
+		CHECK(first == expect);
+		CHECK(owner == (expect % 2 ? REMOTE : LOCAL));
+		if (expect < num) {
+			CHECK(hstate == (expect % 2 ? RCVD_REMOVE_ACK_REVOCATION
+					 : SENT_REMOVE_ACK_REVOCATION));
+		} else {
+			CHECK(hstate == RCVD_ADD_ACK_REVOCATION);
+		}
+		CHECK(memcmp(&payment_hash, &expect, sizeof(expect)) == 0);
+		expect++;
+	}
+	db_commit_transaction(w->db);
+	CHECK(expect == num + 3);
+
+	if (v && atoi(v) == 1)
+		printf("%zu HTLCs: stubs for latest commitment took %"PRIu64"usec, %"PRIu64"usec after archiving\n",
+		       num, usec_new, usec_after);
+	return true;
+}
+
 static bool test_payment_crud(struct lightningd *ld, const tal_t *ctx)
 {
 	struct wallet_payment *t = tal(ctx, struct wallet_payment), *t2;
@@ -2000,6 +2158,143 @@ static bool test_payment_crud(struct lightningd *ld, const tal_t *ctx)
 	return true;
 }
 
+/* This is how offer.c's prev_payment used to find payments by label. */
+static size_t count_label_by_scan(struct wallet *w, const char *label,
+				  u64 *usec)
+{
+	const struct wallet_payment **payments;
+	struct timemono start = time_mono();
+	size_t count = 0;
+
+	payments = wallet_payment_list(tmpctx, w, NULL);
+	for (size_t i = 0; i < tal_count(payments); i++) {
+		if (payments[i]->label && streq(payments[i]->label, label))
+			count++;
+	}
+	tal_free(payments);
+	*usec = time_to_usec(timemono_since(start));
+	return count;
+}
+
+static const struct wallet_payment **by_label_index(struct wallet *w,
+						    const char *label,
+						    u64 *usec)
+{
+	const struct wallet_payment **payments;
+	struct timemono start = time_mono();
+
+	payments = wallet_payments_by_label(tmpctx, w, label);
+	*usec = time_to_usec(timemono_since(start));
+	return payments;
+}
+
+/* Recurring BOLT12 payments are found by label: with many payments that
+ * shouldn't mean loading them all.  BENCHMARK=1 uses a million. */
+static bool test_payments_by_label(struct lightningd *ld, const tal_t *ctx)
+{
+	struct wallet *w = create_test_wallet(ld, ctx);
+	struct wallet_payment *t = tal(ctx, struct wallet_payment);
+	struct db_stmt *stmt;
+	struct node_id destination;
+	struct sha256 payment_hash;
+	char label[32];
+	/* Each recurrence label gets used for this many payments */
+	const size_t per_label = 10;
+	const struct wallet_payment **payments;
+	size_t num = 1000, count, label_num;
+	bool found_unstored = false;
+	u64 usec_scan, usec_index;
+	const char *v;
+
+	v = getenv("BENCHMARK");
+	if (v && atoi(v) == 1)
+		num = 1000000;
+	label_num = num / per_label / 2;
+
+	memset(&destination, 2, sizeof(destination));
+	db_begin_transaction(w->db);
+	for (u64 i = 0; i < num; i++) {
+		memset(&payment_hash, 0, sizeof(payment_hash));
+		memcpy(&payment_hash, &i, sizeof(i));
+		stmt = db_prepare_v2(w->db,
+				     SQL("INSERT INTO payments ("
+					 "  status"
+					 ", payment_hash"
+					 ", destination"
+					 ", msatoshi"
+					 ", timestamp"
+					 ", msatoshi_sent"
+					 ", description"
+					 ", total_msat"
+					 ", partid"
+					 ", groupid"
+					 ") VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?);"));
+		db_bind_int(stmt, 0, PAYMENT_COMPLETE);
+		db_bind_sha256(stmt, 1, &payment_hash);
+		db_bind_node_id(stmt, 2, &destination);
+		db_bind_u64(stmt, 3, 1000);
+		db_bind_u64(stmt, 4, 1600000000 + i);
+		db_bind_u64(stmt, 5, 1001);
+		snprintf(label, sizeof(label), "label-%"PRIu64, i / per_label);
+		db_bind_text(stmt, 6, label);
+		db_bind_u64(stmt, 7, 1000);
+		db_bind_u64(stmt, 8, 0);
+		db_bind_u64(stmt, 9, i);
+		db_exec_prepared_v2(take(stmt));
+	}
+	db_commit_transaction(w->db);
+	CHECK(!wallet_err);
+
+	/* One which isn't in the db yet counts too. */
+	mempat(t, sizeof(*t));
+	t->destination = tal_dup(t, struct node_id, &destination);
+	t->id = 0;
+	t->msatoshi = t->total_msat = AMOUNT_MSAT(1000);
+	t->msatoshi_sent = AMOUNT_MSAT(1001);
+	t->status = PAYMENT_PENDING;
+	t->payment_preimage = NULL;
+	memset(&t->payment_hash, 0xFF, sizeof(t->payment_hash));
+	t->partid = 0;
+	t->groupid = 0;
+	t->label = tal_fmt(t, "label-%zu", label_num);
+	t->invstring = NULL;
+	t->local_invreq_id = NULL;
+	wallet_payment_setup(w, t);
+
+	db_begin_transaction(w->db);
+	CHECK(tal_count(by_label_index(w, "no-such-label", &usec_index)) == 0);
+	count = count_label_by_scan(w, t->label, &usec_scan);
+	CHECK(count == per_label + 1);
+
+	/* Exactly the ones we stored with this label, and the unstored one */
+	payments = by_label_index(w, t->label, &usec_index);
+	CHECK(tal_count(payments) == per_label + 1);
+	for (size_t i = 0; i < tal_count(payments); i++) {
+		u64 n;
+
+		CHECK(streq(payments[i]->label, t->label));
+		if (sha256_eq(&payments[i]->payment_hash, &t->payment_hash)) {
+			CHECK(!found_unstored);
+			CHECK(payments[i]->status == PAYMENT_PENDING);
+			found_unstored = true;
+			continue;
+		}
+		memcpy(&n, &payments[i]->payment_hash, sizeof(n));
+		CHECK(n / per_label == label_num);
+		CHECK(payments[i]->status == PAYMENT_COMPLETE);
+		for (size_t j = 0; j < i; j++)
+			CHECK(!sha256_eq(&payments[j]->payment_hash,
+					 &payments[i]->payment_hash));
+	}
+	CHECK(found_unstored);
+	db_commit_transaction(w->db);
+
+	if (v && atoi(v) == 1)
+		printf("%zu payments: by label took %"PRIu64"usec scanning, %"PRIu64"usec indexed\n",
+		       num, usec_scan, usec_index);
+	return true;
+}
+
 static bool test_wallet_payment_status_enum(void)
 {
 	CHECK(PAYMENT_PENDING == 0);
@@ -2025,6 +2320,14 @@ int main(int argc, const char *argv[])
 	peer_node_id_map_init(ld->peers);
 	ld->peers_by_dbid = tal(ld, struct peer_dbid_map);
 	peer_dbid_map_init(ld->peers_by_dbid);
+	ld->channels_by_scid = tal(ld, struct channel_scid_map);
+	channel_scid_map_init(ld->channels_by_scid);
+	ld->channels_by_alias = tal(ld, struct channel_alias_map);
+	channel_alias_map_init(ld->channels_by_alias);
+	ld->channels_by_cid = tal(ld, struct channel_cid_map);
+	channel_cid_map_init(ld->channels_by_cid);
+	ld->channels_by_dbid = tal(ld, struct channel_dbid_map);
+	channel_dbid_map_init(ld->channels_by_dbid);
 	ld->rr_counter = 0;
 	node_id_from_hexstr("02a1633cafcc01ebfb6d78e39f687a1f0995c62fc95f51ead10a02ee0be551b5dc", 66, &ld->id);
 	/* Accessed in peer destructor sanity check */
@@ -2042,7 +2345,9 @@ int main(int argc, const char *argv[])
 		ok &= test_channel_inflight_crud(ld, tmpctx);
 		ok &= test_wallet_outputs(ld, tmpctx);
 		ok &= test_htlc_crud(ld, tmpctx);
+		ok &= test_htlc_history(ld, tmpctx);
 		ok &= test_payment_crud(ld, tmpctx);
+		ok &= test_payments_by_label(ld, tmpctx);
 		ok &= test_wallet_payment_status_enum();
 	}
 
@@ -2406,6 +2406,12 @@ void wallet_channel_close(struct wallet *w, u64 wallet_id)
 	db_bind_u64(stmt, 0, wallet_id);
 	db_exec_prepared_v2(take(stmt));
 
+	/* Delete entries from `channel_htlc_archive` */
+	stmt = db_prepare_v2(w->db, SQL("DELETE FROM channel_htlc_archive "
+					"WHERE channel_id=?"));
+	db_bind_u64(stmt, 0, wallet_id);
+	db_exec_prepared_v2(take(stmt));
+
 	/* Delete entries from `htlc_sigs` */
 	stmt = db_prepare_v2(w->db, SQL("DELETE FROM htlc_sigs "
 					"WHERE channelid=?"));
@@ -3077,9 +3083,12 @@ void wallet_invoice_delete_expired(struct wallet *wallet, u64 e)
 	invoices_delete_expired(wallet->invoices, e);
 }
 bool wallet_invoice_iterate(struct wallet *wallet,
-			    struct invoice_iterator *it)
+			    struct invoice_iterator *it,
+			    bool want_invstring,
+			    const struct sha256 *local_offer_id)
 {
-	return invoices_iterate(wallet->invoices, it);
+	return invoices_iterate(wallet->invoices, it, want_invstring,
+				local_offer_id);
 }
 const struct invoice_details *
 wallet_invoice_iterator_deref(const tal_t *ctx, struct wallet *wallet,
@@ -3124,14 +3133,35 @@ struct htlc_stub *wallet_htlc_stubs(const tal_t *ctx, struct wallet *wallet,
 	struct sha256 payment_hash;
 	struct db_stmt *stmt;
 
+	/* Each part is a range scan on (channel_id, max_commit_num): an OR
+	 * here would make us walk every HTLC the channel ever had. */
 	stmt = db_prepare_v2(wallet->db,
 			     SQL("SELECT channel_id, direction, cltv_expiry, "
 				 "channel_htlc_id, payment_hash "
-				 "FROM channel_htlcs WHERE channel_id = ? AND min_commit_num <= ? AND ((max_commit_num IS NULL) OR max_commit_num >= ?);"));
+				 "FROM channel_htlcs WHERE channel_id = ?"
+				 " AND max_commit_num IS NULL"
+				 " AND min_commit_num <= ?"
+				 " UNION ALL "
+				 "SELECT channel_id, direction, cltv_expiry, "
+				 "channel_htlc_id, payment_hash "
+				 "FROM channel_htlcs WHERE channel_id = ?"
+				 " AND max_commit_num >= ?"
+				 " AND min_commit_num <= ?"
+				 " UNION ALL "
+				 "SELECT channel_id, direction, cltv_expiry, "
+				 "channel_htlc_id, payment_hash "
+				 "FROM channel_htlc_archive WHERE channel_id = ?"
+				 " AND max_commit_num >= ?"
+				 " AND min_commit_num <= ?;"));
 
 	db_bind_u64(stmt, 0, chan->dbid);
 	db_bind_u64(stmt, 1, commit_num);
-	db_bind_u64(stmt, 2, commit_num);
+	db_bind_u64(stmt, 2, chan->dbid);
+	db_bind_u64(stmt, 3, commit_num);
+	db_bind_u64(stmt, 4, commit_num);
+	db_bind_u64(stmt, 5, chan->dbid);
+	db_bind_u64(stmt, 6, commit_num);
+	db_bind_u64(stmt, 7, commit_num);
 	db_query_prepared(stmt);
 
 	stubs = tal_arr(ctx, struct htlc_stub, 0);
@@ -3154,6 +3184,66 @@ struct htlc_stub *wallet_htlc_stubs(const tal_t *ctx, struct wallet *wallet,
 	return stubs;
 }
 
+size_t wallet_htlcs_archive(struct wallet *wallet,
+			    const struct channel *chan,
+			    u64 commit_num,
+			    size_t max)
+{
+	struct db_stmt *stmt;
+	size_t moved;
+
+	/* Oldest first, so the live table only holds recent history. */
+	stmt = db_prepare_v2(wallet->db,
+			     SQL("INSERT INTO channel_htlc_archive ("
+				 " id"
+				 ", channel_id"
+				 ", channel_htlc_id"
+				 ", direction"
+				 ", msatoshi"
+				 ", cltv_expiry"
+				 ", payment_hash"
+				 ", hstate"
+				 ", min_commit_num"
+				 ", max_commit_num"
+				 ") SELECT"
+				 " id"
+				 ", channel_id"
+				 ", channel_htlc_id"
+				 ", direction"
+				 ", msatoshi"
+				 ", cltv_expiry"
+				 ", payment_hash"
+				 ", hstate"
+				 ", min_commit_num"
+				 ", max_commit_num"
+				 " FROM channel_htlcs WHERE id IN"
+				 " (SELECT id FROM channel_htlcs"
+				 "  WHERE channel_id = ? AND max_commit_num < ?"
+				 "  ORDER BY max_commit_num, id LIMIT ?);"));
+	db_bind_u64(stmt, 0, chan->dbid);
+	db_bind_u64(stmt, 1, commit_num);
+	db_bind_u64(stmt, 2, max);
+	db_exec_prepared_v2(stmt);
+	moved = db_count_changes(stmt);
+	tal_free(stmt);
+
+	if (!moved)
+		return 0;
+
+	/* Same rows: nothing else touches resolved HTLCs in between. */
+	stmt = db_prepare_v2(wallet->db,
+			     SQL("DELETE FROM channel_htlcs WHERE id IN"
+				 " (SELECT id FROM channel_htlcs"
+				 "  WHERE channel_id = ? AND max_commit_num < ?"
+				 "  ORDER BY max_commit_num, id LIMIT ?);"));
+	db_bind_u64(stmt, 0, chan->dbid);
+	db_bind_u64(stmt, 1, commit_num);
+	db_bind_u64(stmt, 2, max);
+	db_exec_prepared_v2(take(stmt));
+
+	return moved;
+}
+
 void wallet_local_htlc_out_delete(struct wallet *wallet,
 				  struct channel *chan,
 				  const struct sha256 *payment_hash,
@@ -3767,6 +3857,61 @@ wallet_payment_list(const tal_t *ctx,
 	return payments;
 }
 
+const struct wallet_payment **wallet_payments_by_label(const tal_t *ctx,
+						       struct wallet *wallet,
+						       const char *label)
+{
+	const struct wallet_payment **payments;
+	struct db_stmt *stmt;
+	struct wallet_payment *p;
+	size_t i;
+
+	payments = tal_arr(ctx, const struct wallet_payment *, 0);
+	/* The label lives in the description column, for historical reasons */
+	stmt = db_prepare_v2(wallet->db, SQL("SELECT"
+					     "  id"
+					     ", status"
+					     ", destination"
+					     ", msatoshi"
+					     ", payment_hash"
+					     ", timestamp"
+					     ", payment_preimage"
+					     ", path_secrets"
+					     ", route_nodes"
+					     ", route_channels"
+					     ", msatoshi_sent"
+					     ", description"
+					     ", bolt11"
+					     ", paydescription"
+					     ", failonionreply"
+					     ", total_msat"
+					     ", partid"
+					     ", local_invreq_id"
+					     ", groupid"
+					     ", completed_at"
+					     " FROM payments"
+					     " WHERE description = ?"
+					     " ORDER BY id;"));
+	db_bind_text(stmt, 0, label);
+	db_query_prepared(stmt);
+
+	for (i = 0; db_step(stmt); i++) {
+		tal_resize(&payments, i+1);
+		payments[i] = wallet_stmt2payment(payments, stmt);
+	}
+	tal_free(stmt);
+
+	/* Now attach payments not yet in db. */
+	list_for_each(&wallet->unstored_payments, p, list) {
+		if (!p->label || !streq(p->label, label))
+			continue;
+		tal_resize(&payments, i+1);
+		payments[i++] = p;
+	}
+
+	return payments;
+}
+
 const struct wallet_payment **
 wallet_payments_by_invoice_request(const tal_t *ctx,
 				   struct wallet *wallet,
@@ -5476,10 +5621,22 @@ struct wallet_htlc_iter *wallet_htlcs_first(const tal_t *ctx,
 					    ", h.msatoshi"
 					    ", h.payment_hash"
 					    ", h.hstate"
+					    ", h.id AS id"
 					    " FROM channel_htlcs h"
 					    " WHERE channel_id = ?"
+					    " UNION ALL"
+					    " SELECT a.channel_htlc_id"
+					    ", a.cltv_expiry"
+					    ", a.direction"
+					    ", a.msatoshi"
+					    ", a.payment_hash"
+					    ", a.hstate"
+					    ", a.id"
+					    " FROM channel_htlc_archive a"
+					    " WHERE channel_id = ?"
 					    " ORDER BY id ASC"));
 		db_bind_u64(i->stmt, 0, chan->dbid);
+		db_bind_u64(i->stmt, 1, chan->dbid);
 	} else {
 		i->scid.u64 = 0;
 		i->stmt = db_prepare_v2(w->db,
@@ -5491,9 +5648,22 @@ struct wallet_htlc_iter *wallet_htlcs_first(const tal_t *ctx,
 					    ", h.msatoshi"
 					    ", h.payment_hash"
 					    ", h.hstate"
+					    ", h.id AS id"
 					    " FROM channel_htlcs h"
 					    " JOIN channels ON channels.id = h.channel_id"
-					    " ORDER BY h.id ASC"));
+					    " UNION ALL"
+					    " SELECT channels.scid"
+					    ", channels.alias_local"
+					    ", a.channel_htlc_id"
+					    ", a.cltv_expiry"
+					    ", a.direction"
+					    ", a.msatoshi"
+					    ", a.payment_hash"
+					    ", a.hstate"
+					    ", a.id"
+					    " FROM channel_htlc_archive a"
+					    " JOIN channels ON channels.id = a.channel_id"
+					    " ORDER BY id ASC"));
 	}
 	/* FIXME: db_prepare should take ctx! */
 	tal_steal(i, i->stmt);
@@ -5536,5 +5706,7 @@ struct wallet_htlc_iter *wallet_htlcs_next(struct wallet *w,
 	db_col_sha256(iter->stmt, "h.payment_hash", payment_hash);
 	*cltv_expiry = db_col_int(iter->stmt, "h.cltv_expiry");
 	*hstate = db_col_int(iter->stmt, "h.hstate");
+	/* Only there so archived HTLCs sort in with the rest */
+	db_col_ignore(iter->stmt, "id");
 	return iter;
 }
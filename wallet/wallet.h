@@ -866,6 +866,7 @@ struct invoice_iterator {
 	/* The contents of this object is subject to change
 	 * and should not be depended upon */
 	void *p;
+	bool invstring;
 };
 
 struct invoice {
@@ -977,18 +978,23 @@ void wallet_invoice_delete_expired(struct wallet *wallet,
  *
  * @wallet - the wallet whose invoices are to be iterated over.
  * @iterator - the iterator object to use.
+ * @want_invstring - if false, don't load invstring (it will be NULL):
+ *   it's the bulk of each invoice, so skip it if it's not needed.
+ * @local_offer_id - if non-NULL, only invoices for this offer (indexed).
  *
  * Return false at end-of-sequence, true if still iterating.
  * Usage:
  *
  *   struct invoice_iterator it;
  *   memset(&it, 0, sizeof(it))
- *   while (wallet_invoice_iterate(wallet, &it)) {
+ *   while (wallet_invoice_iterate(wallet, &it, true, NULL)) {
  *       ...
  *   }
  */
 bool wallet_invoice_iterate(struct wallet *wallet,
-			    struct invoice_iterator *it);
+			    struct invoice_iterator *it,
+			    bool want_invstring,
+			    const struct sha256 *local_offer_id);
 
 /**
  * wallet_invoice_iterator_deref - Read the details of the
@@ -1086,6 +1092,25 @@ struct invoice_details *wallet_invoice_details(const tal_t *ctx,
 struct htlc_stub *wallet_htlc_stubs(const tal_t *ctx, struct wallet *wallet,
 				    struct channel *chan, u64 commit_num);
 
+/**
+ * wallet_htlcs_archive - Move long-resolved HTLCs out of channel_htlcs
+ *
+ * They're kept (minus the onion and secrets, which are gone anyway) in
+ * channel_htlc_archive, where wallet_htlc_stubs() and listhtlcs still see
+ * them, but the live table doesn't grow forever.
+ *
+ * @wallet: Wallet to update
+ * @chan: Channel whose HTLCs to archive
+ * @commit_num: Archive HTLCs resolved before this commitment number
+ * @max: The most to move in one go, so we don't stall lightningd.
+ *
+ * Returns the number moved: if it's @max, there may be more.
+ */
+size_t wallet_htlcs_archive(struct wallet *wallet,
+			    const struct channel *chan,
+			    u64 commit_num,
+			    size_t max);
+
 /**
  * wallet_payment_setup - Remember this payment for later committing.
  *
@@ -1210,6 +1235,16 @@ const struct wallet_payment **wallet_payment_list(const tal_t *ctx,
 	NON_NULL_ARGS(2);
 
 
+/**
+ * wallet_payments_by_label - Retrieve a list of payments with this label
+ *
+ * Uses the label index, so it's cheap even with millions of payments.
+ */
+const struct wallet_payment **wallet_payments_by_label(const tal_t *ctx,
+						       struct wallet *wallet,
+						       const char *label)
+	NON_NULL_ARGS(2, 3);
+
 /**
  * wallet_payments_by_invoice_request - Retrieve a list of payments for this local_invreq_id
  */
@@ -1,10 +1,12 @@
 #include "config.h"
 /* FIXME: io_plan needs size_t */
  #include <unistd.h>
+#include <ccan/array_size/array_size.h>
 #include <ccan/io/io_plan.h>
 #include <ccan/mem/mem.h>
 #include <common/utils.h>
 #include <errno.h>
+#include <sys/uio.h>
 #include <wire/wire_io.h>
 
 /*
@@ -82,36 +84,39 @@ struct io_plan *io_read_wire_(struct io_conn *conn,
 	return io_set_plan(conn, IO_IN, do_read_wire, next, next_arg);
 }
 
-/* arg->u2.s contains length we've written, arg->u1 contains u8 *data. */
-static int do_write_wire_header(int fd, struct io_plan_arg *arg)
+/* Fill in iov[] for the unwritten part of a message: returns number used. */
+static size_t wire_iov(struct iovec *iov,
+		       const wire_len_t *hdr, const u8 *msg, size_t off)
 {
-	ssize_t ret;
-	size_t len = arg->u2.s & ~INSIDE_HEADER_BIT;
-	wire_len_t hdr = cpu_to_wirelen(tal_count(arg->u1.const_vp));
-
-	ret = write(fd, (char *)&hdr + len, HEADER_LEN - len);
-	if (ret <= 0)
-		return -1;
-	arg->u2.s += ret;
+	size_t n = 0;
 
-	/* Both bytes written?  Set up for normal write of data. */
-	if (arg->u2.s == INSIDE_HEADER_BIT + HEADER_LEN)
-		arg->u2.s = 0;
+	if (off < HEADER_LEN) {
+		iov[n].iov_base = (char *)hdr + off;
+		iov[n].iov_len = HEADER_LEN - off;
+		n++;
+		off = 0;
+	} else
+		off -= HEADER_LEN;
 
-	return 0;
+	if (tal_bytelen(msg) != off) {
+		iov[n].iov_base = (u8 *)msg + off;
+		iov[n].iov_len = tal_bytelen(msg) - off;
+		n++;
+	}
+	return n;
 }
 
+/* arg->u2.s contains length we've written (including header), arg->u1
+ * contains u8 *data. */
 static int do_write_wire(int fd, struct io_plan_arg *arg)
 {
 	ssize_t ret;
-	size_t totlen = tal_bytelen(arg->u1.cp);
-
-	/* Still writing header? */
-	if (arg->u2.s & INSIDE_HEADER_BIT)
-		return do_write_wire_header(fd, arg);
+	struct iovec iov[2];
+	size_t totlen = HEADER_LEN + tal_bytelen(arg->u1.cp);
+	wire_len_t hdr = cpu_to_wirelen(tal_bytelen(arg->u1.cp));
 
-	/* Normal write */
-	ret = write(fd, arg->u1.cp + arg->u2.s, totlen - arg->u2.s);
+	/* Header and body go together: one syscall, one packet. */
+	ret = writev(fd, iov, wire_iov(iov, &hdr, arg->u1.const_vp, arg->u2.s));
 	if (ret < 0)
 		return -1;
 
@@ -140,6 +145,215 @@ struct io_plan *io_write_wire_(struct io_conn *conn,
 					  memcheck(data, tal_bytelen(data)));
 
 	/* We use u2 to store the length we've written. */
-	arg->u2.s = INSIDE_HEADER_BIT;
+	arg->u2.s = 0;
 	return io_set_plan(conn, IO_OUT, do_write_wire, next, next_arg);
 }
+
+/* Several messages going out in as few writev() as possible. */
+struct wire_batch {
+	const u8 **msgs;
+	wire_len_t *hdrs;
+	/* First message not completely written, and how much of it is. */
+	size_t n, off;
+};
+
+/* 2 iovecs per message: well below any IOV_MAX. */
+#define WIRE_BATCH_IOV (WIRE_WRITE_BATCH * 2)
+
+/* arg->u1.vp contains struct wire_batch. */
+static int do_write_wires(int fd, struct io_plan_arg *arg)
+{
+	struct wire_batch *batch = arg->u1.vp;
+	struct iovec iov[WIRE_BATCH_IOV];
+	size_t niov = 0, off = batch->off;
+	ssize_t ret;
+
+	for (size_t i = batch->n;
+	     i < tal_count(batch->msgs) && niov + 2 <= ARRAY_SIZE(iov);
+	     i++) {
+		niov += wire_iov(iov + niov, &batch->hdrs[i], batch->msgs[i],
+				 off);
+		off = 0;
+	}
+
+	ret = writev(fd, iov, niov);
+	if (ret < 0)
+		return -1;
+
+	/* Skip over whatever made it out. */
+	while (ret) {
+		size_t left = HEADER_LEN + tal_bytelen(batch->msgs[batch->n])
+			- batch->off;
+		if ((size_t)ret < left) {
+			batch->off += ret;
+			break;
+		}
+		ret -= left;
+		batch->n++;
+		batch->off = 0;
+	}
+
+	if (batch->n != tal_count(batch->msgs))
+		return 0;
+
+	tal_free(batch);
+	return 1;
+}
+
+struct io_plan *io_write_wires_(struct io_conn *conn,
+				const u8 **msgs,
+				struct io_plan *(*next)(struct io_conn *, void *),
+				void *next_arg)
+{
+	struct io_plan_arg *arg = io_plan_arg(conn, IO_OUT);
+	struct wire_batch *batch = tal(conn, struct wire_batch);
+	size_t num = tal_count(msgs);
+
+	if (taken(msgs))
+		batch->msgs = tal_steal(batch, msgs);
+	else {
+		batch->msgs = tal_arr(batch, const u8 *, num);
+		for (size_t i = 0; i < num; i++)
+			batch->msgs[i] = tal_dup_talarr(batch->msgs, u8,
+							msgs[i]);
+	}
+
+	batch->hdrs = tal_arr(batch, wire_len_t, num);
+	for (size_t i = 0; i < num; i++) {
+		size_t len = tal_bytelen(batch->msgs[i]);
+		if (len >= INSIDE_HEADER_BIT) {
+			tal_free(batch);
+			errno = E2BIG;
+			return io_close(conn);
+		}
+		batch->hdrs[i] = cpu_to_wirelen(len);
+	}
+	batch->n = batch->off = 0;
+
+	arg->u1.vp = batch;
+	return io_set_plan(conn, IO_OUT, do_write_wires, next, next_arg);
+}
+
+/* We read this much at a time, unless a message needs more. */
+#define WIRE_RBUF_SIZE 65536
+
+struct wire_rbuf {
+	/* Unconsumed bytes are buf[start] to buf[end]. */
+	u8 *buf;
+	size_t start, end;
+
+	/* Where to put the message once we have it. */
+	const tal_t *ctx;
+	u8 **data;
+};
+
+struct wire_rbuf *wire_rbuf_new(const tal_t *ctx)
+{
+	struct wire_rbuf *rbuf = tal(ctx, struct wire_rbuf);
+
+	rbuf->buf = tal_arr(rbuf, u8, WIRE_RBUF_SIZE);
+	rbuf->start = rbuf->end = 0;
+	return rbuf;
+}
+
+bool wire_rbuf_empty(const struct wire_rbuf *rbuf)
+{
+	return rbuf->start == rbuf->end;
+}
+
+/* Returns total length (inc header) of message at front, or 0 if we don't
+ * have the header yet.  Sets errno and returns -1 if it's too long. */
+static ssize_t rbuf_msglen(const struct wire_rbuf *rbuf)
+{
+	wire_len_t hdr;
+	size_t len;
+
+	if (rbuf->end - rbuf->start < HEADER_LEN)
+		return 0;
+
+	memcpy(&hdr, rbuf->buf + rbuf->start, HEADER_LEN);
+	len = wirelen_to_cpu(hdr);
+	if (len >= INSIDE_HEADER_BIT) {
+		errno = E2BIG;
+		return -1;
+	}
+	return HEADER_LEN + len;
+}
+
+/* Hand over a complete message if we have one: -1 on error. */
+static int rbuf_extract(struct wire_rbuf *rbuf)
+{
+	ssize_t msglen = rbuf_msglen(rbuf);
+
+	if (msglen < 0)
+		return -1;
+	if (msglen == 0 || rbuf->end - rbuf->start < (size_t)msglen)
+		return 0;
+
+	*rbuf->data = tal_dup_arr(rbuf->ctx, u8,
+				  rbuf->buf + rbuf->start + HEADER_LEN,
+				  msglen - HEADER_LEN, 0);
+	rbuf->start += msglen;
+	if (rbuf->start == rbuf->end)
+		rbuf->start = rbuf->end = 0;
+	return 1;
+}
+
+/* arg->u1.vp contains struct wire_rbuf */
+static int do_read_wire_buffered(int fd, struct io_plan_arg *arg)
+{
+	struct wire_rbuf *rbuf = arg->u1.vp;
+	ssize_t ret, msglen = rbuf_msglen(rbuf);
+	size_t want;
+
+	if (msglen < 0)
+		return -1;
+
+	/* Move any partial message to the front, and make room for it. */
+	if (rbuf->start) {
+		memmove(rbuf->buf, rbuf->buf + rbuf->start,
+			rbuf->end - rbuf->start);
+		rbuf->end -= rbuf->start;
+		rbuf->start = 0;
+	}
+	want = msglen;
+	if (want < WIRE_RBUF_SIZE)
+		want = WIRE_RBUF_SIZE;
+	/* Grow for huge messages, shrink again once they're gone. */
+	if (tal_bytelen(rbuf->buf) != want
+	    && (want > tal_bytelen(rbuf->buf) || rbuf->end <= want))
+		tal_resize(&rbuf->buf, want);
+
+	ret = read(fd, rbuf->buf + rbuf->end, tal_bytelen(rbuf->buf) - rbuf->end);
+	if (ret <= 0)
+		return -1;
+	rbuf->end += ret;
+
+	return rbuf_extract(rbuf);
+}
+
+struct io_plan *io_read_wire_buffered_(struct io_conn *conn,
+				       const tal_t *ctx,
+				       u8 **data,
+				       struct wire_rbuf *rbuf,
+				       struct io_plan *(*next)(struct io_conn *,
+							       void *),
+				       void *next_arg)
+{
+	struct io_plan_arg *arg = io_plan_arg(conn, IO_IN);
+
+	*data = NULL;
+	rbuf->ctx = ctx;
+	rbuf->data = data;
+
+	/* Already have it?  No need to wait for the fd. */
+	switch (rbuf_extract(rbuf)) {
+	case -1:
+		return io_close(conn);
+	case 1:
+		return io_always_(conn, next, next_arg);
+	}
+
+	arg->u1.vp = rbuf;
+	return io_set_plan(conn, IO_IN, do_read_wire_buffered, next, next_arg);
+}
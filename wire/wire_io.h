@@ -36,4 +36,47 @@ struct io_plan *io_write_wire_(struct io_conn *conn,
 		       typesafe_cb_preargs(struct io_plan *, void *,	\
 					   (next), (arg), struct io_conn *), \
 		       (arg))
+
+/* Most messages io_write_wires() hands to a single writev(). */
+#define WIRE_WRITE_BATCH 32
+
+/* Write tal array of messages, back-to-back: msgs can be take(), in which
+ * case the messages are freed along with it.  Unlike looping on
+ * io_write_wire, this needs only one syscall for many small messages. */
+struct io_plan *io_write_wires_(struct io_conn *conn,
+				const u8 **msgs,
+				struct io_plan *(*next)(struct io_conn *, void *),
+				void *next_arg);
+
+#define io_write_wires(conn, msgs, next, arg)				\
+	io_write_wires_((conn), (msgs),					\
+			typesafe_cb_preargs(struct io_plan *, void *,	\
+					    (next), (arg), struct io_conn *), \
+			(arg))
+
+/* Read-ahead buffer for io_read_wire_buffered. */
+struct wire_rbuf *wire_rbuf_new(const tal_t *ctx);
+
+/* Is there anything (even a partial message) in the buffer? */
+bool wire_rbuf_empty(const struct wire_rbuf *rbuf);
+
+/* Like io_read_wire, but reads as much as is available into rbuf, and
+ * only needs to read() again once the messages in there are used up.
+ *
+ * Never use this on a connection which also receives fds: the byte sent
+ * with an fd could be consumed by the read-ahead, losing the fd. */
+struct io_plan *io_read_wire_buffered_(struct io_conn *conn,
+				       const tal_t *ctx,
+				       u8 **data,
+				       struct wire_rbuf *rbuf,
+				       struct io_plan *(*next)(struct io_conn *,
+							       void *),
+				       void *next_arg);
+
+#define io_read_wire_buffered(conn, ctx, data, rbuf, next, arg)		\
+	io_read_wire_buffered_((conn), (ctx), (data), (rbuf),		\
+			       typesafe_cb_preargs(struct io_plan *, void *, \
+						   (next), (arg),	\
+						   struct io_conn *),	\
+			       (arg))
 #endif /* LIGHTNING_WIRE_WIRE_IO_H */